@@ -2,6 +2,9 @@
 #include "MOVitalsComponent.h"
 #include "MOMentalStateComponent.h"
 #include "MOBodyPartDefinitionRow.h"
+#include "MOMedicalSchedulerSubsystem.h"
+#include "MOIdentityComponent.h"
+#include "MOMedicalDatabaseSettings.h"
 #include "Net/UnrealNetwork.h"
 #include "Engine/DataTable.h"
 #include "TimerManager.h"
@@ -26,27 +29,59 @@ void UMOAnatomyComponent::BeginPlay()
 		CachedMentalComp = Owner->FindComponentByClass<UMOMentalStateComponent>();
 	}
 
+	ReseedRandomStream();
+
+	// Loading or possession can assign the identity GUID after BeginPlay
+	if (UMOIdentityComponent* Identity = GetOwner() ? GetOwner()->FindComponentByClass<UMOIdentityComponent>() : nullptr)
+	{
+		Identity->OnGuidAvailable.AddUniqueDynamic(this, &UMOAnatomyComponent::HandleIdentityGuidAvailable);
+	}
+
 	// Initialize body parts on authority
 	if (GetOwnerRole() == ROLE_Authority)
 	{
 		InitializeBodyParts();
 
-		// Start tick timer
-		if (UWorld* World = GetWorld())
+		// Start ticking: prefer the batched world scheduler, fall back to a per-component timer
+		UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this);
+		if (Scheduler && Scheduler->RegisterComponent(this))
 		{
-			World->GetTimerManager().SetTimer(
-				TickTimerHandle,
-				this,
-				&UMOAnatomyComponent::TickAnatomy,
-				TickInterval,
-				true
-			);
+			// Event scheduling needs the scheduler's queue, so only the scheduled path can use it
+			const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+			bUseEventScheduling = Settings && Settings->bUseWoundEventScheduling;
+			if (Settings)
+			{
+				EventStageSize = Settings->WoundEventStageSize;
+			}
+		}
+		else
+		{
+			if (UWorld* World = GetWorld())
+			{
+				World->GetTimerManager().SetTimer(
+					TickTimerHandle,
+					this,
+					&UMOAnatomyComponent::TickAnatomy,
+					TickInterval,
+					true
+				);
+			}
 		}
 	}
 }
 
 void UMOAnatomyComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UMOIdentityComponent* Identity = GetOwner() ? GetOwner()->FindComponentByClass<UMOIdentityComponent>() : nullptr)
+	{
+		Identity->OnGuidAvailable.RemoveDynamic(this, &UMOAnatomyComponent::HandleIdentityGuidAvailable);
+	}
+
+	if (UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this))
+	{
+		Scheduler->UnregisterComponent(this);
+	}
+
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(TickTimerHandle);
@@ -65,6 +100,16 @@ void UMOAnatomyComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>&
 	DOREPLIFETIME_CONDITION(UMOAnatomyComponent, Conditions, COND_OwnerOnly);
 }
 
+void UMOAnatomyComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(BodyParts.GetAllocatedSize());
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Wounds.Wounds.GetAllocatedSize());
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(Conditions.Conditions.GetAllocatedSize());
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(WoundContributions.GetAllocatedSize());
+}
+
 // ============================================================================
 // INITIALIZATION
 // ============================================================================
@@ -159,6 +204,7 @@ bool UMOAnatomyComponent::InflictDamage(EMOBodyPartType Part, float Damage, EMOW
 		NewWound.TimeSinceInflicted = 0.0f;
 
 		Wounds.AddWound(NewWound);
+		TrackWoundAdded(Wounds.Wounds.Last());
 
 		// Apply shock from wound
 		ApplyShock(WoundDef.ShockContribution * (NewWound.Severity / 100.0f));
@@ -205,6 +251,7 @@ bool UMOAnatomyComponent::InflictWound(const FMOWound& Wound)
 	}
 
 	Wounds.AddWound(NewWound);
+	TrackWoundAdded(Wounds.Wounds.Last());
 	OnWoundInflicted.Broadcast(NewWound.WoundId, NewWound.WoundType);
 
 	return true;
@@ -223,13 +270,15 @@ bool UMOAnatomyComponent::HealWound(const FGuid& WoundId, float HealAmount)
 		return false;
 	}
 
+	BeginWoundChange(*Wound);
 	Wound->HealingProgress = FMath::Clamp(Wound->HealingProgress + HealAmount, 0.0f, 100.0f);
-	Wounds.MarkItemDirty(*Wound);
+	EndWoundChange(*Wound);
 
 	// Check if fully healed
 	if (Wound->HealingProgress >= 100.0f)
 	{
 		FGuid HealedId = WoundId;
+		TrackWoundRemoved(*Wound);
 		Wounds.RemoveWound(WoundId);
 		OnWoundHealed.Broadcast(HealedId);
 	}
@@ -263,13 +312,15 @@ bool UMOAnatomyComponent::ApplyTreatment(const FGuid& WoundId, FName TreatmentId
 		Quality *= 0.7f;  // 30% penalty for self-treatment
 	}
 
+	BeginWoundChange(*Wound);
+
 	// Reduce bleed rate
 	Wound->BleedRate *= (1.0f - (0.5f * Quality));
 
 	// Reduce infection risk
 	Wound->InfectionRisk *= (1.0f - (0.3f * Quality));
 
-	Wounds.MarkItemDirty(*Wound);
+	EndWoundChange(*Wound);
 	return true;
 }
 
@@ -286,11 +337,12 @@ bool UMOAnatomyComponent::ApplyBandage(const FGuid& WoundId, float Quality)
 		return false;
 	}
 
+	BeginWoundChange(*Wound);
 	Wound->bIsBandaged = true;
 	Wound->BleedRate *= (1.0f - (0.7f * Quality));  // Reduce bleed significantly
 	Wound->InfectionRisk *= (1.0f - (0.2f * Quality));
+	EndWoundChange(*Wound);
 
-	Wounds.MarkItemDirty(*Wound);
 	return true;
 }
 
@@ -307,10 +359,11 @@ bool UMOAnatomyComponent::ApplySutures(const FGuid& WoundId, float Quality)
 		return false;
 	}
 
+	BeginWoundChange(*Wound);
 	Wound->bIsSutured = true;
 	Wound->BleedRate *= (1.0f - (0.9f * Quality));  // Nearly stop bleeding
+	EndWoundChange(*Wound);
 
-	Wounds.MarkItemDirty(*Wound);
 	return true;
 }
 
@@ -345,6 +398,7 @@ bool UMOAnatomyComponent::AddCondition(EMOConditionType ConditionType, EMOBodyPa
 	NewCondition.bIsTreated = false;
 
 	Conditions.AddCondition(NewCondition);
+	TrackConditionAdded(Conditions.Conditions.Last());
 	OnConditionAdded.Broadcast(NewCondition.ConditionId, ConditionType);
 
 	return true;
@@ -364,8 +418,10 @@ bool UMOAnatomyComponent::RemoveCondition(const FGuid& ConditionId)
 	}
 
 	EMOConditionType Type = Condition->ConditionType;
+	TrackConditionRemoving(*Condition);
 	if (Conditions.RemoveCondition(ConditionId))
 	{
+		TrackConditionRemoved(Type);
 		OnConditionRemoved.Broadcast(ConditionId, Type);
 		return true;
 	}
@@ -375,10 +431,8 @@ bool UMOAnatomyComponent::RemoveCondition(const FGuid& ConditionId)
 
 bool UMOAnatomyComponent::HasCondition(EMOConditionType ConditionType) const
 {
-	return Conditions.Conditions.ContainsByPredicate([ConditionType](const FMOCondition& Cond)
-	{
-		return Cond.ConditionType == ConditionType;
-	});
+	const int32 TypeIndex = static_cast<int32>(ConditionType);
+	return TypeIndex < static_cast<int32>(EMOConditionType::MAX) && Aggregates.ConditionCountByType[TypeIndex] > 0;
 }
 
 bool UMOAnatomyComponent::GetConditionByType(EMOConditionType ConditionType, FMOCondition& OutCondition) const
@@ -402,39 +456,18 @@ bool UMOAnatomyComponent::GetConditionByType(EMOConditionType ConditionType, FMO
 
 float UMOAnatomyComponent::GetTotalBleedRate() const
 {
-	float TotalRate = 0.0f;
-	for (const FMOWound& Wound : Wounds.Wounds)
-	{
-		TotalRate += Wound.BleedRate;
-	}
-	return TotalRate;
+	return Aggregates.TotalBleedRate;
 }
 
 float UMOAnatomyComponent::GetTotalPainLevel() const
 {
-	float TotalPain = 0.0f;
-
-	// Pain from wounds
-	for (const FMOWound& Wound : Wounds.Wounds)
-	{
-		FMOWoundTypeDefinitionRow WoundDef;
-		if (GetWoundTypeDefinition(Wound.WoundType, WoundDef))
-		{
-			TotalPain += Wound.Severity * WoundDef.PainMultiplier * 0.3f;
-		}
-		else
-		{
-			TotalPain += Wound.Severity * 0.3f;
-		}
-
-		// Infected wounds hurt more
-		if (Wound.bIsInfected)
-		{
-			TotalPain += Wound.InfectionSeverity * 0.2f;
-		}
-	}
+	return FMath::Clamp(Aggregates.TotalPain, 0.0f, 100.0f);
+}
 
-	return FMath::Clamp(TotalPain, 0.0f, 100.0f);
+int32 UMOAnatomyComponent::GetWoundCountOnPart(EMOBodyPartType Part) const
+{
+	const int32 PartIndex = static_cast<int32>(Part);
+	return PartIndex < static_cast<int32>(EMOBodyPartType::MAX) ? Aggregates.WoundCountByPart[PartIndex] : 0;
 }
 
 bool UMOAnatomyComponent::IsBodyPartFunctional(EMOBodyPartType Part) const
@@ -572,6 +605,7 @@ void UMOAnatomyComponent::BuildSaveData(FMOAnatomySaveData& OutSaveData) const
 		Entry.bIsInfected = Wound.bIsInfected;
 		Entry.InfectionSeverity = Wound.InfectionSeverity;
 		Entry.TimeSinceInflicted = Wound.TimeSinceInflicted;
+		Entry.EventSerial = Wound.EventSerial;
 		OutSaveData.Wounds.Add(Entry);
 	}
 
@@ -585,6 +619,7 @@ void UMOAnatomyComponent::BuildSaveData(FMOAnatomySaveData& OutSaveData) const
 		Entry.Severity = Condition.Severity;
 		Entry.Duration = Condition.Duration;
 		Entry.bIsTreated = Condition.bIsTreated;
+		Entry.EventSerial = Condition.EventSerial;
 		OutSaveData.Conditions.Add(Entry);
 	}
 }
@@ -600,6 +635,7 @@ bool UMOAnatomyComponent::ApplySaveDataAuthority(const FMOAnatomySaveData& InSav
 	BodyParts.Empty();
 	Wounds.Wounds.Empty();
 	Conditions.Conditions.Empty();
+	ResetAggregates();
 
 	// Restore body parts
 	for (const FMOBodyPartSaveEntry& Entry : InSaveData.BodyParts)
@@ -635,7 +671,9 @@ bool UMOAnatomyComponent::ApplySaveDataAuthority(const FMOAnatomySaveData& InSav
 		Wound.bIsInfected = Entry.bIsInfected;
 		Wound.InfectionSeverity = Entry.InfectionSeverity;
 		Wound.TimeSinceInflicted = Entry.TimeSinceInflicted;
+		Wound.EventSerial = Entry.EventSerial;
 		Wounds.AddWound(Wound);
+		TrackWoundAdded(Wounds.Wounds.Last());
 	}
 
 	// Restore conditions
@@ -648,7 +686,9 @@ bool UMOAnatomyComponent::ApplySaveDataAuthority(const FMOAnatomySaveData& InSav
 		Condition.Severity = Entry.Severity;
 		Condition.Duration = Entry.Duration;
 		Condition.bIsTreated = Entry.bIsTreated;
+		Condition.EventSerial = Entry.EventSerial;
 		Conditions.AddCondition(Condition);
+		TrackConditionAdded(Conditions.Conditions.Last());
 	}
 
 	return true;
@@ -660,23 +700,28 @@ bool UMOAnatomyComponent::ApplySaveDataAuthority(const FMOAnatomySaveData& InSav
 
 void UMOAnatomyComponent::OnWoundReplicatedAdd(const FMOWound& Wound)
 {
+	AddWoundContribution(Wound);
+
 	// Client-side notification
 	OnWoundInflicted.Broadcast(Wound.WoundId, Wound.WoundType);
 }
 
 void UMOAnatomyComponent::OnWoundReplicatedChange(const FMOWound& Wound)
 {
-	// Optional: notify UI of wound updates
+	AddWoundContribution(Wound);
 }
 
 void UMOAnatomyComponent::OnWoundReplicatedRemove(const FMOWound& Wound)
 {
+	RemoveWoundContribution(Wound.WoundId);
+
 	// Client-side notification
 	OnWoundHealed.Broadcast(Wound.WoundId);
 }
 
 void UMOAnatomyComponent::OnConditionReplicatedAdd(const FMOCondition& Condition)
 {
+	AddConditionContribution(Condition);
 	OnConditionAdded.Broadcast(Condition.ConditionId, Condition.ConditionType);
 }
 
@@ -687,6 +732,7 @@ void UMOAnatomyComponent::OnConditionReplicatedChange(const FMOCondition& Condit
 
 void UMOAnatomyComponent::OnConditionReplicatedRemove(const FMOCondition& Condition)
 {
+	RemoveConditionContribution(Condition);
 	OnConditionRemoved.Broadcast(Condition.ConditionId, Condition.ConditionType);
 }
 
@@ -703,32 +749,40 @@ FMOBodyPartState* UMOAnatomyComponent::GetBodyPartStateMutable(EMOBodyPartType P
 }
 
 void UMOAnatomyComponent::TickAnatomy()
+{
+	AdvanceSimulation(TickInterval);
+}
+
+void UMOAnatomyComponent::AdvanceSimulation(float DeltaSeconds)
 {
 	if (GetOwnerRole() != ROLE_Authority)
 	{
 		return;
 	}
 
-	float ScaledDeltaTime = TickInterval * TimeScaleMultiplier;
+	float ScaledDeltaTime = DeltaSeconds * TimeScaleMultiplier;
 
-	// Process wounds
-	float TotalBleedRate = 0.0f;
-	for (int32 i = Wounds.Wounds.Num() - 1; i >= 0; --i)
+	// With event scheduling, wounds and conditions only change when their queued
+	// transitions come due (see HandleScheduledEvent); nothing to walk here.
+	if (!bUseEventScheduling)
 	{
-		ProcessWound(Wounds.Wounds[i], ScaledDeltaTime);
-		TotalBleedRate += Wounds.Wounds[i].BleedRate;
-	}
+		// Process wounds
+		for (int32 i = Wounds.Wounds.Num() - 1; i >= 0; --i)
+		{
+			ProcessWound(Wounds.Wounds[i], ScaledDeltaTime);
+		}
 
-	// Apply blood loss to vitals
-	if (TotalBleedRate > 0.0f)
-	{
-		ApplyBloodLoss(TotalBleedRate * ScaledDeltaTime);
+		// Process conditions
+		for (int32 i = Conditions.Conditions.Num() - 1; i >= 0; --i)
+		{
+			ProcessCondition(Conditions.Conditions[i], ScaledDeltaTime);
+		}
 	}
 
-	// Process conditions
-	for (int32 i = Conditions.Conditions.Num() - 1; i >= 0; --i)
+	// Apply blood loss to vitals (wounds that healed this step no longer count)
+	if (Aggregates.TotalBleedRate > 0.0f)
 	{
-		ProcessCondition(Conditions.Conditions[i], ScaledDeltaTime);
+		ApplyBloodLoss(Aggregates.TotalBleedRate * ScaledDeltaTime);
 	}
 
 	// Update pain level in exertion state
@@ -747,7 +801,7 @@ void UMOAnatomyComponent::ProcessWound(FMOWound& Wound, float DeltaTime)
 	if (!Wound.bIsInfected && Wound.InfectionRisk > 0.0f)
 	{
 		float InfectionChance = Wound.InfectionRisk * DeltaTime * 0.001f;  // Per-tick chance
-		if (FMath::FRand() < InfectionChance)
+		if (RandomStream.FRand() < InfectionChance)
 		{
 			Wound.bIsInfected = true;
 			Wound.InfectionSeverity = 10.0f;
@@ -757,8 +811,7 @@ void UMOAnatomyComponent::ProcessWound(FMOWound& Wound, float DeltaTime)
 	// Progress infection
 	if (Wound.bIsInfected)
 	{
-		float InfectionGrowth = Wound.bIsBandaged ? 0.5f : 1.0f;  // Bandages slow infection
-		Wound.InfectionSeverity = FMath::Min(100.0f, Wound.InfectionSeverity + InfectionGrowth * DeltaTime * 0.01f);
+		Wound.InfectionSeverity = FMath::Min(100.0f, Wound.InfectionSeverity + GetWoundInfectionGrowthRate(Wound) * DeltaTime);
 
 		// Severe infection can become systemic
 		if (Wound.InfectionSeverity >= 80.0f && !HasCondition(EMOConditionType::Sepsis))
@@ -768,6 +821,66 @@ void UMOAnatomyComponent::ProcessWound(FMOWound& Wound, float DeltaTime)
 	}
 
 	// Natural healing (very slow without treatment)
+	Wound.HealingProgress = FMath::Min(100.0f, Wound.HealingProgress + GetWoundHealRate(Wound) * DeltaTime);
+
+	// Reduce bleed rate as wound heals
+	float HealFactor = 1.0f - (Wound.HealingProgress / 100.0f);
+	// Bleed rate naturally decreases as wound closes
+
+	// Check if fully healed
+	if (Wound.HealingProgress >= 100.0f)
+	{
+		FGuid HealedId = Wound.WoundId;
+		TrackWoundRemoved(Wound);
+		Wounds.RemoveWound(HealedId);
+		OnWoundHealed.Broadcast(HealedId);
+	}
+	else
+	{
+		AddWoundContribution(Wound);
+		Wounds.MarkItemDirty(Wound);
+	}
+}
+
+void UMOAnatomyComponent::ProcessCondition(FMOCondition& Condition, float DeltaTime)
+{
+	Condition.Duration += DeltaTime;
+
+	// Untreated conditions worsen, treated ones slowly improve
+	Condition.Severity = FMath::Clamp(Condition.Severity + GetConditionSeverityRate(Condition) * DeltaTime, 0.0f, 100.0f);
+
+	// Check for condition progression (e.g., Infection -> Sepsis). Adding a condition
+	// can reallocate the list, so look this one up again afterwards.
+	FMOCondition* Current = &Condition;
+	if (Condition.ConditionType == EMOConditionType::Infection && Condition.Severity >= 80.0f && !HasCondition(EMOConditionType::Sepsis))
+	{
+		const FGuid ConditionId = Condition.ConditionId;
+		AddCondition(EMOConditionType::Sepsis, EMOBodyPartType::None, 20.0f);
+		Current = Conditions.FindConditionById(ConditionId);
+		if (!Current)
+		{
+			return;
+		}
+	}
+
+	// Check for condition resolution
+	if (Current->Severity <= 0.0f)
+	{
+		FGuid RemovedId = Current->ConditionId;
+		EMOConditionType RemovedType = Current->ConditionType;
+		TrackConditionRemoving(*Current);
+		Conditions.RemoveCondition(RemovedId);
+		TrackConditionRemoved(RemovedType);
+		OnConditionRemoved.Broadcast(RemovedId, RemovedType);
+	}
+	else
+	{
+		Conditions.MarkItemDirty(*Current);
+	}
+}
+
+float UMOAnatomyComponent::GetWoundHealRate(const FMOWound& Wound) const
+{
 	float HealRate = 0.001f;  // Base rate per second
 
 	if (Wound.bIsBandaged)
@@ -797,80 +910,452 @@ void UMOAnatomyComponent::ProcessWound(FMOWound& Wound, float DeltaTime)
 		}
 	}
 
-	Wound.HealingProgress = FMath::Min(100.0f, Wound.HealingProgress + HealRate * DeltaTime);
+	return HealRate;
+}
 
-	// Reduce bleed rate as wound heals
-	float HealFactor = 1.0f - (Wound.HealingProgress / 100.0f);
-	// Bleed rate naturally decreases as wound closes
+float UMOAnatomyComponent::GetWoundInfectionGrowthRate(const FMOWound& Wound)
+{
+	const float InfectionGrowth = Wound.bIsBandaged ? 0.5f : 1.0f;  // Bandages slow infection
+	return InfectionGrowth * 0.01f;
+}
 
-	// Check if fully healed
-	if (Wound.HealingProgress >= 100.0f)
+float UMOAnatomyComponent::GetConditionSeverityRate(const FMOCondition& Condition)
+{
+	if (Condition.bIsTreated)
 	{
-		FGuid HealedId = Wound.WoundId;
-		Wounds.RemoveWound(HealedId);
-		OnWoundHealed.Broadcast(HealedId);
+		// Treated conditions slowly improve
+		return -0.05f;
+	}
+
+	// TODO: Get condition definition from DataTable
+	// For now, use basic progression
+	switch (Condition.ConditionType)
+	{
+	case EMOConditionType::Infection:
+		return 0.05f;
+	case EMOConditionType::Sepsis:
+		return 0.2f;  // Fast progression
+	case EMOConditionType::Shock:
+		return 0.15f;
+	default:
+		return 0.1f;  // Per second
+	}
+}
+
+float UMOAnatomyComponent::GetWoundPain(const FMOWound& Wound) const
+{
+	float Pain = 0.0f;
+
+	FMOWoundTypeDefinitionRow WoundDef;
+	if (GetWoundTypeDefinition(Wound.WoundType, WoundDef))
+	{
+		Pain += Wound.Severity * WoundDef.PainMultiplier * 0.3f;
 	}
 	else
 	{
-		Wounds.MarkItemDirty(Wound);
+		Pain += Wound.Severity * 0.3f;
 	}
+
+	// Infected wounds hurt more
+	if (Wound.bIsInfected)
+	{
+		Pain += Wound.InfectionSeverity * 0.2f;
+	}
+
+	return Pain;
 }
 
-void UMOAnatomyComponent::ProcessCondition(FMOCondition& Condition, float DeltaTime)
+void UMOAnatomyComponent::AddWoundContribution(const FMOWound& Wound)
 {
-	Condition.Duration += DeltaTime;
+	RemoveWoundContribution(Wound.WoundId);
 
-	// TODO: Get condition definition from DataTable
-	// For now, use basic progression
+	FWoundContribution Contribution;
+	Contribution.BleedRate = Wound.BleedRate;
+	Contribution.Pain = GetWoundPain(Wound);
+	Contribution.BodyPart = Wound.BodyPart;
+	Contribution.bIsInfected = Wound.bIsInfected;
+
+	Aggregates.TotalBleedRate += Contribution.BleedRate;
+	Aggregates.TotalPain += Contribution.Pain;
+	Aggregates.InfectedWoundCount += Contribution.bIsInfected ? 1 : 0;
+	Aggregates.WoundCountByPart[static_cast<int32>(Contribution.BodyPart)]++;
+
+	WoundContributions.Add(Wound.WoundId, Contribution);
+}
+
+void UMOAnatomyComponent::RemoveWoundContribution(const FGuid& WoundId)
+{
+	FWoundContribution Contribution;
+	if (!WoundContributions.RemoveAndCopyValue(WoundId, Contribution))
+	{
+		return;
+	}
+
+	Aggregates.InfectedWoundCount -= Contribution.bIsInfected ? 1 : 0;
+	Aggregates.WoundCountByPart[static_cast<int32>(Contribution.BodyPart)]--;
+
+	// Snap to zero with the last wound so float drift cannot leave a phantom bleed
+	if (WoundContributions.Num() == 0)
+	{
+		Aggregates.TotalBleedRate = 0.0f;
+		Aggregates.TotalPain = 0.0f;
+	}
+	else
+	{
+		Aggregates.TotalBleedRate = FMath::Max(0.0f, Aggregates.TotalBleedRate - Contribution.BleedRate);
+		Aggregates.TotalPain = FMath::Max(0.0f, Aggregates.TotalPain - Contribution.Pain);
+	}
+}
+
+void UMOAnatomyComponent::AddConditionContribution(const FMOCondition& Condition)
+{
+	Aggregates.ConditionCountByType[static_cast<int32>(Condition.ConditionType)]++;
+}
+
+void UMOAnatomyComponent::RemoveConditionContribution(const FMOCondition& Condition)
+{
+	int32& Count = Aggregates.ConditionCountByType[static_cast<int32>(Condition.ConditionType)];
+	Count = FMath::Max(0, Count - 1);
+}
+
+void UMOAnatomyComponent::ResetAggregates()
+{
+	Aggregates = FAggregates();
+	WoundContributions.Reset();
+}
+
+void UMOAnatomyComponent::TrackWoundAdded(FMOWound& Wound)
+{
+	AddWoundContribution(Wound);
 
-	if (!Condition.bIsTreated)
+	if (bUseEventScheduling)
 	{
-		// Condition worsens if untreated
-		float ProgressionRate = 0.1f;  // Per second
+		const double Now = GetEventTime();
+		Wound.EventSyncTime = Now;
+		ScheduleWoundEvent(Wound, Now);
+	}
+}
 
-		switch (Condition.ConditionType)
+void UMOAnatomyComponent::TrackWoundRemoved(const FMOWound& Wound)
+{
+	RemoveWoundContribution(Wound.WoundId);
+}
+
+void UMOAnatomyComponent::BeginWoundChange(FMOWound& Wound)
+{
+	if (bUseEventScheduling)
+	{
+		SyncWoundState(Wound, GetEventTime());
+	}
+}
+
+void UMOAnatomyComponent::EndWoundChange(FMOWound& Wound)
+{
+	AddWoundContribution(Wound);
+
+	if (bUseEventScheduling)
+	{
+		ScheduleWoundEvent(Wound, GetEventTime());
+	}
+	Wounds.MarkItemDirty(Wound);
+}
+
+void UMOAnatomyComponent::TrackConditionAdded(FMOCondition& Condition)
+{
+	AddConditionContribution(Condition);
+
+	if (bUseEventScheduling)
+	{
+		const double Now = GetEventTime();
+		Condition.EventSyncTime = Now;
+		ScheduleConditionEvent(Condition, Now);
+	}
+}
+
+void UMOAnatomyComponent::TrackConditionRemoving(const FMOCondition& Condition)
+{
+	RemoveConditionContribution(Condition);
+}
+
+void UMOAnatomyComponent::TrackConditionRemoved(EMOConditionType RemovedType)
+{
+	// Sepsis thresholds are only queued while sepsis is absent, so re-arm them
+	if (bUseEventScheduling && RemovedType == EMOConditionType::Sepsis)
+	{
+		ScheduleAllEvents();
+	}
+}
+
+// ============================================================================
+// EVENT SCHEDULING
+// ============================================================================
+
+void UMOAnatomyComponent::ReseedRandomStream()
+{
+	FMOMedicalRandom::InitStream(RandomStream, this);
+}
+
+void UMOAnatomyComponent::HandleIdentityGuidAvailable(const FGuid& StableGuid)
+{
+	ReseedRandomStream();
+}
+
+float UMOAnatomyComponent::SampleTimeToEvent(float RatePerSecond, float UniformSample)
+{
+	if (RatePerSecond <= 0.0f)
+	{
+		return TNumericLimits<float>::Max();
+	}
+
+	// Inverse CDF of the exponential distribution
+	const float U = FMath::Clamp(UniformSample, 0.0f, 1.0f - KINDA_SMALL_NUMBER);
+	return -FMath::Loge(1.0f - U) / RatePerSecond;
+}
+
+float UMOAnatomyComponent::GetNextStageBoundary(float Value, float StageSize, bool bDescending)
+{
+	if (StageSize <= 0.0f)
+	{
+		return bDescending ? 0.0f : 100.0f;
+	}
+
+	// Small bias so a value synced onto a boundary moves on to the next one
+	const float Stage = Value / StageSize;
+	if (bDescending)
+	{
+		return FMath::Max(0.0f, (FMath::CeilToFloat(Stage - 1.0e-3f) - 1.0f) * StageSize);
+	}
+	return FMath::Min(100.0f, (FMath::FloorToFloat(Stage + 1.0e-3f) + 1.0f) * StageSize);
+}
+
+void UMOAnatomyComponent::HandleScheduledEvent(const FGuid& TargetId, bool bIsCondition, uint32 Serial)
+{
+	if (!bUseEventScheduling || GetOwnerRole() != ROLE_Authority)
+	{
+		return;
+	}
+
+	const double Now = GetEventTime();
+
+	if (bIsCondition)
+	{
+		FMOCondition* Condition = Conditions.FindConditionById(TargetId);
+		if (Condition && Condition->EventSerial == Serial)
 		{
-		case EMOConditionType::Infection:
-			ProgressionRate = 0.05f;
-			break;
-		case EMOConditionType::Sepsis:
-			ProgressionRate = 0.2f;  // Fast progression
-			break;
-		case EMOConditionType::Shock:
-			ProgressionRate = 0.15f;
-			break;
-		default:
-			break;
+			ProcessConditionEvent(*Condition, Now);
 		}
-
-		Condition.Severity = FMath::Min(100.0f, Condition.Severity + ProgressionRate * DeltaTime);
 	}
 	else
 	{
-		// Treated conditions slowly improve
-		Condition.Severity = FMath::Max(0.0f, Condition.Severity - 0.05f * DeltaTime);
+		FMOWound* Wound = Wounds.FindWoundById(TargetId);
+		if (Wound && Wound->EventSerial == Serial)
+		{
+			ProcessWoundEvent(*Wound, Now);
+		}
+	}
+}
+
+double UMOAnatomyComponent::GetEventTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+void UMOAnatomyComponent::SyncWoundState(FMOWound& Wound, double Now) const
+{
+	const float Elapsed = static_cast<float>(Now - Wound.EventSyncTime) * TimeScaleMultiplier;
+	Wound.EventSyncTime = Now;
+	if (Elapsed <= 0.0f)
+	{
+		return;
+	}
+
+	// Rates are constant between events, so this matches ticking the same span
+	Wound.TimeSinceInflicted += Elapsed;
+	if (Wound.bIsInfected)
+	{
+		Wound.InfectionSeverity = FMath::Min(100.0f, Wound.InfectionSeverity + GetWoundInfectionGrowthRate(Wound) * Elapsed);
+	}
+	Wound.HealingProgress = FMath::Min(100.0f, Wound.HealingProgress + GetWoundHealRate(Wound) * Elapsed);
+}
+
+void UMOAnatomyComponent::SyncConditionState(FMOCondition& Condition, double Now) const
+{
+	const float Elapsed = static_cast<float>(Now - Condition.EventSyncTime) * TimeScaleMultiplier;
+	Condition.EventSyncTime = Now;
+	if (Elapsed <= 0.0f)
+	{
+		return;
+	}
+
+	Condition.Duration += Elapsed;
+	Condition.Severity = FMath::Clamp(Condition.Severity + GetConditionSeverityRate(Condition) * Elapsed, 0.0f, 100.0f);
+}
+
+void UMOAnatomyComponent::ScheduleWoundEvent(FMOWound& Wound, double Now)
+{
+	++Wound.EventSerial;
+
+	const float TimeScale = FMath::Max(TimeScaleMultiplier, KINDA_SMALL_NUMBER);
+	double NextTime = TNumericLimits<double>::Max();
+
+	// Infection onset. The hazard matches the per-tick roll (InfectionRisk * 0.001 per
+	// second) and is memoryless, so resampling on every reschedule is unbiased.
+	Wound.InfectionOnsetTime = -1.0;
+	if (!Wound.bIsInfected && Wound.InfectionRisk > 0.0f)
+	{
+		Wound.InfectionOnsetTime = Now + SampleTimeToEvent(Wound.InfectionRisk * 0.001f, RandomStream.FRand()) / TimeScale;
+		NextTime = FMath::Min(NextTime, Wound.InfectionOnsetTime);
 	}
 
-	// Check for condition progression (e.g., Infection -> Sepsis)
-	if (Condition.ConditionType == EMOConditionType::Infection && Condition.Severity >= 80.0f)
+	// Infection stages, including the sepsis threshold
+	if (Wound.bIsInfected && Wound.InfectionSeverity < 100.0f)
 	{
+		float Target = GetNextStageBoundary(Wound.InfectionSeverity, EventStageSize, false);
 		if (!HasCondition(EMOConditionType::Sepsis))
 		{
-			AddCondition(EMOConditionType::Sepsis, EMOBodyPartType::None, 20.0f);
+			Target = (Wound.InfectionSeverity >= 80.0f) ? Wound.InfectionSeverity : FMath::Min(Target, 80.0f);
+		}
+		NextTime = FMath::Min(NextTime, Now + (Target - Wound.InfectionSeverity) / GetWoundInfectionGrowthRate(Wound) / TimeScale);
+	}
+
+	// Healing stages; the last one removes the wound, which is also when it stops bleeding
+	const float HealRate = GetWoundHealRate(Wound);
+	if (HealRate > 0.0f && Wound.HealingProgress < 100.0f)
+	{
+		const float Target = GetNextStageBoundary(Wound.HealingProgress, EventStageSize, false);
+		NextTime = FMath::Min(NextTime, Now + (Target - Wound.HealingProgress) / HealRate / TimeScale);
+	}
+
+	if (NextTime < TNumericLimits<double>::Max())
+	{
+		if (UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this))
+		{
+			Scheduler->ScheduleMedicalEvent(this, Wound.WoundId, false, Wound.EventSerial, NextTime);
+		}
+	}
+}
+
+void UMOAnatomyComponent::ScheduleConditionEvent(FMOCondition& Condition, double Now)
+{
+	++Condition.EventSerial;
+
+	const float Rate = GetConditionSeverityRate(Condition);
+	float Target = Condition.Severity;
+
+	if (Rate > 0.0f)
+	{
+		if (Condition.Severity >= 100.0f)
+		{
+			return;
+		}
+
+		Target = GetNextStageBoundary(Condition.Severity, EventStageSize, false);
+		if (Condition.ConditionType == EMOConditionType::Infection && !HasCondition(EMOConditionType::Sepsis))
+		{
+			Target = (Condition.Severity >= 80.0f) ? Condition.Severity : FMath::Min(Target, 80.0f);
 		}
 	}
+	else if (Rate < 0.0f)
+	{
+		Target = GetNextStageBoundary(Condition.Severity, EventStageSize, true);
+	}
+	else
+	{
+		return;
+	}
+
+	const float TimeScale = FMath::Max(TimeScaleMultiplier, KINDA_SMALL_NUMBER);
+	const double NextTime = Now + FMath::Abs(Target - Condition.Severity) / FMath::Abs(Rate) / TimeScale;
+
+	if (UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this))
+	{
+		Scheduler->ScheduleMedicalEvent(this, Condition.ConditionId, true, Condition.EventSerial, NextTime);
+	}
+}
+
+void UMOAnatomyComponent::ScheduleAllEvents()
+{
+	const double Now = GetEventTime();
+
+	for (FMOWound& Wound : Wounds.Wounds)
+	{
+		SyncWoundState(Wound, Now);
+		AddWoundContribution(Wound);
+		ScheduleWoundEvent(Wound, Now);
+		Wounds.MarkItemDirty(Wound);
+	}
+
+	for (FMOCondition& Condition : Conditions.Conditions)
+	{
+		SyncConditionState(Condition, Now);
+		ScheduleConditionEvent(Condition, Now);
+		Conditions.MarkItemDirty(Condition);
+	}
+}
+
+void UMOAnatomyComponent::ProcessWoundEvent(FMOWound& Wound, double Now)
+{
+	SyncWoundState(Wound, Now);
+
+	// Infection onset
+	if (!Wound.bIsInfected && Wound.InfectionOnsetTime >= 0.0 && Now >= Wound.InfectionOnsetTime)
+	{
+		Wound.bIsInfected = true;
+		Wound.InfectionSeverity = 10.0f;
+	}
+
+	// Severe infection can become systemic
+	if (Wound.bIsInfected && Wound.InfectionSeverity >= 80.0f && !HasCondition(EMOConditionType::Sepsis))
+	{
+		AddCondition(EMOConditionType::Sepsis, EMOBodyPartType::None, 20.0f);
+	}
+
+	// Check if fully healed
+	if (Wound.HealingProgress >= 100.0f)
+	{
+		FGuid HealedId = Wound.WoundId;
+		TrackWoundRemoved(Wound);
+		Wounds.RemoveWound(HealedId);
+		OnWoundHealed.Broadcast(HealedId);
+		return;
+	}
+
+	AddWoundContribution(Wound);
+	ScheduleWoundEvent(Wound, Now);
+	Wounds.MarkItemDirty(Wound);
+}
+
+void UMOAnatomyComponent::ProcessConditionEvent(FMOCondition& Condition, double Now)
+{
+	SyncConditionState(Condition, Now);
 
 	// Check for condition resolution
 	if (Condition.Severity <= 0.0f)
 	{
 		FGuid RemovedId = Condition.ConditionId;
 		EMOConditionType RemovedType = Condition.ConditionType;
+		TrackConditionRemoving(Condition);
 		Conditions.RemoveCondition(RemovedId);
+		TrackConditionRemoved(RemovedType);
 		OnConditionRemoved.Broadcast(RemovedId, RemovedType);
+		return;
 	}
-	else
+
+	// Check for condition progression (e.g., Infection -> Sepsis). Adding a condition
+	// can reallocate the list, so look this one up again afterwards.
+	FMOCondition* Current = &Condition;
+	if (Condition.ConditionType == EMOConditionType::Infection && Condition.Severity >= 80.0f && !HasCondition(EMOConditionType::Sepsis))
 	{
-		Conditions.MarkItemDirty(Condition);
+		const FGuid ConditionId = Condition.ConditionId;
+		AddCondition(EMOConditionType::Sepsis, EMOBodyPartType::None, 20.0f);
+		Current = Conditions.FindConditionById(ConditionId);
+	}
+
+	if (Current)
+	{
+		ScheduleConditionEvent(*Current, Now);
+		Conditions.MarkItemDirty(*Current);
 	}
 }
 
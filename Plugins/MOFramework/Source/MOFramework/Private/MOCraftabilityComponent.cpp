@@ -0,0 +1,348 @@
+#include "MOCraftabilityComponent.h"
+#include "MOFramework.h"
+
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+#include "MOCraftingSubsystem.h"
+#include "MOInventoryComponent.h"
+#include "MOKnowledgeComponent.h"
+#include "MORecipeDatabaseSettings.h"
+#include "MOSkillsComponent.h"
+
+UMOCraftabilityComponent::UMOCraftabilityComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UMOCraftabilityComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	RecipeIndexResetHandle = UMORecipeDatabaseSettings::OnRecipeIndexReset().AddUObject(this, &UMOCraftabilityComponent::HandleRecipeIndexReset);
+
+	if (Inventory.IsValid() || Skills.IsValid() || Knowledge.IsValid())
+	{
+		// BindComponents ran before play; its refresh had no world to evaluate against.
+		RefreshAll();
+		return;
+	}
+
+	AActor* Owner = GetOwner();
+	BindComponents(
+		Owner ? Owner->FindComponentByClass<UMOInventoryComponent>() : nullptr,
+		Owner ? Owner->FindComponentByClass<UMOSkillsComponent>() : nullptr,
+		Owner ? Owner->FindComponentByClass<UMOKnowledgeComponent>() : nullptr);
+}
+
+void UMOCraftabilityComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	UnbindComponents();
+
+	UMORecipeDatabaseSettings::OnRecipeIndexReset().Remove(RecipeIndexResetHandle);
+	RecipeIndexResetHandle.Reset();
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UMOCraftabilityComponent::SetStation(EMOCraftingStation NewStation)
+{
+	if (Station == NewStation)
+	{
+		return;
+	}
+
+	Station = NewStation;
+	if (HasBegunPlay())
+	{
+		RefreshAll();
+	}
+}
+
+void UMOCraftabilityComponent::BindComponents(UMOInventoryComponent* InInventory, UMOSkillsComponent* InSkills, UMOKnowledgeComponent* InKnowledge)
+{
+	UnbindComponents();
+
+	Inventory = InInventory;
+	Skills = InSkills;
+	Knowledge = InKnowledge;
+
+	if (IsValid(InInventory))
+	{
+		InInventory->OnItemTotalsChanged.AddUniqueDynamic(this, &UMOCraftabilityComponent::HandleItemTotalsChanged);
+	}
+	if (IsValid(InSkills))
+	{
+		InSkills->OnSkillLevelUp.AddUniqueDynamic(this, &UMOCraftabilityComponent::HandleSkillLevelUp);
+	}
+	if (IsValid(InKnowledge))
+	{
+		InKnowledge->OnKnowledgeLearned.AddUniqueDynamic(this, &UMOCraftabilityComponent::HandleKnowledgeLearned);
+		InKnowledge->OnItemInspected.AddUniqueDynamic(this, &UMOCraftabilityComponent::HandleItemInspected);
+	}
+
+	if (HasBegunPlay())
+	{
+		RefreshAll();
+	}
+}
+
+void UMOCraftabilityComponent::UnbindComponents()
+{
+	if (UMOInventoryComponent* OldInventory = Inventory.Get())
+	{
+		OldInventory->OnItemTotalsChanged.RemoveDynamic(this, &UMOCraftabilityComponent::HandleItemTotalsChanged);
+	}
+	if (UMOSkillsComponent* OldSkills = Skills.Get())
+	{
+		OldSkills->OnSkillLevelUp.RemoveDynamic(this, &UMOCraftabilityComponent::HandleSkillLevelUp);
+	}
+	if (UMOKnowledgeComponent* OldKnowledge = Knowledge.Get())
+	{
+		OldKnowledge->OnKnowledgeLearned.RemoveDynamic(this, &UMOCraftabilityComponent::HandleKnowledgeLearned);
+		OldKnowledge->OnItemInspected.RemoveDynamic(this, &UMOCraftabilityComponent::HandleItemInspected);
+	}
+
+	Inventory.Reset();
+	Skills.Reset();
+	Knowledge.Reset();
+}
+
+/*
+ * Queries
+ */
+
+bool UMOCraftabilityComponent::IsRecipeCraftable(FName RecipeId) const
+{
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+	if (!IsTracking(Index))
+	{
+		return false;
+	}
+
+	const int32* Position = Index.PositionById.Find(RecipeId);
+	return Position && Craftable[*Position];
+}
+
+void UMOCraftabilityComponent::GetCraftableRecipes(TArray<FName>& OutRecipeIds) const
+{
+	OutRecipeIds.Reset();
+
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+	if (!IsTracking(Index))
+	{
+		return;
+	}
+
+	OutRecipeIds.Reserve(CraftableCount);
+	for (TConstSetBitIterator<> It(Craftable); It; ++It)
+	{
+		OutRecipeIds.Add(Index.Ids[It.GetIndex()]);
+	}
+}
+
+/*
+ * Evaluation
+ */
+
+void UMOCraftabilityComponent::RefreshAll()
+{
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+
+	if (!CraftingSubsystem.IsValid())
+	{
+		if (UWorld* World = GetWorld())
+		{
+			CraftingSubsystem = World->GetSubsystem<UMOCraftingSubsystem>();
+		}
+	}
+
+	// Compare by name: after an index reset the old positions mean nothing.
+	TSet<FName> WasCraftable;
+	if (bIndexWasReset)
+	{
+		WasCraftable.Append(CraftableBeforeIndexReset);
+	}
+	else
+	{
+		TArray<FName> PreviousIds;
+		GetCraftableRecipes(PreviousIds);
+		WasCraftable.Append(PreviousIds);
+	}
+
+	bIndexWasReset = false;
+	CraftableBeforeIndexReset.Reset();
+
+	InStation.Init(false, Index.Rows.Num());
+	Craftable.Init(false, Index.Rows.Num());
+	CraftableCount = 0;
+
+	TArray<int32> StationPositions;
+	Index.GetStationPositions(Station, StationPositions);
+
+	TArray<FName> Gained;
+	for (const int32 Position : StationPositions)
+	{
+		InStation[Position] = true;
+		if (!EvaluatePosition(Index, Position))
+		{
+			continue;
+		}
+
+		Craftable[Position] = true;
+		++CraftableCount;
+		if (!WasCraftable.Remove(Index.Ids[Position]))
+		{
+			Gained.Add(Index.Ids[Position]);
+		}
+	}
+
+	BroadcastChanges(Gained, WasCraftable.Array());
+}
+
+void UMOCraftabilityComponent::ReevaluatePositions(TArray<int32>& Positions)
+{
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+	if (Positions.Num() == 0 || !IsTracking(Index))
+	{
+		// Not tracking yet, or a full refresh is already scheduled.
+		return;
+	}
+
+	// Several changed inputs can feed one recipe; sorting visits it once and keeps events in DataTable order.
+	Positions.Sort();
+
+	TArray<FName> Gained;
+	TArray<FName> Lost;
+	int32 PreviousPosition = INDEX_NONE;
+	for (const int32 Position : Positions)
+	{
+		if (Position == PreviousPosition || !InStation[Position])
+		{
+			PreviousPosition = Position;
+			continue;
+		}
+		PreviousPosition = Position;
+
+		const bool bNowCraftable = EvaluatePosition(Index, Position);
+		if (bNowCraftable == Craftable[Position])
+		{
+			continue;
+		}
+
+		Craftable[Position] = bNowCraftable;
+		if (bNowCraftable)
+		{
+			++CraftableCount;
+			Gained.Add(Index.Ids[Position]);
+		}
+		else
+		{
+			--CraftableCount;
+			Lost.Add(Index.Ids[Position]);
+		}
+	}
+
+	BroadcastChanges(Gained, Lost);
+}
+
+bool UMOCraftabilityComponent::EvaluatePosition(const FMORecipeIndex& Index, int32 Position) const
+{
+	const UMOCraftingSubsystem* Subsystem = CraftingSubsystem.Get();
+	return Subsystem && Subsystem->IsRecipeRowCraftable(Index.Rows[Position], Knowledge.Get(), Skills.Get(), Inventory.Get());
+}
+
+void UMOCraftabilityComponent::BroadcastChanges(const TArray<FName>& Gained, const TArray<FName>& Lost)
+{
+	// State is fully updated before any listener runs, so handlers may query freely.
+	for (const FName RecipeId : Lost)
+	{
+		OnRecipeNoLongerCraftable.Broadcast(RecipeId);
+	}
+	for (const FName RecipeId : Gained)
+	{
+		OnRecipeBecameCraftable.Broadcast(RecipeId);
+	}
+}
+
+/*
+ * Deltas
+ */
+
+void UMOCraftabilityComponent::HandleItemTotalsChanged(const TArray<FName>& ItemDefinitionIds)
+{
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+
+	TArray<int32> Positions;
+	for (const FName ItemDefinitionId : ItemDefinitionIds)
+	{
+		if (const TArray<int32>* Consumers = Index.ByIngredient.Find(ItemDefinitionId))
+		{
+			Positions.Append(*Consumers);
+		}
+	}
+
+	ReevaluatePositions(Positions);
+}
+
+void UMOCraftabilityComponent::HandleSkillLevelUp(FName SkillId, int32 /*OldLevel*/, int32 /*NewLevel*/)
+{
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+	if (const TArray<int32>* Governed = Index.BySkill.Find(SkillId))
+	{
+		TArray<int32> Positions = *Governed;
+		ReevaluatePositions(Positions);
+	}
+}
+
+void UMOCraftabilityComponent::HandleKnowledgeLearned(FName KnowledgeId, FName /*FromItemId*/)
+{
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+	if (const TArray<int32>* Unlocks = Index.ByKnowledge.Find(KnowledgeId))
+	{
+		TArray<int32> Positions = *Unlocks;
+		ReevaluatePositions(Positions);
+	}
+}
+
+void UMOCraftabilityComponent::HandleItemInspected(FName ItemDefinitionId, const FMOInspectionResult& /*Result*/)
+{
+	// Inspecting an item can satisfy bRequiresKnowledge on ingredients of that type.
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+	if (const TArray<int32>* Consumers = Index.ByIngredient.Find(ItemDefinitionId))
+	{
+		TArray<int32> Positions = *Consumers;
+		ReevaluatePositions(Positions);
+	}
+}
+
+void UMOCraftabilityComponent::HandleRecipeIndexReset(const FMORecipeIndex& OldIndex)
+{
+	// The index is about to drop its positions; keep the names and rebuild once the table has settled.
+	if (!bIndexWasReset)
+	{
+		CraftableBeforeIndexReset.Reset();
+		if (IsTracking(OldIndex))
+		{
+			for (TConstSetBitIterator<> It(Craftable); It; ++It)
+			{
+				CraftableBeforeIndexReset.Add(OldIndex.Ids[It.GetIndex()]);
+			}
+		}
+		bIndexWasReset = true;
+
+		if (UWorld* World = GetWorld())
+		{
+			World->GetTimerManager().SetTimerForNextTick(this, &UMOCraftabilityComponent::RefreshAll);
+		}
+	}
+
+	InStation.Reset();
+	Craftable.Reset();
+	CraftableCount = 0;
+}
@@ -1,10 +1,14 @@
 #include "MOCraftingQueueComponent.h"
 #include "MOFramework.h"
 #include "MOCraftingSubsystem.h"
+#include "MOCraftingSchedulerSubsystem.h"
 #include "MOInventoryComponent.h"
+#include "MOKnowledgeComponent.h"
+#include "MOSkillsComponent.h"
 #include "MORecipeDiscoveryComponent.h"
 #include "MORecipeDatabaseSettings.h"
 #include "MOItemDatabaseSettings.h"
+#include "MOSimulationClockSubsystem.h"
 #include "Net/UnrealNetwork.h"
 #include "GameFramework/Pawn.h"
 
@@ -30,6 +34,11 @@ void UMOCraftingQueueComponent::EndPlay(const EEndPlayReason::Type EndPlayReason
 		PauseCrafting();
 	}
 
+	if (UMOCraftingSchedulerSubsystem* Scheduler = CachedScheduler.Get())
+	{
+		Scheduler->UnregisterWorker(this);
+	}
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -37,9 +46,11 @@ void UMOCraftingQueueComponent::TickComponent(float DeltaTime, ELevelTick TickTy
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (bIsCraftingActive && !IsQueueEmpty())
+	// Only enabled when no scheduler exists for this world; mirrors its wakes.
+	const double Now = GetSimTime();
+	if (Now >= NextWakeTime)
 	{
-		ProcessCraftingTick(DeltaTime);
+		HandleSchedulerWake(Now);
 	}
 }
 
@@ -63,6 +74,8 @@ void UMOCraftingQueueComponent::CacheComponents()
 	{
 		CachedCraftingSubsystem = World->GetSubsystem<UMOCraftingSubsystem>();
 	}
+
+	CachedScheduler = UMOCraftingSchedulerSubsystem::Get(this);
 }
 
 // =============================================================================
@@ -99,18 +112,7 @@ bool UMOCraftingQueueComponent::EnqueueCraft(FName RecipeId, int32 Count, EMOCra
 	}
 
 	// Create queue entry
-	FMOCraftingQueueEntry NewEntry;
-	NewEntry.EntryId = FGuid::NewGuid();
-	NewEntry.RecipeId = RecipeId;
-	NewEntry.Count = Count;
-	NewEntry.CompletedCount = 0;
-	NewEntry.Progress = 0.0f;
-	NewEntry.Station = Station;
-	NewEntry.bIngredientsConsumed = true;
-	NewEntry.StartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
-
-	Queue.Entries.Add(NewEntry);
-	Queue.MarkArrayDirty();
+	const FMOCraftingQueueEntry& NewEntry = AddQueueEntry(RecipeId, Count, Station, true);
 
 	UE_LOG(LogMOFramework, Log, TEXT("[MOCraftingQueue] Enqueued %dx %s (EntryId: %s)"),
 		Count, *RecipeId.ToString(), *NewEntry.EntryId.ToString(EGuidFormats::DigitsWithHyphens));
@@ -126,6 +128,109 @@ bool UMOCraftingQueueComponent::EnqueueCraft(FName RecipeId, int32 Count, EMOCra
 	return true;
 }
 
+bool UMOCraftingQueueComponent::EnqueueCraftPlan(FName ItemDefinitionId, int32 Quantity, EMOCraftingStation Station, FMOCraftingPlan& OutPlan)
+{
+	OutPlan = FMOCraftingPlan();
+
+	if (!CachedCraftingSubsystem.IsValid() || !CachedInventory.IsValid())
+	{
+		CacheComponents();
+	}
+
+	UMOCraftingSubsystem* CraftingSub = CachedCraftingSubsystem.Get();
+	if (!CraftingSub)
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingQueue] No crafting subsystem to plan with"));
+		return false;
+	}
+
+	// Plan only with recipes the owner could queue by hand.
+	AActor* Owner = GetOwner();
+	UMOKnowledgeComponent* Knowledge = Owner ? Owner->FindComponentByClass<UMOKnowledgeComponent>() : nullptr;
+	UMOSkillsComponent* Skills = Owner ? Owner->FindComponentByClass<UMOSkillsComponent>() : nullptr;
+
+	if (!CraftingSub->PlanCraft(ItemDefinitionId, Quantity, Knowledge, Skills, CachedInventory.Get(), Station, OutPlan))
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingQueue] Cannot plan %dx %s (%d materials missing)"),
+			Quantity, *ItemDefinitionId.ToString(), OutPlan.MissingMaterials.Num());
+		return false;
+	}
+
+	// All or nothing: a partial plan would strand intermediates.
+	if (MaxQueueSize > 0 && Queue.Entries.Num() + OutPlan.Steps.Num() > MaxQueueSize)
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingQueue] Plan for %s needs %d entries, queue has room for %d"),
+			*ItemDefinitionId.ToString(), OutPlan.Steps.Num(), MaxQueueSize - Queue.Entries.Num());
+		return false;
+	}
+
+	const bool bWasEmpty = IsQueueEmpty();
+	OutPlan.PlanId = FGuid::NewGuid();
+	for (const FMOCraftingPlanStep& Step : OutPlan.Steps)
+	{
+		const FMOCraftingQueueEntry& NewEntry = AddQueueEntry(Step.RecipeId, Step.Count, Station, false);
+		EntryPlanIds.Add(NewEntry.EntryId, OutPlan.PlanId);
+	}
+
+	UE_LOG(LogMOFramework, Log, TEXT("[MOCraftingQueue] Enqueued plan for %dx %s: %d steps"),
+		Quantity, *ItemDefinitionId.ToString(), OutPlan.Steps.Num());
+
+	OnQueueChanged.Broadcast();
+
+	if (bWasEmpty && bAllowBackgroundCrafting && !bIsCraftingActive)
+	{
+		StartCrafting();
+	}
+
+	return true;
+}
+
+bool UMOCraftingQueueComponent::EnqueueStationJob(FName RecipeId, int32 Count, EMOCraftingStation Station, UMOInventoryComponent* MaterialInventory)
+{
+	if (RecipeId.IsNone() || Count <= 0 || !IsValid(MaterialInventory))
+	{
+		return false;
+	}
+
+	if (MaxQueueSize > 0 && Queue.Entries.Num() >= MaxQueueSize)
+	{
+		return false;
+	}
+
+	// Several workers share one material inventory, so nothing is reserved upfront.
+	const bool bWasEmpty = IsQueueEmpty();
+	const FMOCraftingQueueEntry& NewEntry = AddQueueEntry(RecipeId, Count, Station, false);
+	EntryInventories.Add(NewEntry.EntryId, MaterialInventory);
+
+	UE_LOG(LogMOFramework, Log, TEXT("[MOCraftingQueue] Enqueued station job %dx %s from %s"),
+		Count, *RecipeId.ToString(), *GetNameSafe(MaterialInventory->GetOwner()));
+
+	OnQueueChanged.Broadcast();
+
+	if (bWasEmpty && !bIsCraftingActive)
+	{
+		StartCrafting();
+	}
+
+	return true;
+}
+
+FMOCraftingQueueEntry& UMOCraftingQueueComponent::AddQueueEntry(FName RecipeId, int32 Count, EMOCraftingStation Station, bool bIngredientsConsumed)
+{
+	FMOCraftingQueueEntry& NewEntry = Queue.Entries.AddDefaulted_GetRef();
+	NewEntry.EntryId = FGuid::NewGuid();
+	NewEntry.RecipeId = RecipeId;
+	NewEntry.Count = Count;
+	NewEntry.CompletedCount = 0;
+	NewEntry.Progress = 0.0f;
+	NewEntry.Station = Station;
+	NewEntry.bIngredientsConsumed = bIngredientsConsumed;
+	NewEntry.StartTime = GetSimTime();
+
+	Queue.MarkArrayDirty();
+	return NewEntry;
+}
+
 bool UMOCraftingQueueComponent::CancelCraft(const FGuid& EntryId, bool bRefundIngredients)
 {
 	for (int32 i = 0; i < Queue.Entries.Num(); ++i)
@@ -148,6 +253,8 @@ bool UMOCraftingQueueComponent::CancelCraft(const FGuid& EntryId, bool bRefundIn
 			FGuid CancelledId = Entry.EntryId;
 			Queue.Entries.RemoveAt(i);
 			Queue.MarkArrayDirty();
+			EntryInventories.Remove(CancelledId);
+			EntryPlanIds.Remove(CancelledId);
 
 			UE_LOG(LogMOFramework, Log, TEXT("[MOCraftingQueue] Cancelled craft: %s (refunded: %s)"),
 				*CancelledId.ToString(EGuidFormats::DigitsWithHyphens), bRefundIngredients ? TEXT("yes") : TEXT("no"));
@@ -155,18 +262,29 @@ bool UMOCraftingQueueComponent::CancelCraft(const FGuid& EntryId, bool bRefundIn
 			OnCraftCancelled.Broadcast(CancelledId, bRefundIngredients);
 			OnQueueChanged.Broadcast();
 
-			// If we cancelled the active craft, reset start time for next
+			// If we cancelled the active craft, the next one starts now
 			if (i == 0 && !IsQueueEmpty())
 			{
-				CurrentCraftStartTime = FDateTime::UtcNow();
+				const double Now = GetSimTime();
 				Queue.Entries[0].Progress = 0.0f;
-				Queue.Entries[0].StartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0f;
+				Queue.Entries[0].StartTime = Now;
+
+				if (bIsCraftingActive)
+				{
+					LastAdvanceTime = Now;
+					ScheduleNextWake();
+				}
 			}
 
-			// Stop ticking if queue is now empty
+			// Stop crafting if queue is now empty
 			if (IsQueueEmpty())
 			{
 				PauseCrafting();
+
+				if (UMOCraftingSchedulerSubsystem* Scheduler = CachedScheduler.Get())
+				{
+					Scheduler->NotifyWorkerIdle(this);
+				}
 			}
 
 			return true;
@@ -216,12 +334,23 @@ bool UMOCraftingQueueComponent::ReorderQueueEntry(const FGuid& EntryId, int32 Ne
 	// Clamp new index
 	NewIndex = FMath::Clamp(NewIndex, 0, Queue.Entries.Num() - 1);
 
+	// Moving the active craft back keeps its progress for when it reaches the front again
+	if (bIsCraftingActive)
+	{
+		AdvanceToTime(GetSimTime());
+	}
+
 	// Move the entry
 	FMOCraftingQueueEntry Entry = Queue.Entries[CurrentIndex];
 	Queue.Entries.RemoveAt(CurrentIndex);
 	Queue.Entries.Insert(Entry, NewIndex);
 	Queue.MarkArrayDirty();
 
+	if (bIsCraftingActive)
+	{
+		ScheduleNextWake();
+	}
+
 	OnQueueChanged.Broadcast();
 	return true;
 }
@@ -237,11 +366,17 @@ bool UMOCraftingQueueComponent::StartCrafting()
 		return false;
 	}
 
-	bIsCraftingActive = true;
-	CurrentCraftStartTime = FDateTime::UtcNow();
+	if (bIsCraftingActive)
+	{
+		return true;
+	}
 
-	// Enable ticking
-	SetComponentTickEnabled(true);
+	const double Now = GetSimTime();
+	bIsCraftingActive = true;
+	bAdvancingTime = true;
+	LastAdvanceTime = Now;
+	LastProgressUpdateTime = Now;
+	ScheduleNextWake();
 
 	UE_LOG(LogMOFramework, Log, TEXT("[MOCraftingQueue] Crafting started"));
 
@@ -255,10 +390,20 @@ void UMOCraftingQueueComponent::PauseCrafting()
 		return;
 	}
 
-	bIsCraftingActive = false;
+	AdvanceToTime(GetSimTime());
+	if (!bIsCraftingActive)
+	{
+		// Advancing emptied the queue, which already paused
+		return;
+	}
 
-	// Disable ticking
-	SetComponentTickEnabled(false);
+	bIsCraftingActive = false;
+	bAdvancingTime = false;
+	if (!IsQueueEmpty())
+	{
+		Queue.MarkItemDirty(Queue.Entries[0]);
+	}
+	ScheduleNextWake();
 
 	UE_LOG(LogMOFramework, Log, TEXT("[MOCraftingQueue] Crafting paused"));
 }
@@ -328,9 +473,7 @@ float UMOCraftingQueueComponent::GetCurrentCraftTimeRemaining() const
 		return 0.0f;
 	}
 
-	const FMOCraftingQueueEntry& Entry = Queue.Entries[0];
-	float CraftDuration = GetEffectiveCraftDuration(Entry.RecipeId);
-	return CraftDuration * (1.0f - Entry.Progress);
+	return GetCurrentCraftDuration() * (1.0f - GetCurrentCraftProgress()) / FMath::Max(TimeScaleMultiplier, 0.01f);
 }
 
 float UMOCraftingQueueComponent::GetCurrentCraftProgress() const
@@ -340,6 +483,12 @@ float UMOCraftingQueueComponent::GetCurrentCraftProgress() const
 		return 0.0f;
 	}
 
+	// Between replicated updates the server knows the exact value; clients see the last update
+	if (bAdvancingTime)
+	{
+		return CalculateProgressFromTime(GetSimTime());
+	}
+
 	return Queue.Entries[0].Progress;
 }
 
@@ -350,6 +499,10 @@ float UMOCraftingQueueComponent::GetCurrentCraftProgress() const
 void UMOCraftingQueueComponent::BuildSaveData(FMOCraftingQueueSaveData& OutSaveData) const
 {
 	OutSaveData.QueuedCrafts = Queue.Entries;
+	if (OutSaveData.QueuedCrafts.Num() > 0)
+	{
+		OutSaveData.QueuedCrafts[0].Progress = GetCurrentCraftProgress();
+	}
 	OutSaveData.PausedAt = FDateTime::UtcNow();
 	OutSaveData.bWasActive = bIsCraftingActive;
 
@@ -363,8 +516,34 @@ void UMOCraftingQueueComponent::BuildSaveData(FMOCraftingQueueSaveData& OutSaveD
 bool UMOCraftingQueueComponent::ApplySaveData(const FMOCraftingQueueSaveData& InSaveData, bool bCalculateOfflineProgress)
 {
 	// Clear current queue
+	PauseCrafting();
 	Queue.Entries = InSaveData.QueuedCrafts;
 	Queue.MarkArrayDirty();
+	EntryInventories.Reset();
+	EntryPlanIds.Reset();
+
+	// Plan steps rejoin their plan; ids for entries that did not load are dropped
+	for (const FMOCraftingQueueEntry& Entry : Queue.Entries)
+	{
+		FGuid PlanId;
+		if (RestoredEntryPlanIds.RemoveAndCopyValue(Entry.EntryId, PlanId))
+		{
+			EntryPlanIds.Add(Entry.EntryId, PlanId);
+		}
+	}
+	RestoredEntryPlanIds.Reset();
+
+	// Station entries get their material inventory back from the scheduler's save data
+	if (UMOCraftingSchedulerSubsystem* Scheduler = UMOCraftingSchedulerSubsystem::Get(this))
+	{
+		for (const FMOCraftingQueueEntry& Entry : Queue.Entries)
+		{
+			if (UMOInventoryComponent* MaterialInventory = Scheduler->TakeRestoredEntryInventory(Entry.EntryId))
+			{
+				EntryInventories.Add(Entry.EntryId, MaterialInventory);
+			}
+		}
+	}
 
 	if (bCalculateOfflineProgress && InSaveData.bWasActive && Queue.Entries.Num() > 0)
 	{
@@ -380,7 +559,10 @@ bool UMOCraftingQueueComponent::ApplySaveData(const FMOCraftingQueueSaveData& In
 		if (ElapsedSeconds > 0.0f)
 		{
 			UE_LOG(LogMOFramework, Log, TEXT("[MOCraftingQueue] Applying %.1f seconds of offline progress"), ElapsedSeconds);
-			AdvanceQueueByTime(ElapsedSeconds);
+
+			// Same path as live wakes; offline wall time runs at the clock's current scale
+			AdvanceQueueByTime(ElapsedSeconds * GetClockTimeScale());
+			Queue.MarkArrayDirty();
 		}
 
 		// Resume crafting if it was active
@@ -398,12 +580,36 @@ bool UMOCraftingQueueComponent::ApplySaveData(const FMOCraftingQueueSaveData& In
 	return true;
 }
 
+void UMOCraftingQueueComponent::BuildPlanSaveData(FMOCraftingQueuePlanSaveData& OutSaveData) const
+{
+	OutSaveData.PlanEntries.Reset(EntryPlanIds.Num());
+	for (const TPair<FGuid, FGuid>& EntryPlan : EntryPlanIds)
+	{
+		FMOCraftingPlanEntrySaveData& EntryData = OutSaveData.PlanEntries.AddDefaulted_GetRef();
+		EntryData.EntryId = EntryPlan.Key;
+		EntryData.PlanId = EntryPlan.Value;
+	}
+}
+
+void UMOCraftingQueueComponent::ApplyPlanSaveData(const FMOCraftingQueuePlanSaveData& InSaveData)
+{
+	RestoredEntryPlanIds.Reset();
+	for (const FMOCraftingPlanEntrySaveData& EntryData : InSaveData.PlanEntries)
+	{
+		if (EntryData.EntryId.IsValid() && EntryData.PlanId.IsValid())
+		{
+			RestoredEntryPlanIds.Add(EntryData.EntryId, EntryData.PlanId);
+		}
+	}
+}
+
 void UMOCraftingQueueComponent::ClearQueue()
 {
 	Queue.Entries.Empty();
 	Queue.MarkArrayDirty();
-	bIsCraftingActive = false;
-	SetComponentTickEnabled(false);
+	EntryInventories.Reset();
+	EntryPlanIds.Reset();
+	PauseCrafting();
 	OnQueueChanged.Broadcast();
 }
 
@@ -411,46 +617,110 @@ void UMOCraftingQueueComponent::ClearQueue()
 // Internal Methods
 // =============================================================================
 
-void UMOCraftingQueueComponent::ProcessCraftingTick(float DeltaTime)
+void UMOCraftingQueueComponent::HandleSchedulerWake(double Now)
 {
-	if (Queue.Entries.Num() == 0)
+	AdvanceToTime(Now);
+
+	if (bIsCraftingActive && !IsQueueEmpty() && Now >= LastProgressUpdateTime + ProgressUpdateInterval * GetClockTimeScale())
+	{
+		PublishProgress(Now);
+	}
+
+	ScheduleNextWake();
+}
+
+void UMOCraftingQueueComponent::AdvanceToTime(double Now)
+{
+	if (!bAdvancingTime)
 	{
-		PauseCrafting();
 		return;
 	}
 
-	FMOCraftingQueueEntry& CurrentEntry = Queue.Entries[0];
-	float CraftDuration = GetEffectiveCraftDuration(CurrentEntry.RecipeId);
+	const double ElapsedSeconds = Now - LastAdvanceTime;
+	LastAdvanceTime = Now;
+	AdvanceQueueByTime(ElapsedSeconds);
+}
 
-	if (CraftDuration <= 0.0f)
+void UMOCraftingQueueComponent::PublishProgress(double Now)
+{
+	FMOCraftingQueueEntry& Entry = Queue.Entries[0];
+	Queue.MarkItemDirty(Entry);
+	LastProgressUpdateTime = Now;
+
+	OnCraftProgress.Broadcast(Entry.EntryId, Entry.Progress);
+}
+
+void UMOCraftingQueueComponent::ScheduleNextWake()
+{
+	if (!CachedScheduler.IsValid())
 	{
-		// Instant craft
-		CompletCurrentCraft();
+		CachedScheduler = UMOCraftingSchedulerSubsystem::Get(this);
+	}
+	UMOCraftingSchedulerSubsystem* Scheduler = CachedScheduler.Get();
+
+	if (!bIsCraftingActive || IsQueueEmpty())
+	{
+		if (Scheduler)
+		{
+			Scheduler->UnscheduleQueue(this);
+		}
+		SetComponentTickEnabled(false);
 		return;
 	}
 
-	// Calculate progress based on real time for accuracy
-	FDateTime Now = FDateTime::UtcNow();
-	FTimespan Elapsed = Now - CurrentCraftStartTime;
-	float ElapsedSeconds = static_cast<float>(Elapsed.GetTotalSeconds());
-	float NewProgress = FMath::Clamp(ElapsedSeconds / CraftDuration, 0.0f, 1.0f);
+	const double RemainingSeconds = GetCurrentCraftDuration() * (1.0f - Queue.Entries[0].Progress) / FMath::Max(TimeScaleMultiplier, 0.01f);
+	const double CompletionTime = LastAdvanceTime + RemainingSeconds;
+
+	// Progress replication is paced in world seconds, so it scales with the clock
+	const double ProgressTime = LastProgressUpdateTime + ProgressUpdateInterval * GetClockTimeScale();
+	NextWakeTime = FMath::Min(CompletionTime, ProgressTime);
 
-	// Update progress
-	AccumulatedDeltaTime += DeltaTime;
-	if (AccumulatedDeltaTime >= ProgressUpdateInterval)
+	if (Scheduler)
 	{
-		AccumulatedDeltaTime = 0.0f;
-		CurrentEntry.Progress = NewProgress;
-		Queue.MarkItemDirty(CurrentEntry);
+		Scheduler->ScheduleQueue(this, NextWakeTime);
+	}
+	else
+	{
+		SetComponentTickEnabled(true);
+	}
+}
 
-		OnCraftProgress.Broadcast(CurrentEntry.EntryId, NewProgress);
+float UMOCraftingQueueComponent::GetCurrentCraftDuration() const
+{
+	if (IsQueueEmpty())
+	{
+		return 0.0f;
 	}
 
-	// Check for completion
-	if (NewProgress >= 1.0f)
+	// The only recipe lookup per entry; wakes and progress queries reuse it
+	const FMOCraftingQueueEntry& Entry = Queue.Entries[0];
+	if (Entry.EntryId != CachedDurationEntryId)
+	{
+		CachedDurationEntryId = Entry.EntryId;
+		CachedCraftDuration = FMath::Max(GetEffectiveCraftDuration(Entry.RecipeId), 0.0f);
+	}
+
+	return CachedCraftDuration;
+}
+
+UMOInventoryComponent* UMOCraftingQueueComponent::GetInventoryForEntry(const FMOCraftingQueueEntry& Entry) const
+{
+	if (const TWeakObjectPtr<UMOInventoryComponent>* MaterialInventory = EntryInventories.Find(Entry.EntryId))
 	{
-		CompletCurrentCraft();
+		return MaterialInventory->Get();
 	}
+	return CachedInventory.Get();
+}
+
+double UMOCraftingQueueComponent::GetSimTime() const
+{
+	return UMOSimulationClockSubsystem::GetSimTime(this);
+}
+
+float UMOCraftingQueueComponent::GetClockTimeScale() const
+{
+	const UMOSimulationClockSubsystem* Clock = UMOSimulationClockSubsystem::Get(this);
+	return Clock ? FMath::Max(Clock->GetTimeScale(), KINDA_SMALL_NUMBER) : 1.0f;
 }
 
 void UMOCraftingQueueComponent::CompletCurrentCraft()
@@ -467,24 +737,41 @@ void UMOCraftingQueueComponent::CompletCurrentCraft()
 	if (!Recipe)
 	{
 		UE_LOG(LogMOFramework, Error, TEXT("[MOCraftingQueue] Recipe not found for completion: %s"), *CurrentEntry.RecipeId.ToString());
+		EntryInventories.Remove(CurrentEntry.EntryId);
+		EntryPlanIds.Remove(CurrentEntry.EntryId);
 		Queue.Entries.RemoveAt(0);
 		Queue.MarkArrayDirty();
 		OnQueueChanged.Broadcast();
+		if (IsQueueEmpty())
+		{
+			PauseCrafting();
+		}
 		return;
 	}
 
-	// Generate outputs via crafting subsystem
+	// Entries that consume on completion craft through the subsystem; without one their ingredients
+	// cannot be taken, so the craft fails rather than handing out free outputs
 	FMOCraftResult Result;
-	if (UMOCraftingSubsystem* CraftingSub = CachedCraftingSubsystem.Get())
+	UMOInventoryComponent* EntryInventory = GetInventoryForEntry(CurrentEntry);
+	UMOCraftingSubsystem* CraftingSub = CachedCraftingSubsystem.Get();
+	if (!CurrentEntry.bIngredientsConsumed)
 	{
-		Result = CraftingSub->ExecuteCraft(CurrentEntry.RecipeId, CachedInventory.Get(), nullptr);
+		if (CraftingSub)
+		{
+			Result = CraftingSub->ExecuteCraft(CurrentEntry.RecipeId, EntryInventory, nullptr);
+		}
+		else
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingQueue] No crafting subsystem to take ingredients for %s"), *CurrentEntry.RecipeId.ToString());
+		}
 	}
 	else
 	{
-		// Fallback: manually add outputs
+		// Ingredients were taken at enqueue: only add outputs
 		Result.bSuccess = true;
-		if (UMOInventoryComponent* Inventory = CachedInventory.Get())
+		if (UMOInventoryComponent* Inventory = EntryInventory)
 		{
+			FMOInventoryTransactionScope Transaction(Inventory);
 			for (const FMORecipeOutput& Output : Recipe->Outputs)
 			{
 				// Check chance
@@ -500,6 +787,12 @@ void UMOCraftingQueueComponent::CompletCurrentCraft()
 		}
 	}
 
+	if (!Result.bSuccess)
+	{
+		FailCurrentCraft();
+		return;
+	}
+
 	CurrentEntry.CompletedCount++;
 	FGuid CompletedEntryId = CurrentEntry.EntryId;
 
@@ -512,6 +805,8 @@ void UMOCraftingQueueComponent::CompletCurrentCraft()
 	if (CurrentEntry.CompletedCount >= CurrentEntry.Count)
 	{
 		// Entry fully complete, remove it
+		EntryInventories.Remove(CompletedEntryId);
+		EntryPlanIds.Remove(CompletedEntryId);
 		Queue.Entries.RemoveAt(0);
 		Queue.MarkArrayDirty();
 		OnQueueChanged.Broadcast();
@@ -523,13 +818,64 @@ void UMOCraftingQueueComponent::CompletCurrentCraft()
 		Queue.MarkItemDirty(CurrentEntry);
 	}
 
-	// Reset start time for next craft
-	CurrentCraftStartTime = FDateTime::UtcNow();
-
 	// Check if queue is now empty
 	if (IsQueueEmpty())
 	{
 		PauseCrafting();
+
+		if (UMOCraftingSchedulerSubsystem* Scheduler = CachedScheduler.Get())
+		{
+			Scheduler->NotifyWorkerIdle(this);
+		}
+	}
+}
+
+void UMOCraftingQueueComponent::FailCurrentCraft()
+{
+	const FGuid FailedEntryId = Queue.Entries[0].EntryId;
+	const FName FailedRecipeId = Queue.Entries[0].RecipeId;
+
+	FGuid PlanId;
+	EntryPlanIds.RemoveAndCopyValue(FailedEntryId, PlanId);
+	EntryInventories.Remove(FailedEntryId);
+	Queue.Entries.RemoveAt(0);
+
+	// Later steps of the plan were waiting on this step's outputs
+	TArray<FGuid> CancelledIds;
+	if (PlanId.IsValid())
+	{
+		for (int32 i = 0; i < Queue.Entries.Num(); ++i)
+		{
+			const FGuid EntryId = Queue.Entries[i].EntryId;
+			if (EntryPlanIds.FindRef(EntryId) == PlanId)
+			{
+				CancelledIds.Add(EntryId);
+				EntryPlanIds.Remove(EntryId);
+				EntryInventories.Remove(EntryId);
+				Queue.Entries.RemoveAt(i--);
+			}
+		}
+	}
+	Queue.MarkArrayDirty();
+
+	UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingQueue] Craft of %s failed (ingredients missing); cancelled %d later plan steps"),
+		*FailedRecipeId.ToString(), CancelledIds.Num());
+
+	OnCraftFailed.Broadcast(FailedEntryId, FailedRecipeId, PlanId);
+	for (const FGuid& CancelledId : CancelledIds)
+	{
+		OnCraftCancelled.Broadcast(CancelledId, false);
+	}
+	OnQueueChanged.Broadcast();
+
+	if (IsQueueEmpty())
+	{
+		PauseCrafting();
+
+		if (UMOCraftingSchedulerSubsystem* Scheduler = CachedScheduler.Get())
+		{
+			Scheduler->NotifyWorkerIdle(this);
+		}
 	}
 }
 
@@ -557,18 +903,7 @@ bool UMOCraftingQueueComponent::ConsumeIngredientsForCraft(FName RecipeId, int32
 	for (const FMORecipeIngredient& Ingredient : Recipe->Ingredients)
 	{
 		int32 Required = Ingredient.Quantity * Count;
-		int32 Available = 0;
-
-		TArray<FMOInventoryEntry> Entries;
-		Inventory->GetInventoryEntries(Entries);
-
-		for (const FMOInventoryEntry& Entry : Entries)
-		{
-			if (Entry.ItemDefinitionId == Ingredient.ItemDefinitionId)
-			{
-				Available += Entry.Quantity;
-			}
-		}
+		int32 Available = Inventory->GetTotalQuantityByDefinition(Ingredient.ItemDefinitionId);
 
 		if (Available < Required)
 		{
@@ -579,6 +914,7 @@ bool UMOCraftingQueueComponent::ConsumeIngredientsForCraft(FName RecipeId, int32
 	}
 
 	// Now consume the ingredients
+	FMOInventoryTransactionScope Transaction(Inventory);
 	for (const FMORecipeIngredient& Ingredient : Recipe->Ingredients)
 	{
 		int32 ToConsume = Ingredient.Quantity * Count;
@@ -591,10 +927,18 @@ bool UMOCraftingQueueComponent::ConsumeIngredientsForCraft(FName RecipeId, int32
 			if (Entry.ItemDefinitionId == Ingredient.ItemDefinitionId && ToConsume > 0)
 			{
 				int32 ConsumeFromThis = FMath::Min(Entry.Quantity, ToConsume);
-				Inventory->RemoveItemByGuid(Entry.ItemGuid, ConsumeFromThis);
-				ToConsume -= ConsumeFromThis;
+				if (Inventory->RemoveItemByGuid(Entry.ItemGuid, ConsumeFromThis))
+				{
+					ToConsume -= ConsumeFromThis;
+				}
 			}
 		}
+
+		if (ToConsume > 0)
+		{
+			Transaction.Rollback();
+			return false;
+		}
 	}
 
 	return true;
@@ -614,6 +958,7 @@ void UMOCraftingQueueComponent::RefundIngredientsForCraft(FName RecipeId, int32
 		return;
 	}
 
+	FMOInventoryTransactionScope Transaction(Inventory);
 	for (const FMORecipeIngredient& Ingredient : Recipe->Ingredients)
 	{
 		int32 ToRefund = Ingredient.Quantity * Count;
@@ -625,18 +970,16 @@ void UMOCraftingQueueComponent::RefundIngredientsForCraft(FName RecipeId, int32
 	}
 }
 
-float UMOCraftingQueueComponent::CalculateProgressFromTime(const FMOCraftingQueueEntry& Entry, float CraftDuration) const
+float UMOCraftingQueueComponent::CalculateProgressFromTime(double Now) const
 {
+	const float CraftDuration = GetCurrentCraftDuration();
 	if (CraftDuration <= 0.0f)
 	{
 		return 1.0f;
 	}
 
-	FDateTime Now = FDateTime::UtcNow();
-	FTimespan Elapsed = Now - CurrentCraftStartTime;
-	float ElapsedSeconds = static_cast<float>(Elapsed.GetTotalSeconds());
-
-	return FMath::Clamp(ElapsedSeconds / CraftDuration, 0.0f, 1.0f);
+	const double ElapsedSeconds = (Now - LastAdvanceTime) * TimeScaleMultiplier;
+	return FMath::Clamp(Queue.Entries[0].Progress + static_cast<float>(ElapsedSeconds / CraftDuration), 0.0f, 1.0f);
 }
 
 float UMOCraftingQueueComponent::GetEffectiveCraftDuration(FName RecipeId) const
@@ -654,12 +997,15 @@ float UMOCraftingQueueComponent::GetEffectiveCraftDuration(FName RecipeId) const
 	return BaseDuration;
 }
 
-void UMOCraftingQueueComponent::AdvanceQueueByTime(float ElapsedSeconds)
+void UMOCraftingQueueComponent::AdvanceQueueByTime(double ElapsedSeconds)
 {
-	while (ElapsedSeconds > 0.0f && Queue.Entries.Num() > 0)
+	ElapsedSeconds *= TimeScaleMultiplier;
+
+	// Time left over from a completed craft carries into the next one
+	while (Queue.Entries.Num() > 0)
 	{
 		FMOCraftingQueueEntry& Entry = Queue.Entries[0];
-		float CraftDuration = GetEffectiveCraftDuration(Entry.RecipeId);
+		const float CraftDuration = GetCurrentCraftDuration();
 
 		if (CraftDuration <= 0.0f)
 		{
@@ -668,26 +1014,27 @@ void UMOCraftingQueueComponent::AdvanceQueueByTime(float ElapsedSeconds)
 			continue;
 		}
 
+		if (ElapsedSeconds <= 0.0)
+		{
+			break;
+		}
+
 		// Calculate how much time is left on current craft
-		float TimeIntoCurrentCraft = Entry.Progress * CraftDuration;
-		float TimeRemainingOnCurrent = CraftDuration - TimeIntoCurrentCraft;
+		const double TimeRemainingOnCurrent = CraftDuration * (1.0f - Entry.Progress);
 
-		if (ElapsedSeconds >= TimeRemainingOnCurrent)
+		// Tolerance so a wake booked for the completion does not leave a sliver of progress behind
+		if (ElapsedSeconds >= TimeRemainingOnCurrent - KINDA_SMALL_NUMBER)
 		{
 			// This craft completes
-			ElapsedSeconds -= TimeRemainingOnCurrent;
+			ElapsedSeconds = FMath::Max(ElapsedSeconds - TimeRemainingOnCurrent, 0.0);
 			Entry.Progress = 1.0f;
 			CompletCurrentCraft();
 		}
 		else
 		{
-			// Partial progress
-			Entry.Progress = (TimeIntoCurrentCraft + ElapsedSeconds) / CraftDuration;
-			Queue.MarkItemDirty(Entry);
-			ElapsedSeconds = 0.0f;
+			// Partial progress; replicated by the next progress update
+			Entry.Progress = FMath::Min(Entry.Progress + static_cast<float>(ElapsedSeconds / CraftDuration), 1.0f);
+			ElapsedSeconds = 0.0;
 		}
 	}
-
-	// Reset start time for resumed crafting
-	CurrentCraftStartTime = FDateTime::UtcNow();
 }
@@ -0,0 +1,451 @@
+#include "MOCraftingSchedulerSubsystem.h"
+#include "MOFramework.h"
+
+#include "Engine/World.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "TimerManager.h"
+
+#include "MOCraftingQueueComponent.h"
+#include "MOIdentityComponent.h"
+#include "MOIdentityRegistrySubsystem.h"
+#include "MOInventoryComponent.h"
+#include "MORecipeDatabaseSettings.h"
+#include "MOSimulationClockSubsystem.h"
+
+void UMOCraftingSchedulerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UMOSimulationClockSubsystem* Clock = Collection.InitializeDependency<UMOSimulationClockSubsystem>())
+	{
+		SimulationClock = Clock;
+		ClockChangedHandle = Clock->OnClockChanged.AddUObject(this, &UMOCraftingSchedulerSubsystem::HandleClockChanged);
+	}
+}
+
+void UMOCraftingSchedulerSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(WakeTimerHandle);
+	}
+
+	if (UMOSimulationClockSubsystem* Clock = SimulationClock.Get())
+	{
+		Clock->OnClockChanged.Remove(ClockChangedHandle);
+	}
+	ClockChangedHandle.Reset();
+
+	WakeQueue.Reset();
+	DueWakes.Reset();
+	LiveSerials.Reset();
+	StationJobs.Reset();
+	Workers.Reset();
+	RestoredEntryInventories.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UMOCraftingSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UMOCraftingSchedulerSubsystem* UMOCraftingSchedulerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UMOCraftingSchedulerSubsystem>() : nullptr;
+}
+
+/*
+ * Active queues
+ */
+
+void UMOCraftingSchedulerSubsystem::ScheduleQueue(UMOCraftingQueueComponent* Queue, double WakeTime)
+{
+	if (!IsValid(Queue))
+	{
+		return;
+	}
+
+	// The previous booking stays in the heap and is skipped when popped.
+	const uint32 Serial = ++NextSerial;
+	LiveSerials.Add(Queue, Serial);
+
+	FQueueWake Wake;
+	Wake.Time = WakeTime;
+	Wake.Queue = Queue;
+	Wake.Serial = Serial;
+	WakeQueue.HeapPush(MoveTemp(Wake));
+
+	if (!bIsRunningWakes)
+	{
+		ArmTimer();
+	}
+}
+
+void UMOCraftingSchedulerSubsystem::UnscheduleQueue(UMOCraftingQueueComponent* Queue)
+{
+	LiveSerials.Remove(Queue);
+}
+
+bool UMOCraftingSchedulerSubsystem::IsLiveWake(const FQueueWake& Wake) const
+{
+	const UMOCraftingQueueComponent* Queue = Wake.Queue.Get();
+	const uint32* LiveSerial = Queue ? LiveSerials.Find(Queue) : nullptr;
+	return LiveSerial && *LiveSerial == Wake.Serial;
+}
+
+void UMOCraftingSchedulerSubsystem::RunDueWakes()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UMOCraftingSchedulerSubsystem::RunDueWakes);
+
+	// A clock change from inside a dispatch is picked up by the re-arm at the end of this run.
+	if (!GetWorld() || bIsRunningWakes)
+	{
+		return;
+	}
+
+	const double Now = GetNow();
+
+	DueWakes.Reset();
+	while (WakeQueue.Num() > 0 && WakeQueue.HeapTop().Time <= Now)
+	{
+		FQueueWake Wake;
+		WakeQueue.HeapPop(Wake, EAllowShrinking::No);
+		if (IsLiveWake(Wake))
+		{
+			DueWakes.Add(MoveTemp(Wake));
+		}
+	}
+
+	bIsRunningWakes = true;
+	for (const FQueueWake& Wake : DueWakes)
+	{
+		UMOCraftingQueueComponent* Queue = Wake.Queue.Get();
+
+		// An earlier dispatch this run may have paused or rebooked this queue.
+		if (!Queue || !IsLiveWake(Wake))
+		{
+			continue;
+		}
+
+		// The wake is spent; the queue books its next one if it still has work.
+		LiveSerials.Remove(Queue);
+		Queue->HandleSchedulerWake(Now);
+	}
+	bIsRunningWakes = false;
+
+	ArmTimer();
+}
+
+void UMOCraftingSchedulerSubsystem::ArmTimer()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// Superseded bookings at the top would only cause empty wakes.
+	while (WakeQueue.Num() > 0 && !IsLiveWake(WakeQueue.HeapTop()))
+	{
+		FQueueWake Stale;
+		WakeQueue.HeapPop(Stale, EAllowShrinking::No);
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (WakeQueue.Num() == 0)
+	{
+		TimerManager.ClearTimer(WakeTimerHandle);
+		return;
+	}
+
+	const double NextWakeTime = WakeQueue.HeapTop().Time;
+	if (TimerManager.IsTimerActive(WakeTimerHandle) && ArmedWakeTime <= NextWakeTime)
+	{
+		return;
+	}
+
+	const UMOSimulationClockSubsystem* Clock = SimulationClock.Get();
+	const double WorldDelay = Clock ? Clock->GetWorldDelayUntil(NextWakeTime) : NextWakeTime - World->GetTimeSeconds();
+	if (WorldDelay >= TNumericLimits<float>::Max())
+	{
+		// Frozen clock: nothing comes due until the time scale changes.
+		TimerManager.ClearTimer(WakeTimerHandle);
+		return;
+	}
+
+	// A zero rate would clear the timer; due wakes run on the next tick instead.
+	ArmedWakeTime = NextWakeTime;
+	const float Delay = FMath::Max(static_cast<float>(WorldDelay), KINDA_SMALL_NUMBER);
+	TimerManager.SetTimer(WakeTimerHandle, this, &UMOCraftingSchedulerSubsystem::RunDueWakes, Delay, false);
+}
+
+void UMOCraftingSchedulerSubsystem::HandleClockChanged()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(WakeTimerHandle);
+	}
+
+	RunDueWakes();
+}
+
+double UMOCraftingSchedulerSubsystem::GetNow() const
+{
+	if (const UMOSimulationClockSubsystem* Clock = SimulationClock.Get())
+	{
+		return Clock->GetTime();
+	}
+
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+/*
+ * Station queues
+ */
+
+bool UMOCraftingSchedulerSubsystem::RegisterWorker(UMOCraftingQueueComponent* Worker, EMOCraftingStation Station)
+{
+	if (!IsValid(Worker))
+	{
+		return false;
+	}
+
+	FStationWorker* Existing = Workers.FindByPredicate([Worker](const FStationWorker& Entry) { return Entry.Queue == Worker; });
+	if (Existing)
+	{
+		Existing->Station = Station;
+	}
+	else
+	{
+		FStationWorker& NewWorker = Workers.AddDefaulted_GetRef();
+		NewWorker.Queue = Worker;
+		NewWorker.Station = Station;
+	}
+
+	AssignStationJobs(Station);
+	return true;
+}
+
+void UMOCraftingSchedulerSubsystem::UnregisterWorker(UMOCraftingQueueComponent* Worker)
+{
+	Workers.RemoveAll([Worker](const FStationWorker& Entry) { return Entry.Queue == Worker; });
+}
+
+FGuid UMOCraftingSchedulerSubsystem::SubmitStationJob(EMOCraftingStation Station, FName RecipeId, int32 Count, UMOInventoryComponent* MaterialInventory)
+{
+	if (Count <= 0 || !IsValid(MaterialInventory))
+	{
+		return FGuid();
+	}
+
+	if (!UMORecipeDatabaseSettings::GetRecipeDefinition(RecipeId))
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingScheduler] Station job for unknown recipe: %s"), *RecipeId.ToString());
+		return FGuid();
+	}
+
+	FStationJob& Job = StationJobs.AddDefaulted_GetRef();
+	Job.JobId = FGuid::NewGuid();
+	Job.RecipeId = RecipeId;
+	Job.Count = Count;
+	Job.Station = Station;
+	Job.MaterialInventory = MaterialInventory;
+
+	const FGuid JobId = Job.JobId;
+	AssignStationJobs(Station);
+	return JobId;
+}
+
+bool UMOCraftingSchedulerSubsystem::CancelStationJob(const FGuid& JobId)
+{
+	return StationJobs.RemoveAll([&JobId](const FStationJob& Job) { return Job.JobId == JobId; }) > 0;
+}
+
+int32 UMOCraftingSchedulerSubsystem::GetPendingStationJobCount(EMOCraftingStation Station) const
+{
+	int32 Count = 0;
+	for (const FStationJob& Job : StationJobs)
+	{
+		Count += (Job.Station == Station) ? 1 : 0;
+	}
+	return Count;
+}
+
+void UMOCraftingSchedulerSubsystem::NotifyWorkerIdle(UMOCraftingQueueComponent* Worker)
+{
+	const FStationWorker* Entry = Workers.FindByPredicate([Worker](const FStationWorker& Candidate) { return Candidate.Queue == Worker; });
+	if (Entry)
+	{
+		AssignStationJobs(Entry->Station);
+	}
+}
+
+void UMOCraftingSchedulerSubsystem::AssignStationJobs(EMOCraftingStation Station)
+{
+	Workers.RemoveAll([](const FStationWorker& Entry) { return !Entry.Queue.IsValid(); });
+
+	// No worker can run a job whose materials are gone
+	StationJobs.RemoveAll([](const FStationJob& Job)
+	{
+		if (Job.MaterialInventory.IsValid())
+		{
+			return false;
+		}
+
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingScheduler] Dropped station job %dx %s: material inventory is gone"),
+			Job.Count, *Job.RecipeId.ToString());
+		return true;
+	});
+
+	for (const FStationWorker& Entry : Workers)
+	{
+		if (Entry.Station != Station)
+		{
+			continue;
+		}
+
+		UMOCraftingQueueComponent* Worker = Entry.Queue.Get();
+		if (!Worker || !Worker->IsQueueEmpty())
+		{
+			continue;
+		}
+
+		const FStationJob* NextJob = StationJobs.FindByPredicate([Station](const FStationJob& Job) { return Job.Station == Station; });
+		if (!NextJob)
+		{
+			return;
+		}
+
+		// A refused job stays at the front for the next idle worker
+		const FStationJob Job = *NextJob;
+		if (!Worker->EnqueueStationJob(Job.RecipeId, Job.Count, Job.Station, Job.MaterialInventory.Get()))
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingScheduler] %s refused job %dx %s; keeping it queued"),
+				*GetNameSafe(Worker->GetOwner()), Job.Count, *Job.RecipeId.ToString());
+			continue;
+		}
+
+		StationJobs.RemoveAll([&Job](const FStationJob& Candidate) { return Candidate.JobId == Job.JobId; });
+
+		UE_LOG(LogMOFramework, Verbose, TEXT("[MOCraftingScheduler] %s took job %dx %s"),
+			*GetNameSafe(Worker->GetOwner()), Job.Count, *Job.RecipeId.ToString());
+	}
+}
+
+/*
+ * Save/Load
+ */
+
+namespace
+{
+	FGuid GetMaterialOwnerGuid(const UMOInventoryComponent* Inventory)
+	{
+		const AActor* Owner = Inventory ? Inventory->GetOwner() : nullptr;
+		const UMOIdentityComponent* Identity = Owner ? Owner->FindComponentByClass<UMOIdentityComponent>() : nullptr;
+		return (Identity && Identity->HasValidGuid()) ? Identity->GetGuid() : FGuid();
+	}
+}
+
+void UMOCraftingSchedulerSubsystem::BuildSaveData(FMOCraftingSchedulerSaveData& OutSaveData) const
+{
+	OutSaveData = FMOCraftingSchedulerSaveData();
+
+	for (const FStationJob& Job : StationJobs)
+	{
+		const FGuid OwnerGuid = GetMaterialOwnerGuid(Job.MaterialInventory.Get());
+		if (!OwnerGuid.IsValid())
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingScheduler] Not saving station job %s: material inventory has no identity"),
+				*Job.RecipeId.ToString());
+			continue;
+		}
+
+		FMOStationJobSaveData& JobData = OutSaveData.PendingJobs.AddDefaulted_GetRef();
+		JobData.JobId = Job.JobId;
+		JobData.RecipeId = Job.RecipeId;
+		JobData.Count = Job.Count;
+		JobData.Station = Job.Station;
+		JobData.MaterialOwnerGuid = OwnerGuid;
+	}
+
+	for (const FStationWorker& Entry : Workers)
+	{
+		const UMOCraftingQueueComponent* Worker = Entry.Queue.Get();
+		if (!Worker)
+		{
+			continue;
+		}
+
+		for (const TPair<FGuid, TWeakObjectPtr<UMOInventoryComponent>>& Binding : Worker->GetStationEntryInventories())
+		{
+			const FGuid OwnerGuid = GetMaterialOwnerGuid(Binding.Value.Get());
+			if (OwnerGuid.IsValid())
+			{
+				FMOStationEntrySaveData& EntryData = OutSaveData.AssignedEntries.AddDefaulted_GetRef();
+				EntryData.EntryId = Binding.Key;
+				EntryData.MaterialOwnerGuid = OwnerGuid;
+			}
+		}
+	}
+}
+
+void UMOCraftingSchedulerSubsystem::ApplySaveData(const FMOCraftingSchedulerSaveData& InSaveData)
+{
+	StationJobs.Reset();
+	RestoredEntryInventories.Reset();
+
+	TSet<EMOCraftingStation> Stations;
+	for (const FMOStationJobSaveData& JobData : InSaveData.PendingJobs)
+	{
+		UMOInventoryComponent* MaterialInventory = ResolveMaterialInventory(JobData.MaterialOwnerGuid);
+		if (!MaterialInventory || JobData.Count <= 0)
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingScheduler] Dropped saved station job %s: material inventory not found"),
+				*JobData.RecipeId.ToString());
+			continue;
+		}
+
+		FStationJob& Job = StationJobs.AddDefaulted_GetRef();
+		Job.JobId = JobData.JobId.IsValid() ? JobData.JobId : FGuid::NewGuid();
+		Job.RecipeId = JobData.RecipeId;
+		Job.Count = JobData.Count;
+		Job.Station = JobData.Station;
+		Job.MaterialInventory = MaterialInventory;
+		Stations.Add(JobData.Station);
+	}
+
+	for (const FMOStationEntrySaveData& EntryData : InSaveData.AssignedEntries)
+	{
+		if (UMOInventoryComponent* MaterialInventory = ResolveMaterialInventory(EntryData.MaterialOwnerGuid))
+		{
+			RestoredEntryInventories.Add(EntryData.EntryId, MaterialInventory);
+		}
+	}
+
+	UE_LOG(LogMOFramework, Log, TEXT("[MOCraftingScheduler] Applied save data: %d pending jobs, %d station entries"),
+		StationJobs.Num(), RestoredEntryInventories.Num());
+
+	for (const EMOCraftingStation Station : Stations)
+	{
+		AssignStationJobs(Station);
+	}
+}
+
+UMOInventoryComponent* UMOCraftingSchedulerSubsystem::TakeRestoredEntryInventory(const FGuid& EntryId)
+{
+	TWeakObjectPtr<UMOInventoryComponent> MaterialInventory;
+	RestoredEntryInventories.RemoveAndCopyValue(EntryId, MaterialInventory);
+	return MaterialInventory.Get();
+}
+
+UMOInventoryComponent* UMOCraftingSchedulerSubsystem::ResolveMaterialInventory(const FGuid& OwnerGuid) const
+{
+	const UWorld* World = GetWorld();
+	const UMOIdentityRegistrySubsystem* Registry = World ? World->GetSubsystem<UMOIdentityRegistrySubsystem>() : nullptr;
+	AActor* Owner = (Registry && OwnerGuid.IsValid()) ? Registry->ResolveActorOrNull(OwnerGuid) : nullptr;
+	return Owner ? Owner->FindComponentByClass<UMOInventoryComponent>() : nullptr;
+}
@@ -5,45 +5,69 @@
 #include "MORecipeDatabaseSettings.h"
 #include "MOFramework.h"
 
-void UMOCraftingSubsystem::GetAvailableRecipes(
+#include "Algo/AllOf.h"
+#include "Algo/Reverse.h"
+
+void UMOCraftingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Build the recipe index up front so the first recipe menu does not pay for it.
+	UMORecipeDatabaseSettings::GetRecipeIndex();
+
+	RecipeIndexResetHandle = UMORecipeDatabaseSettings::OnRecipeIndexReset().AddUObject(this, &UMOCraftingSubsystem::HandleRecipeIndexReset);
+}
+
+void UMOCraftingSubsystem::Deinitialize()
+{
+	UMORecipeDatabaseSettings::OnRecipeIndexReset().Remove(RecipeIndexResetHandle);
+	RecipeIndexResetHandle.Reset();
+	Planner.Reset();
+
+	Super::Deinitialize();
+}
+
+void UMOCraftingSubsystem::HandleRecipeIndexReset(const FMORecipeIndex& /*OldIndex*/)
+{
+	Planner.Reset();
+}
+
+void UMOCraftingSubsystem::GetAvailableRecipePositions(
 	UMOKnowledgeComponent* KnowledgeComponent,
 	UMOSkillsComponent* SkillsComponent,
 	EMOCraftingStation Station,
-	TArray<FName>& OutRecipeIds
+	TArray<int32>& OutPositions
 ) const
 {
-	OutRecipeIds.Empty();
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
 
-	TArray<FName> AllRecipeIds;
-	UMORecipeDatabaseSettings::GetAllRecipeIds(AllRecipeIds);
+	// Only recipes usable at this station are visited at all.
+	Index.GetStationPositions(Station, OutPositions);
 
-	for (const FName& RecipeId : AllRecipeIds)
+	OutPositions.RemoveAll([&Index, this, KnowledgeComponent, SkillsComponent](const int32 Position)
 	{
-		const FMORecipeDefinitionRow* Recipe = UMORecipeDatabaseSettings::GetRecipeDefinition(RecipeId);
-		if (!Recipe)
-		{
-			continue;
-		}
-
-		// Check station requirement
-		if (Recipe->RequiredStation != EMOCraftingStation::None && Recipe->RequiredStation != Station)
-		{
-			continue;
-		}
+		const FMORecipeDefinitionRow* Recipe = Index.Rows[Position];
+		return !HasRequiredKnowledge(Recipe, KnowledgeComponent) || !MeetsSkillRequirements(Recipe, SkillsComponent);
+	});
+}
 
-		// Check knowledge requirements
-		if (!HasRequiredKnowledge(Recipe, KnowledgeComponent))
-		{
-			continue;
-		}
+void UMOCraftingSubsystem::GetAvailableRecipes(
+	UMOKnowledgeComponent* KnowledgeComponent,
+	UMOSkillsComponent* SkillsComponent,
+	EMOCraftingStation Station,
+	TArray<FName>& OutRecipeIds
+) const
+{
+	OutRecipeIds.Reset();
 
-		// Check skill requirements
-		if (!MeetsSkillRequirements(Recipe, SkillsComponent))
-		{
-			continue;
-		}
+	TArray<int32> Positions;
+	GetAvailableRecipePositions(KnowledgeComponent, SkillsComponent, Station, Positions);
 
-		OutRecipeIds.Add(RecipeId);
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+	OutRecipeIds.Reserve(Positions.Num());
+	for (const int32 Position : Positions)
+	{
+		OutRecipeIds.Add(Index.Ids[Position]);
 	}
 }
 
@@ -56,23 +80,18 @@ void UMOCraftingSubsystem::GetCraftableRecipes(
 ) const
 {
 	// First get available recipes
-	TArray<FName> AvailableRecipes;
-	GetAvailableRecipes(KnowledgeComponent, SkillsComponent, Station, AvailableRecipes);
+	TArray<int32> AvailablePositions;
+	GetAvailableRecipePositions(KnowledgeComponent, SkillsComponent, Station, AvailablePositions);
 
-	OutRecipeIds.Empty();
+	OutRecipeIds.Reset();
 
-	for (const FName& RecipeId : AvailableRecipes)
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+	for (const int32 Position : AvailablePositions)
 	{
-		const FMORecipeDefinitionRow* Recipe = UMORecipeDatabaseSettings::GetRecipeDefinition(RecipeId);
-		if (!Recipe)
-		{
-			continue;
-		}
-
 		// Check if has all ingredients
-		if (HasIngredients(Recipe, InventoryComponent, KnowledgeComponent))
+		if (HasIngredients(Index.Rows[Position], InventoryComponent, KnowledgeComponent))
 		{
-			OutRecipeIds.Add(RecipeId);
+			OutRecipeIds.Add(Index.Ids[Position]);
 		}
 	}
 }
@@ -160,24 +179,10 @@ FMOCraftResult UMOCraftingSubsystem::ExecuteCraft(
 		return Result;
 	}
 
-	// Build a map of ItemDefId -> total quantity in inventory
-	TMap<FName, int32> InventoryTotals;
-	TMap<FName, TArray<FGuid>> InventoryGuidsByDefId;
-	{
-		TArray<FMOInventoryEntry> Entries;
-		InventoryComponent->GetInventoryEntries(Entries);
-		for (const FMOInventoryEntry& Entry : Entries)
-		{
-			InventoryTotals.FindOrAdd(Entry.ItemDefinitionId) += Entry.Quantity;
-			InventoryGuidsByDefId.FindOrAdd(Entry.ItemDefinitionId).Add(Entry.ItemGuid);
-		}
-	}
-
 	// Verify we have all ingredients
 	for (const FMORecipeIngredient& Ingredient : Recipe->Ingredients)
 	{
-		const int32* AvailablePtr = InventoryTotals.Find(Ingredient.ItemDefinitionId);
-		const int32 Available = AvailablePtr ? *AvailablePtr : 0;
+		const int32 Available = InventoryComponent->GetTotalQuantityByDefinition(Ingredient.ItemDefinitionId);
 
 		if (Available < Ingredient.Quantity)
 		{
@@ -187,6 +192,20 @@ FMOCraftResult UMOCraftingSubsystem::ExecuteCraft(
 		}
 	}
 
+	// Consumption and outputs land as one inventory change
+	FMOInventoryTransactionScope Transaction(InventoryComponent);
+
+	// Collect the GUIDs holding each ingredient before anything is removed
+	TMap<FName, TArray<FGuid>> InventoryGuidsByDefId;
+	{
+		TArray<FMOInventoryEntry> Entries;
+		InventoryComponent->GetInventoryEntries(Entries);
+		for (const FMOInventoryEntry& Entry : Entries)
+		{
+			InventoryGuidsByDefId.FindOrAdd(Entry.ItemDefinitionId).Add(Entry.ItemGuid);
+		}
+	}
+
 	// Consume ingredients
 	for (const FMORecipeIngredient& Ingredient : Recipe->Ingredients)
 	{
@@ -199,10 +218,19 @@ FMOCraftResult UMOCraftingSubsystem::ExecuteCraft(
 			if (InventoryComponent->TryGetEntryByGuid(Guids[i], Entry))
 			{
 				const int32 ToRemove = FMath::Min(Entry.Quantity, RemainingToConsume);
-				InventoryComponent->RemoveItemByGuid(Guids[i], ToRemove);
-				RemainingToConsume -= ToRemove;
+				if (InventoryComponent->RemoveItemByGuid(Guids[i], ToRemove))
+				{
+					RemainingToConsume -= ToRemove;
+				}
 			}
 		}
+
+		if (RemainingToConsume > 0)
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingSubsystem] ExecuteCraft: Failed to consume '%s'"), *Ingredient.ItemDefinitionId.ToString());
+			Transaction.Rollback();
+			return Result;
+		}
 	}
 
 	// Produce outputs
@@ -248,6 +276,45 @@ float UMOCraftingSubsystem::GetRecipeCraftTime(FName RecipeId) const
 	return Recipe ? Recipe->CraftTime : 0.0f;
 }
 
+bool UMOCraftingSubsystem::PlanCraft(
+	FName ItemDefinitionId,
+	int32 Quantity,
+	UMOKnowledgeComponent* KnowledgeComponent,
+	UMOSkillsComponent* SkillsComponent,
+	UMOInventoryComponent* InventoryComponent,
+	EMOCraftingStation Station,
+	FMOCraftingPlan& OutPlan
+)
+{
+	const FMORecipeIndex& Index = UMORecipeDatabaseSettings::GetRecipeIndex();
+
+	Planner.BuildPlan(Index, ItemDefinitionId, Quantity, Station,
+		[this, KnowledgeComponent, SkillsComponent](const FMORecipeDefinitionRow& Recipe)
+		{
+			return HasRequiredKnowledge(&Recipe, KnowledgeComponent) && MeetsSkillRequirements(&Recipe, SkillsComponent);
+		},
+		[InventoryComponent](FName HeldItemId)
+		{
+			return IsValid(InventoryComponent) ? InventoryComponent->GetTotalQuantityByDefinition(HeldItemId) : 0;
+		},
+		OutPlan);
+
+	return OutPlan.bSuccess;
+}
+
+bool UMOCraftingSubsystem::IsRecipeRowCraftable(
+	const FMORecipeDefinitionRow* Recipe,
+	UMOKnowledgeComponent* KnowledgeComponent,
+	UMOSkillsComponent* SkillsComponent,
+	UMOInventoryComponent* InventoryComponent
+) const
+{
+	return Recipe
+		&& HasRequiredKnowledge(Recipe, KnowledgeComponent)
+		&& MeetsSkillRequirements(Recipe, SkillsComponent)
+		&& HasIngredients(Recipe, InventoryComponent, KnowledgeComponent);
+}
+
 bool UMOCraftingSubsystem::HasRequiredKnowledge(
 	const FMORecipeDefinitionRow* Recipe,
 	UMOKnowledgeComponent* KnowledgeComponent,
@@ -323,17 +390,6 @@ bool UMOCraftingSubsystem::HasIngredients(
 		return false;
 	}
 
-	// Build inventory totals
-	TMap<FName, int32> InventoryTotals;
-	{
-		TArray<FMOInventoryEntry> Entries;
-		InventoryComponent->GetInventoryEntries(Entries);
-		for (const FMOInventoryEntry& Entry : Entries)
-		{
-			InventoryTotals.FindOrAdd(Entry.ItemDefinitionId) += Entry.Quantity;
-		}
-	}
-
 	bool bHasAll = true;
 	for (const FMORecipeIngredient& Ingredient : Recipe->Ingredients)
 	{
@@ -356,8 +412,7 @@ bool UMOCraftingSubsystem::HasIngredients(
 			}
 		}
 
-		const int32* AvailablePtr = InventoryTotals.Find(Ingredient.ItemDefinitionId);
-		const int32 Available = AvailablePtr ? *AvailablePtr : 0;
+		const int32 Available = InventoryComponent->GetTotalQuantityByDefinition(Ingredient.ItemDefinitionId);
 
 		if (Available < Ingredient.Quantity)
 		{
@@ -371,3 +426,277 @@ bool UMOCraftingSubsystem::HasIngredients(
 
 	return bHasAll;
 }
+
+/*
+ * Crafting planner
+ */
+
+void FMOCraftingPlanner::Reset()
+{
+	ProducerMemo.Reset();
+	ExpansionMemo.Reset();
+}
+
+const TArray<FMOCraftingPlanner::FProducer>& FMOCraftingPlanner::FindProducers(const FMORecipeIndex& Index, FName ItemDefinitionId, EMOCraftingStation Station)
+{
+	const FPlanKey Key{ ItemDefinitionId, Station };
+	if (const TArray<FProducer>* Memoized = ProducerMemo.Find(Key))
+	{
+		return *Memoized;
+	}
+
+	TArray<FProducer> Producers;
+	if (const TArray<int32>* Candidates = Index.ByOutput.Find(ItemDefinitionId))
+	{
+		for (const int32 Position : *Candidates)
+		{
+			const FMORecipeDefinitionRow* Recipe = Index.Rows[Position];
+			if (Recipe->RequiredStation != EMOCraftingStation::None && Recipe->RequiredStation != Station)
+			{
+				continue;
+			}
+
+			// Chance outputs (byproducts) cannot be planned around.
+			FProducer Producer;
+			for (const FMORecipeOutput& Output : Recipe->Outputs)
+			{
+				if (Output.ItemDefinitionId == ItemDefinitionId && Output.Chance >= 1.0f && Output.Quantity > 0)
+				{
+					Producer.RecipePosition = Position;
+					Producer.OutputQuantity += Output.Quantity;
+				}
+			}
+
+			if (Producer.RecipePosition != INDEX_NONE)
+			{
+				Producers.Add(Producer);
+			}
+		}
+	}
+
+	return ProducerMemo.Add(Key, MoveTemp(Producers));
+}
+
+const FMOCraftingPlanner::FExpansion& FMOCraftingPlanner::Expand(const FMORecipeIndex& Index, FName ItemDefinitionId, EMOCraftingStation Station,
+	TFunctionRef<bool(const FMORecipeDefinitionRow&)> CanUseRecipe)
+{
+	// A memoized expansion stands while every gate its producer choices saw still gives the same answer.
+	const FPlanKey Key{ ItemDefinitionId, Station };
+	if (const FExpansion* Memoized = ExpansionMemo.Find(Key))
+	{
+		const bool bGatesAgree = Algo::AllOf(Memoized->RecipeGates, [&Index, &CanUseRecipe](const TPair<int32, bool>& Gate)
+		{
+			return CanUseRecipe(*Index.Rows[Gate.Key]) == Gate.Value;
+		});
+
+		if (bGatesAgree)
+		{
+			return *Memoized;
+		}
+	}
+
+	// Iterative depth-first walk over the crafted items; raw materials are never pushed.
+	// The post-order lists every item after everything it depends on.
+	enum class EVisit : uint8 { OnStack, Done };
+
+	struct FFrame
+	{
+		FName ItemDefinitionId;
+		FProducer Producer;
+		int32 NextIngredient = 0;
+	};
+
+	TMap<FName, EVisit> Visits;
+	TArray<FFrame> Stack;
+	FExpansion Expansion;
+
+	// The first producer the gate accepts makes the item; every gate consulted is recorded.
+	auto PushIfCrafted = [&](FName Item)
+	{
+		for (const FProducer& Producer : FindProducers(Index, Item, Station))
+		{
+			const bool bUsable = CanUseRecipe(*Index.Rows[Producer.RecipePosition]);
+			Expansion.RecipeGates.Emplace(Producer.RecipePosition, bUsable);
+			if (bUsable)
+			{
+				Visits.Add(Item, EVisit::OnStack);
+				Stack.Add({ Item, Producer, 0 });
+				return;
+			}
+		}
+	};
+
+	PushIfCrafted(ItemDefinitionId);
+
+	while (Stack.Num() > 0)
+	{
+		FFrame& Top = Stack.Last();
+		const TArray<FMORecipeIngredient>& Ingredients = Index.Rows[Top.Producer.RecipePosition]->Ingredients;
+
+		if (Top.NextIngredient < Ingredients.Num())
+		{
+			const FName Ingredient = Ingredients[Top.NextIngredient++].ItemDefinitionId;
+			if (const EVisit* Visit = Visits.Find(Ingredient))
+			{
+				if (*Visit == EVisit::OnStack)
+				{
+					Expansion.CyclicItems.AddUnique(Ingredient);
+				}
+				continue;
+			}
+
+			PushIfCrafted(Ingredient);
+			continue;
+		}
+
+		Visits[Top.ItemDefinitionId] = EVisit::Done;
+		Expansion.Items.Add(Top.ItemDefinitionId);
+		Expansion.Producers.Add(Top.Producer);
+		Stack.Pop(EAllowShrinking::No);
+	}
+
+	// Reverse post-order: target first, every item before its own ingredients.
+	Algo::Reverse(Expansion.Items);
+	Algo::Reverse(Expansion.Producers);
+
+	Expansion.OrderByItem.Reserve(Expansion.Items.Num());
+	for (int32 Order = 0; Order < Expansion.Items.Num(); ++Order)
+	{
+		Expansion.OrderByItem.Add(Expansion.Items[Order], Order);
+	}
+
+	return ExpansionMemo.Add(Key, MoveTemp(Expansion));
+}
+
+void FMOCraftingPlanner::BuildPlan(
+	const FMORecipeIndex& Index,
+	FName ItemDefinitionId,
+	int32 Quantity,
+	EMOCraftingStation Station,
+	TFunctionRef<bool(const FMORecipeDefinitionRow&)> CanUseRecipe,
+	TFunctionRef<int32(FName)> GetHeldQuantity,
+	FMOCraftingPlan& OutPlan)
+{
+	OutPlan = FMOCraftingPlan();
+
+	if (ItemDefinitionId.IsNone() || Quantity <= 0)
+	{
+		return;
+	}
+
+	const FExpansion& Expansion = Expand(Index, ItemDefinitionId, Station, CanUseRecipe);
+	if (Expansion.Items.Num() == 0)
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingSubsystem] PlanCraft: No recipe makes '%s' at this station"), *ItemDefinitionId.ToString());
+		return;
+	}
+
+	OutPlan.CyclicItems = Expansion.CyclicItems;
+
+	// Inventory view, read once per item and drawn down as the plan claims it.
+	TMap<FName, int32> Held;
+	auto HeldRef = [&Held, &GetHeldQuantity](FName Item) -> int32&
+	{
+		if (int32* Found = Held.Find(Item))
+		{
+			return *Found;
+		}
+		return Held.Add(Item, FMath::Max(0, GetHeldQuantity(Item)));
+	};
+
+	auto TakeFromInventory = [&OutPlan, &HeldRef](FName Item, int32 Amount)
+	{
+		int32& Available = HeldRef(Item);
+		const int32 Taken = FMath::Min(Available, Amount);
+		Available -= Taken;
+		if (Taken > 0)
+		{
+			OutPlan.ConsumedFromInventory.FindOrAdd(Item) += Taken;
+		}
+		return Amount - Taken;
+	};
+
+	// Demand is summed in int64 and saturates just past int32; a plan that needs more than that is rejected.
+	constexpr int64 DemandLimit = MAX_int32;
+	auto AddDemand = [](int64& Total, int64 Amount)
+	{
+		Total = FMath::Min(Total + Amount, DemandLimit + 1);
+	};
+	auto RejectOversized = [&OutPlan, ItemDefinitionId, Quantity](FName Item)
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOCraftingSubsystem] PlanCraft: %dx '%s' needs more '%s' than a plan can hold"),
+			Quantity, *ItemDefinitionId.ToString(), *Item.ToString());
+		OutPlan = FMOCraftingPlan();
+	};
+
+	// Items are visited target first, so all demand for an item is known before it is planned and each
+	// recipe becomes one batch.
+	TArray<int64> Demand;
+	Demand.SetNumZeroed(Expansion.Items.Num());
+	Demand[0] = Quantity;
+
+	TMap<FName, int64> RawDemand;
+
+	for (int32 Order = 0; Order < Expansion.Items.Num(); ++Order)
+	{
+		if (Demand[Order] > DemandLimit)
+		{
+			RejectOversized(Expansion.Items[Order]);
+			return;
+		}
+
+		int32 Needed = static_cast<int32>(Demand[Order]);
+		if (Order > 0)
+		{
+			Needed = TakeFromInventory(Expansion.Items[Order], Needed);
+		}
+
+		if (Needed <= 0)
+		{
+			continue;
+		}
+
+		const FProducer& Producer = Expansion.Producers[Order];
+		const int32 Crafts = FMath::DivideAndRoundUp(Needed, Producer.OutputQuantity);
+		FMOCraftingPlanStep& Step = OutPlan.Steps.AddDefaulted_GetRef();
+		Step.RecipeId = Index.Ids[Producer.RecipePosition];
+		Step.Count = Crafts;
+
+		for (const FMORecipeIngredient& Ingredient : Index.Rows[Producer.RecipePosition]->Ingredients)
+		{
+			const int64 Amount = static_cast<int64>(Ingredient.Quantity) * Crafts;
+			const int32* IngredientOrder = Expansion.OrderByItem.Find(Ingredient.ItemDefinitionId);
+
+			// Ingredients planned earlier in this walk close a cycle; they have to come from the inventory.
+			if (IngredientOrder && *IngredientOrder > Order)
+			{
+				AddDemand(Demand[*IngredientOrder], Amount);
+			}
+			else
+			{
+				AddDemand(RawDemand.FindOrAdd(Ingredient.ItemDefinitionId), Amount);
+			}
+		}
+	}
+
+	for (const TPair<FName, int64>& Raw : RawDemand)
+	{
+		if (Raw.Value > DemandLimit)
+		{
+			RejectOversized(Raw.Key);
+			return;
+		}
+	}
+
+	for (const TPair<FName, int64>& Raw : RawDemand)
+	{
+		const int32 Short = TakeFromInventory(Raw.Key, static_cast<int32>(Raw.Value));
+		if (Short > 0)
+		{
+			OutPlan.MissingMaterials.Add(Raw.Key, Short);
+		}
+	}
+
+	Algo::Reverse(OutPlan.Steps);
+	OutPlan.bSuccess = OutPlan.MissingMaterials.Num() == 0;
+}
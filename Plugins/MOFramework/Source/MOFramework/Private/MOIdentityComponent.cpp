@@ -1,5 +1,6 @@
 #include "MOIdentityComponent.h"
 
+#include "MOIdentityRegistrySubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
 #include "Net/UnrealNetwork.h"
@@ -162,6 +163,28 @@ FGuid UMOIdentityComponent::GetOrCreateGuid()
 	return StableGuid;
 }
 
+void UMOIdentityComponent::ReleaseGuid()
+{
+	AActor* OwnerActor = GetOwner();
+	if (!OwnerActor || !OwnerActor->HasAuthority() || !StableGuid.IsValid())
+	{
+		return;
+	}
+
+	const FGuid ReleasedGuid = StableGuid;
+	StableGuid.Invalidate();
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UMOIdentityRegistrySubsystem* Registry = World->GetSubsystem<UMOIdentityRegistrySubsystem>())
+		{
+			Registry->ReleaseGuidForActor(OwnerActor);
+		}
+	}
+
+	OnOwnerDestroyedWithGuid.Broadcast(ReleasedGuid);
+}
+
 void UMOIdentityComponent::RegenerateGuid()
 {
 	StableGuid = FGuid::NewGuid();
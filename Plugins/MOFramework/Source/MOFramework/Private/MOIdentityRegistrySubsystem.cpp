@@ -189,6 +189,28 @@ void UMOIdentityRegistrySubsystem::RegisterGuidForActor(const FGuid& Guid, AActo
 	}
 }
 
+void UMOIdentityRegistrySubsystem::ReleaseGuidForActor(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	FGuid ReleasedGuid;
+	if (!ActorToGuid.RemoveAndCopyValue(Actor, ReleasedGuid))
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<AActor>* MappedActor = GuidToActor.Find(ReleasedGuid);
+	if (MappedActor && MappedActor->Get() == Actor)
+	{
+		GuidToActor.Remove(ReleasedGuid);
+	}
+
+	OnIdentityUnregistered.Broadcast(ReleasedGuid, Actor);
+}
+
 void UMOIdentityRegistrySubsystem::UnregisterActor(AActor* Actor)
 {
 	if (!Actor)
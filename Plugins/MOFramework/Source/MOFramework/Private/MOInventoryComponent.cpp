@@ -9,6 +9,7 @@
 #include "MOItemDatabaseSettings.h"
 #include "MOItemDefinitionRow.h"
 #include "MOWorldItem.h"
+#include "MOWorldItemPoolSubsystem.h"
 #include "MOItemComponent.h"
 #include "MOIdentityComponent.h"
 #include "MOPersistenceSubsystem.h"
@@ -42,193 +43,1017 @@ void UMOInventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
 	DOREPLIFETIME_CONDITION(UMOInventoryComponent, Inventory, COND_OwnerOnly);
-	DOREPLIFETIME_CONDITION(UMOInventoryComponent, SlotItemGuids, COND_OwnerOnly);
+	DOREPLIFETIME_CONDITION_NOTIFY(UMOInventoryComponent, SlotCount, COND_OwnerOnly, REPNOTIFY_Always);
 }
 
 int32 UMOInventoryComponent::FindEntryIndexByGuid(const FGuid& ItemGuid) const
 {
-	if (!ItemGuid.IsValid())
+	return Inventory.FindIndexByGuid(ItemGuid);
+}
+
+bool UMOInventoryComponent::AddItemByGuid(const FGuid& ItemGuid, const FName ItemDefinitionId, int32 QuantityToAdd)
+{
+	return AddItemInternal(ItemGuid, ItemDefinitionId, QuantityToAdd, nullptr);
+}
+
+bool UMOInventoryComponent::AddItemInternal(const FGuid& ItemGuid, FName ItemDefinitionId, int32 QuantityToAdd, TArray<FGuid>* OutNewStackGuids)
+{
+	AActor* OwnerActor = GetOwner();
+	if (!IsValid(OwnerActor) || !OwnerActor->HasAuthority())
 	{
-		return INDEX_NONE;
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] AddItemByGuid requires authority"));
+		return false;
+	}
+
+	if (!ItemGuid.IsValid() || ItemDefinitionId.IsNone() || QuantityToAdd <= 0)
+	{
+		return false;
+	}
+
+	EnsureSlotsInitialized();
+
+	const int32 ExistingIndex = FindEntryIndexByGuid(ItemGuid);
+	if (ExistingIndex != INDEX_NONE)
+	{
+		FMOInventoryEntry& ExistingEntry = Inventory.Entries[ExistingIndex];
+		ExistingEntry.Quantity += QuantityToAdd;
+		Inventory.RecountEntry(ExistingEntry);
+		NoteEntrySlotChanged(ItemGuid);
+
+		MarkEntryDirty(ExistingEntry);
+		BroadcastInventoryChanged();
+
+		// Slot array unchanged.
+		return true;
+	}
+
+	int32 Remaining = QuantityToAdd;
+	if (bAutoStackNewItems)
+	{
+		Remaining = FillExistingStacks(ItemDefinitionId, Remaining);
+	}
+
+	// Whatever did not fit goes into new stacks; the first one keeps the caller's GUID. A limit of 1
+	// means the definition does not stack, so the whole quantity stays in that one entry.
+	const int32 StackLimit = bAutoStackNewItems ? GetMaxStackSize(ItemDefinitionId) : 1;
+	const int32 MaxStackSize = StackLimit > 1 ? StackLimit : MAX_int32;
+
+	// Never open more stacks than there are empty slots to show them; the last one keeps the overflow,
+	// as CompactStacks does for stacks that are already over the limit.
+	int32 StacksLeft = 0;
+	for (const FGuid& SlotGuid : SlotItemGuids)
+	{
+		StacksLeft += SlotGuid.IsValid() ? 0 : 1;
+	}
+	StacksLeft = FMath::Max(StacksLeft, 1);
+
+	bool bSlotsChanged = false;
+	FGuid StackGuid = ItemGuid;
+	while (Remaining > 0)
+	{
+		FMOInventoryEntry NewEntry;
+		NewEntry.ItemGuid = StackGuid;
+		NewEntry.ItemDefinitionId = ItemDefinitionId;
+		NewEntry.Quantity = --StacksLeft > 0 ? FMath::Min(Remaining, MaxStackSize) : Remaining;
+		Remaining -= NewEntry.Quantity;
+
+		const int32 NewIndex = Inventory.AddEntry(NewEntry);
+		MarkEntryDirty(Inventory.Entries[NewIndex]);
+		if (OutNewStackGuids)
+		{
+			OutNewStackGuids->Add(StackGuid);
+		}
+
+		// Optionally slot into first empty slot.
+		bSlotsChanged |= TryAutoAssignGuidToEmptySlot(StackGuid);
+		StackGuid = FGuid::NewGuid();
+	}
+
+	BroadcastInventoryChanged();
+	if (bSlotsChanged)
+	{
+		BroadcastSlotsChanged();
+	}
+
+	return true;
+}
+
+bool UMOInventoryComponent::RemoveItemByGuid(const FGuid& ItemGuid, int32 QuantityToRemove)
+{
+	AActor* OwnerActor = GetOwner();
+	if (!IsValid(OwnerActor) || !OwnerActor->HasAuthority())
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] RemoveItemByGuid requires authority"));
+		return false;
+	}
+
+	if (!ItemGuid.IsValid() || QuantityToRemove <= 0)
+	{
+		return false;
+	}
+
+	const int32 ExistingIndex = FindEntryIndexByGuid(ItemGuid);
+	if (ExistingIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FMOInventoryEntry& ExistingEntry = Inventory.Entries[ExistingIndex];
+
+	// Remove entirely
+	if (ExistingEntry.Quantity <= QuantityToRemove)
+	{
+		RemoveGuidFromSlotsInternal(ItemGuid);
+		BroadcastSlotsChanged();
+
+		Inventory.RemoveEntryAt(ExistingIndex);
+		MarkEntriesArrayDirty();
+		BroadcastInventoryChanged();
+		return true;
+	}
+
+	// Subtract quantity, keep entry
+	ExistingEntry.Quantity -= QuantityToRemove;
+	Inventory.RecountEntry(ExistingEntry);
+	NoteEntrySlotChanged(ItemGuid);
+	MarkEntryDirty(ExistingEntry);
+	BroadcastInventoryChanged();
+	return true;
+}
+
+bool UMOInventoryComponent::TryGetEntryByGuid(const FGuid& ItemGuid, FMOInventoryEntry& OutEntry) const
+{
+	OutEntry = FMOInventoryEntry();
+
+	const int32 ExistingIndex = FindEntryIndexByGuid(ItemGuid);
+	if (ExistingIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	OutEntry = Inventory.Entries[ExistingIndex];
+	return true;
+}
+
+int32 UMOInventoryComponent::GetEntryCount() const
+{
+	return Inventory.Entries.Num();
+}
+
+int32 UMOInventoryComponent::GetTotalQuantityByDefinition(FName ItemDefinitionId) const
+{
+	return Inventory.GetTotalQuantity(ItemDefinitionId);
+}
+
+void UMOInventoryComponent::GetInventoryEntries(TArray<FMOInventoryEntry>& OutEntries) const
+{
+	OutEntries = Inventory.Entries;
+}
+
+FString UMOInventoryComponent::GetInventoryDebugString() const
+{
+	FString Result;
+
+	for (const FMOInventoryEntry& Entry : Inventory.Entries)
+	{
+		Result += FString::Printf(
+			TEXT("Guid=%s Def=%s Qty=%d\n"),
+			*Entry.ItemGuid.ToString(EGuidFormats::Short),
+			*Entry.ItemDefinitionId.ToString(),
+			Entry.Quantity
+		);
+	}
+
+	if (Result.IsEmpty())
+	{
+		Result = TEXT("(empty)");
 	}
 
+	return Result;
+}
+
+/*
+ * Stacking
+ */
+namespace
+{
+	/** Order stacks so the lowest slot fills first; unslotted stacks come last in array order. */
+	void SortStacksBySlot(const TArray<FMOInventoryEntry>& Entries, TArray<int32>& InOutEntryIndices)
+	{
+		InOutEntryIndices.Sort([&Entries](int32 IndexA, int32 IndexB)
+		{
+			// As unsigned, INDEX_NONE sorts after every real slot.
+			const uint32 SlotA = static_cast<uint32>(Entries[IndexA].SlotIndex);
+			const uint32 SlotB = static_cast<uint32>(Entries[IndexB].SlotIndex);
+			return SlotA != SlotB ? SlotA < SlotB : IndexA < IndexB;
+		});
+	}
+}
+
+int32 UMOInventoryComponent::GetMaxStackSize(FName ItemDefinitionId) const
+{
+	const FMOItemDefinitionRow* Definition = UMOItemDatabaseSettings::FindItemDefinition(ItemDefinitionId);
+	return FMath::Max(1, Definition ? Definition->MaxStackSize : FallbackMaxStackSize);
+}
+
+int32 UMOInventoryComponent::FillExistingStacks(FName ItemDefinitionId, int32 Quantity)
+{
+	const int32 MaxStackSize = GetMaxStackSize(ItemDefinitionId);
+	if (MaxStackSize <= 1 || Inventory.GetTotalQuantity(ItemDefinitionId) <= 0)
+	{
+		return Quantity;
+	}
+
+	TArray<int32> StackIndices;
 	for (int32 EntryIndex = 0; EntryIndex < Inventory.Entries.Num(); ++EntryIndex)
 	{
-		if (Inventory.Entries[EntryIndex].ItemGuid == ItemGuid)
+		const FMOInventoryEntry& Entry = Inventory.Entries[EntryIndex];
+		if (Entry.ItemDefinitionId == ItemDefinitionId && Entry.Quantity < MaxStackSize)
+		{
+			StackIndices.Add(EntryIndex);
+		}
+	}
+	SortStacksBySlot(Inventory.Entries, StackIndices);
+
+	for (const int32 EntryIndex : StackIndices)
+	{
+		if (Quantity <= 0)
 		{
-			return EntryIndex;
+			break;
 		}
+
+		FMOInventoryEntry& Entry = Inventory.Entries[EntryIndex];
+		const int32 Moved = FMath::Min(Quantity, MaxStackSize - Entry.Quantity);
+		Entry.Quantity += Moved;
+		Quantity -= Moved;
+
+		Inventory.RecountEntry(Entry);
+		NoteSlotChanged(Entry.SlotIndex);
+		MarkEntryDirty(Entry);
 	}
 
-	return INDEX_NONE;
+	return Quantity;
 }
 
-bool UMOInventoryComponent::AddItemByGuid(const FGuid& ItemGuid, const FName ItemDefinitionId, int32 QuantityToAdd)
+bool UMOInventoryComponent::MergeStacks(const FGuid& SourceGuid, const FGuid& TargetGuid)
 {
 	AActor* OwnerActor = GetOwner();
 	if (!IsValid(OwnerActor) || !OwnerActor->HasAuthority())
 	{
-		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] AddItemByGuid requires authority"));
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] MergeStacks requires authority"));
 		return false;
 	}
 
-	if (!ItemGuid.IsValid() || ItemDefinitionId.IsNone() || QuantityToAdd <= 0)
+	if (SourceGuid == TargetGuid)
+	{
+		return false;
+	}
+
+	const int32 SourceIndex = FindEntryIndexByGuid(SourceGuid);
+	const int32 TargetIndex = FindEntryIndexByGuid(TargetGuid);
+	if (SourceIndex == INDEX_NONE || TargetIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	FMOInventoryEntry& Source = Inventory.Entries[SourceIndex];
+	FMOInventoryEntry& Target = Inventory.Entries[TargetIndex];
+	if (Source.ItemDefinitionId != Target.ItemDefinitionId)
+	{
+		return false;
+	}
+
+	const int32 Moved = FMath::Min(Source.Quantity, GetMaxStackSize(Target.ItemDefinitionId) - Target.Quantity);
+	if (Moved <= 0)
 	{
 		return false;
 	}
 
+	Target.Quantity += Moved;
+	Inventory.RecountEntry(Target);
+	NoteSlotChanged(Target.SlotIndex);
+	MarkEntryDirty(Target);
+
+	if (Moved < Source.Quantity)
+	{
+		Source.Quantity -= Moved;
+		Inventory.RecountEntry(Source);
+		NoteSlotChanged(Source.SlotIndex);
+		MarkEntryDirty(Source);
+	}
+	else
+	{
+		const bool bWasSlotted = Source.SlotIndex != INDEX_NONE;
+		RemoveGuidFromSlotsInternal(SourceGuid);
+		Inventory.RemoveEntryAt(SourceIndex);
+		MarkEntriesArrayDirty();
+
+		if (bWasSlotted)
+		{
+			BroadcastSlotsChanged();
+		}
+	}
+
+	BroadcastInventoryChanged();
+	return true;
+}
+
+bool UMOInventoryComponent::SplitStack(const FGuid& ItemGuid, int32 SplitQuantity, int32 TargetSlotIndex, FGuid& OutNewItemGuid)
+{
+	OutNewItemGuid.Invalidate();
+
+	AActor* OwnerActor = GetOwner();
+	if (!IsValid(OwnerActor) || !OwnerActor->HasAuthority())
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] SplitStack requires authority"));
+		return false;
+	}
+
 	EnsureSlotsInitialized();
 
-	const int32 ExistingIndex = FindEntryIndexByGuid(ItemGuid);
-	if (ExistingIndex != INDEX_NONE)
+	const int32 SourceIndex = FindEntryIndexByGuid(ItemGuid);
+	if (SourceIndex == INDEX_NONE || SplitQuantity <= 0 || SplitQuantity >= Inventory.Entries[SourceIndex].Quantity)
 	{
-		FMOInventoryEntry& ExistingEntry = Inventory.Entries[ExistingIndex];
-		ExistingEntry.Quantity += QuantityToAdd;
+		return false;
+	}
+
+	FMOInventoryEntry& Source = Inventory.Entries[SourceIndex];
+	Source.Quantity -= SplitQuantity;
+	Inventory.RecountEntry(Source);
+	NoteSlotChanged(Source.SlotIndex);
+	MarkEntryDirty(Source);
+
+	FMOInventoryEntry NewEntry;
+	NewEntry.ItemGuid = FGuid::NewGuid();
+	NewEntry.ItemDefinitionId = Source.ItemDefinitionId;
+	NewEntry.Quantity = SplitQuantity;
+
+	const int32 NewIndex = Inventory.AddEntry(NewEntry);
+	MarkEntryDirty(Inventory.Entries[NewIndex]);
+
+	int32 SplitSlotIndex = TargetSlotIndex;
+	if (!IsSlotIndexValid(SplitSlotIndex) || SlotItemGuids[SplitSlotIndex].IsValid())
+	{
+		FindFirstEmptySlot(SplitSlotIndex);
+	}
+
+	if (SplitSlotIndex != INDEX_NONE)
+	{
+		WriteSlotGuid(SplitSlotIndex, NewEntry.ItemGuid);
+		BroadcastSlotsChanged();
+	}
+
+	BroadcastInventoryChanged();
+	OutNewItemGuid = NewEntry.ItemGuid;
+	return true;
+}
+
+int32 UMOInventoryComponent::CompactStacks()
+{
+	AActor* OwnerActor = GetOwner();
+	if (!IsValid(OwnerActor) || !OwnerActor->HasAuthority())
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] CompactStacks requires authority"));
+		return 0;
+	}
+
+	// One pass to group, then each definition is refilled front to back; emptied stacks are removed afterwards.
+	TMap<FName, TArray<int32>> StacksByDefinition;
+	for (int32 EntryIndex = 0; EntryIndex < Inventory.Entries.Num(); ++EntryIndex)
+	{
+		StacksByDefinition.FindOrAdd(Inventory.Entries[EntryIndex].ItemDefinitionId).Add(EntryIndex);
+	}
+
+	FMOInventoryTransactionScope Transaction(this);
+
+	bool bChanged = false;
+	TArray<FGuid> EmptiedGuids;
+	for (TPair<FName, TArray<int32>>& DefinitionStacks : StacksByDefinition)
+	{
+		TArray<int32>& StackIndices = DefinitionStacks.Value;
+		const int32 MaxStackSize = GetMaxStackSize(DefinitionStacks.Key);
+		if (StackIndices.Num() < 2 || MaxStackSize <= 1)
+		{
+			continue;
+		}
+
+		SortStacksBySlot(Inventory.Entries, StackIndices);
+
+		int64 Remaining = 0;
+		for (const int32 EntryIndex : StackIndices)
+		{
+			Remaining += Inventory.Entries[EntryIndex].Quantity;
+		}
+
+		for (int32 StackIndex = 0; StackIndex < StackIndices.Num(); ++StackIndex)
+		{
+			FMOInventoryEntry& Entry = Inventory.Entries[StackIndices[StackIndex]];
+
+			// The last stack keeps any overflow from stacks that were already over the limit.
+			const bool bLastStack = StackIndex == StackIndices.Num() - 1;
+			const int32 NewQuantity = static_cast<int32>(bLastStack ? Remaining : FMath::Min<int64>(Remaining, MaxStackSize));
+			Remaining -= NewQuantity;
 
-		Inventory.MarkItemDirty(ExistingEntry);
+			if (NewQuantity == Entry.Quantity)
+			{
+				continue;
+			}
+
+			bChanged = true;
+			if (NewQuantity <= 0)
+			{
+				EmptiedGuids.Add(Entry.ItemGuid);
+				continue;
+			}
+
+			Entry.Quantity = NewQuantity;
+			Inventory.RecountEntry(Entry);
+			NoteSlotChanged(Entry.SlotIndex);
+			MarkEntryDirty(Entry);
+		}
+	}
+
+	for (const FGuid& EmptiedGuid : EmptiedGuids)
+	{
+		RemoveGuidFromSlotsInternal(EmptiedGuid);
+		Inventory.RemoveEntryAt(FindEntryIndexByGuid(EmptiedGuid));
+	}
+
+	if (EmptiedGuids.Num() > 0)
+	{
+		MarkEntriesArrayDirty();
+		BroadcastSlotsChanged();
+	}
+
+	if (bChanged)
+	{
 		BroadcastInventoryChanged();
+	}
 
-		// Slot array unchanged.
+	return EmptiedGuids.Num();
+}
+
+void UMOInventoryComponent::BroadcastInventoryChanged()
+{
+	if (TransactionDepth > 0)
+	{
+		bPendingInventoryBroadcast = true;
+		return;
+	}
+
+	OnInventoryChanged.Broadcast();
+	FlushSlotContentsChanged();
+	FlushItemTotalsChanged();
+}
+
+void UMOInventoryComponent::BroadcastSlotsChanged()
+{
+	if (TransactionDepth > 0)
+	{
+		bPendingSlotsBroadcast = true;
+		return;
+	}
+
+	OnSlotsChanged.Broadcast();
+	FlushSlotContentsChanged();
+	FlushItemTotalsChanged();
+}
+
+void UMOInventoryComponent::NoteSlotChanged(int32 SlotIndex)
+{
+	if (SlotIndex != INDEX_NONE)
+	{
+		PendingChangedSlots.Add(SlotIndex);
+	}
+}
+
+void UMOInventoryComponent::NoteEntrySlotChanged(const FGuid& ItemGuid)
+{
+	NoteSlotChanged(FindSlotIndexByGuid(ItemGuid));
+}
+
+void UMOInventoryComponent::NoteAllSlotsChanged()
+{
+	bPendingAllSlotsChanged = true;
+}
+
+void UMOInventoryComponent::FlushSlotContentsChanged()
+{
+	if (TransactionDepth > 0 || (!bPendingAllSlotsChanged && PendingChangedSlots.Num() == 0))
+	{
+		return;
+	}
+
+	TArray<int32> ChangedSlots;
+	if (bPendingAllSlotsChanged)
+	{
+		ChangedSlots.Reserve(SlotItemGuids.Num());
+		for (int32 SlotIndex = 0; SlotIndex < SlotItemGuids.Num(); ++SlotIndex)
+		{
+			ChangedSlots.Add(SlotIndex);
+		}
+	}
+	else
+	{
+		ChangedSlots = PendingChangedSlots.Array();
+		ChangedSlots.Sort();
+	}
+
+	PendingChangedSlots.Reset();
+	bPendingAllSlotsChanged = false;
+
+	OnSlotContentsChanged.Broadcast(ChangedSlots);
+}
+
+void UMOInventoryComponent::FlushItemTotalsChanged()
+{
+	if (TransactionDepth > 0)
+	{
+		return;
+	}
+
+	TArray<FName> ChangedDefinitions;
+	Inventory.ConsumeChangedDefinitions(ChangedDefinitions);
+	if (ChangedDefinitions.Num() > 0)
+	{
+		OnItemTotalsChanged.Broadcast(ChangedDefinitions);
+	}
+}
+
+void UMOInventoryComponent::MarkEntryDirty(FMOInventoryEntry& Entry)
+{
+	if (TransactionDepth > 0)
+	{
+		PendingDirtyGuids.Add(Entry.ItemGuid);
+		return;
+	}
+
+	Inventory.MarkItemDirty(Entry);
+}
+
+void UMOInventoryComponent::MarkEntriesArrayDirty()
+{
+	if (TransactionDepth > 0)
+	{
+		bPendingArrayDirty = true;
+		return;
+	}
+
+	Inventory.MarkArrayDirty();
+}
+
+/*
+ * Transactions
+ */
+bool UMOInventoryComponent::BeginTransaction()
+{
+	AActor* OwnerActor = GetOwner();
+	if (!IsValid(OwnerActor) || !OwnerActor->HasAuthority())
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] BeginTransaction requires authority"));
+		return false;
+	}
+
+	// Nested transactions join the outermost one.
+	if (TransactionDepth++ > 0)
+	{
 		return true;
 	}
 
-	FMOInventoryEntry NewEntry;
-	NewEntry.ItemGuid = ItemGuid;
-	NewEntry.ItemDefinitionId = ItemDefinitionId;
-	NewEntry.Quantity = QuantityToAdd;
+	// Zero means "none open"; skip it on wrap.
+	if (++TransactionId == 0)
+	{
+		++TransactionId;
+	}
+
+	TransactionEntriesSnapshot = Inventory.Entries;
+	TransactionSlotsSnapshot = SlotItemGuids;
+	TransactionSlotCountSnapshot = SlotCount;
+	return true;
+}
+
+bool UMOInventoryComponent::CommitTransaction()
+{
+	if (TransactionDepth <= 0)
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] CommitTransaction without BeginTransaction"));
+		return false;
+	}
+
+	if (--TransactionDepth > 0)
+	{
+		return true;
+	}
+
+	// Entries added during the transaction get their replication IDs here.
+	for (const FGuid& DirtyGuid : PendingDirtyGuids)
+	{
+		const int32 EntryIndex = FindEntryIndexByGuid(DirtyGuid);
+		if (EntryIndex != INDEX_NONE)
+		{
+			Inventory.MarkItemDirty(Inventory.Entries[EntryIndex]);
+		}
+	}
+
+	if (bPendingArrayDirty)
+	{
+		Inventory.MarkArrayDirty();
+	}
+
+	const bool bBroadcastInventory = bPendingInventoryBroadcast;
+	const bool bBroadcastSlots = bPendingSlotsBroadcast;
+	ResetTransactionState();
+
+	if (bBroadcastInventory)
+	{
+		OnInventoryChanged.Broadcast();
+	}
+	if (bBroadcastSlots)
+	{
+		OnSlotsChanged.Broadcast();
+	}
+	FlushSlotContentsChanged();
+	FlushItemTotalsChanged();
+
+	return true;
+}
+
+void UMOInventoryComponent::RollbackTransaction()
+{
+	if (TransactionDepth <= 0)
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] RollbackTransaction without BeginTransaction"));
+		return;
+	}
+
+	if (TransactionDepth > 1)
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] RollbackTransaction inside a nested transaction; rolling back the outermost one"));
+	}
+
+	// Nothing was marked dirty or broadcast yet, so restoring local state is enough.
+	Inventory.Entries = MoveTemp(TransactionEntriesSnapshot);
+	Inventory.InvalidateIndex();
+	Inventory.RebuildTotals();
+	Inventory.DiscardChangedDefinitions();
+
+	SlotItemGuids = MoveTemp(TransactionSlotsSnapshot);
+	SlotCount = TransactionSlotCountSnapshot;
+	InvalidateSlotIndex();
+
+	TransactionDepth = 0;
+	ResetTransactionState();
+	PendingChangedSlots.Reset();
+	bPendingAllSlotsChanged = false;
+}
+
+void UMOInventoryComponent::ResetTransactionState()
+{
+	TransactionEntriesSnapshot.Reset();
+	TransactionSlotsSnapshot.Reset();
+	PendingDirtyGuids.Reset();
+	bPendingArrayDirty = false;
+	bPendingInventoryBroadcast = false;
+	bPendingSlotsBroadcast = false;
+}
+
+FMOInventoryTransactionScope::FMOInventoryTransactionScope(UMOInventoryComponent* InInventory)
+	: Inventory(InInventory)
+{
+	bOpen = IsValid(InInventory) && InInventory->BeginTransaction();
+	TransactionId = bOpen ? InInventory->GetOpenTransactionId() : 0;
+}
+
+FMOInventoryTransactionScope::~FMOInventoryTransactionScope()
+{
+	// A nested scope may have rolled the whole transaction back already.
+	if (IsOpen())
+	{
+		Inventory->CommitTransaction();
+	}
+}
+
+void FMOInventoryTransactionScope::Rollback()
+{
+	if (IsOpen())
+	{
+		Inventory->RollbackTransaction();
+	}
+	bOpen = false;
+}
+
+/*
+ * Inventory entry: interned definition and wire format.
+ */
+const FMOItemDefinitionRow* FMOInventoryEntry::GetDefinition() const
+{
+	// The handle goes stale if ItemDefinitionId is edited without a recount or the table is reimported.
+	if (DefinitionHandle.IsValid() && UMOItemDatabaseSettings::GetItemDefinitionIdByHandle(DefinitionHandle) == ItemDefinitionId)
+	{
+		return UMOItemDatabaseSettings::GetItemDefinitionByHandle(DefinitionHandle);
+	}
+
+	return UMOItemDatabaseSettings::FindItemDefinition(ItemDefinitionId);
+}
+
+bool FMOInventoryEntry::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Ar << ItemGuid;
+
+	// The definition always travels by name: handles are row positions in this process's table and
+	// nothing guarantees the peer built the same one. The receiver interns its own handle.
+	Ar << ItemDefinitionId;
+
+	// Quantity is never negative and the slot is sent +1, so the common small values pack into a byte.
+	uint32 PackedQuantity = static_cast<uint32>(FMath::Max(Quantity, 0));
+	uint32 PackedSlot = static_cast<uint32>(FMath::Max(SlotIndex + 1, 0));
+	Ar.SerializeIntPacked(PackedQuantity);
+	Ar.SerializeIntPacked(PackedSlot);
+
+	if (Ar.IsLoading())
+	{
+		DefinitionHandle = UMOItemDatabaseSettings::GetItemDefinitionHandle(ItemDefinitionId);
+		Quantity = static_cast<int32>(PackedQuantity);
+		SlotIndex = static_cast<int32>(PackedSlot) - 1;
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+/*
+ * GUID index over the entry array.
+ */
+int32 FMOInventoryList::FindIndexByGuid(const FGuid& ItemGuid) const
+{
+	if (!ItemGuid.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	if (bIndexDirty)
+	{
+		RebuildIndex();
+	}
+
+	const int32* FoundIndex = IndexByGuid.Find(ItemGuid);
+	if (!FoundIndex)
+	{
+		return INDEX_NONE;
+	}
+
+	// A replicated change can rewrite an entry in place; never trust a stale slot.
+	if (!Entries.IsValidIndex(*FoundIndex) || Entries[*FoundIndex].ItemGuid != ItemGuid)
+	{
+		RebuildIndex();
+		FoundIndex = IndexByGuid.Find(ItemGuid);
+		return FoundIndex ? *FoundIndex : INDEX_NONE;
+	}
+
+	return *FoundIndex;
+}
+
+int32 FMOInventoryList::AddEntry(const FMOInventoryEntry& NewEntry)
+{
+	const int32 NewIndex = Entries.Add(NewEntry);
+	Entries[NewIndex].CountedDefinitionId = NAME_None;
+	Entries[NewIndex].CountedQuantity = 0;
+	RecountEntry(Entries[NewIndex]);
+
+	if (!bIndexDirty && NewEntry.ItemGuid.IsValid())
+	{
+		IndexByGuid.Add(NewEntry.ItemGuid, NewIndex);
+	}
+	return NewIndex;
+}
+
+void FMOInventoryList::RemoveEntryAt(int32 EntryIndex)
+{
+	if (!Entries.IsValidIndex(EntryIndex))
+	{
+		return;
+	}
+
+	// Entry order carries no meaning (slots hold the layout), so swap-remove keeps this O(1).
+	UncountEntry(Entries[EntryIndex]);
+
+	const FGuid RemovedGuid = Entries[EntryIndex].ItemGuid;
+	Entries.RemoveAtSwap(EntryIndex);
 
-	const int32 NewIndex = Inventory.Entries.Add(NewEntry);
-	Inventory.MarkItemDirty(Inventory.Entries[NewIndex]);
-	BroadcastInventoryChanged();
+	if (bIndexDirty)
+	{
+		return;
+	}
 
-	// Optionally slot into first empty slot.
-	if (TryAutoAssignGuidToEmptySlot(ItemGuid))
+	IndexByGuid.Remove(RemovedGuid);
+	if (Entries.IsValidIndex(EntryIndex) && Entries[EntryIndex].ItemGuid.IsValid())
 	{
-		MarkSlotItemGuidsDirty();
-		OnSlotsChanged.Broadcast();
+		IndexByGuid.Add(Entries[EntryIndex].ItemGuid, EntryIndex);
 	}
+}
 
-	return true;
+void FMOInventoryList::ResetEntries()
+{
+	Entries.Reset();
+	IndexByGuid.Reset();
+
+	for (const TPair<FName, int32>& Total : QuantityTotals)
+	{
+		ChangedDefinitions.Add(Total.Key);
+	}
+	QuantityTotals.Reset();
+	bIndexDirty = false;
 }
 
-bool UMOInventoryComponent::RemoveItemByGuid(const FGuid& ItemGuid, int32 QuantityToRemove)
+/*
+ * Per-definition quantity totals.
+ */
+void FMOInventoryList::RecountEntry(FMOInventoryEntry& Entry)
 {
-	AActor* OwnerActor = GetOwner();
-	if (!IsValid(OwnerActor) || !OwnerActor->HasAuthority())
+	// Every add/change passes through here, so this is where the cached handle follows the definition.
+	Entry.DefinitionHandle = UMOItemDatabaseSettings::GetItemDefinitionHandle(Entry.ItemDefinitionId);
+
+	// Slot moves and other non-quantity edits land here too; leave the totals (and change tracking) alone.
+	if (Entry.CountedQuantity == Entry.Quantity && Entry.CountedDefinitionId == Entry.ItemDefinitionId && Entry.Quantity != 0)
 	{
-		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] RemoveItemByGuid requires authority"));
-		return false;
+		return;
 	}
 
-	if (!ItemGuid.IsValid() || QuantityToRemove <= 0)
+	UncountEntry(Entry);
+
+	if (!Entry.ItemDefinitionId.IsNone() && Entry.Quantity != 0)
 	{
-		return false;
+		Entry.CountedDefinitionId = Entry.ItemDefinitionId;
+		Entry.CountedQuantity = Entry.Quantity;
+		AdjustTotal(Entry.CountedDefinitionId, Entry.CountedQuantity);
 	}
+}
 
-	const int32 ExistingIndex = FindEntryIndexByGuid(ItemGuid);
-	if (ExistingIndex == INDEX_NONE)
+void FMOInventoryList::UncountEntry(FMOInventoryEntry& Entry)
+{
+	if (Entry.CountedQuantity != 0)
 	{
-		return false;
+		AdjustTotal(Entry.CountedDefinitionId, -Entry.CountedQuantity);
 	}
 
-	FMOInventoryEntry& ExistingEntry = Inventory.Entries[ExistingIndex];
+	Entry.CountedDefinitionId = NAME_None;
+	Entry.CountedQuantity = 0;
+}
 
-	// Remove entirely
-	if (ExistingEntry.Quantity <= QuantityToRemove)
+void FMOInventoryList::AdjustTotal(FName ItemDefinitionId, int32 Delta)
+{
+	int32& Total = QuantityTotals.FindOrAdd(ItemDefinitionId);
+	Total += Delta;
+	if (Total == 0)
 	{
-		RemoveGuidFromSlotsInternal(ItemGuid);
-		MarkSlotItemGuidsDirty();
-		OnSlotsChanged.Broadcast();
-
-		Inventory.Entries.RemoveAt(ExistingIndex);
-		Inventory.MarkArrayDirty();
-		BroadcastInventoryChanged();
-		return true;
+		QuantityTotals.Remove(ItemDefinitionId);
 	}
 
-	// Subtract quantity, keep entry
-	ExistingEntry.Quantity -= QuantityToRemove;
-	Inventory.MarkItemDirty(ExistingEntry);
-	BroadcastInventoryChanged();
-	return true;
+	ChangedDefinitions.Add(ItemDefinitionId);
 }
 
-bool UMOInventoryComponent::TryGetEntryByGuid(const FGuid& ItemGuid, FMOInventoryEntry& OutEntry) const
+void FMOInventoryList::ConsumeChangedDefinitions(TArray<FName>& OutItemDefinitionIds)
 {
-	OutEntry = FMOInventoryEntry();
+	OutItemDefinitionIds = ChangedDefinitions.Array();
+	ChangedDefinitions.Reset();
+}
 
-	const int32 ExistingIndex = FindEntryIndexByGuid(ItemGuid);
-	if (ExistingIndex == INDEX_NONE)
+void FMOInventoryList::RebuildTotals()
+{
+	QuantityTotals.Reset();
+	for (FMOInventoryEntry& Entry : Entries)
 	{
-		return false;
+		Entry.CountedDefinitionId = NAME_None;
+		Entry.CountedQuantity = 0;
+		RecountEntry(Entry);
 	}
-
-	OutEntry = Inventory.Entries[ExistingIndex];
-	return true;
 }
 
-int32 UMOInventoryComponent::GetEntryCount() const
+int32 FMOInventoryList::GetTotalQuantity(FName ItemDefinitionId) const
 {
-	return Inventory.Entries.Num();
+	const int32* Total = QuantityTotals.Find(ItemDefinitionId);
+	return Total ? *Total : 0;
 }
 
-void UMOInventoryComponent::GetInventoryEntries(TArray<FMOInventoryEntry>& OutEntries) const
+void FMOInventoryList::RebuildIndex() const
 {
-	OutEntries = Inventory.Entries;
+	IndexByGuid.Reset();
+	IndexByGuid.Reserve(Entries.Num());
+
+	for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+	{
+		const FGuid& ItemGuid = Entries[EntryIndex].ItemGuid;
+		if (ItemGuid.IsValid() && !IndexByGuid.Contains(ItemGuid))
+		{
+			IndexByGuid.Add(ItemGuid, EntryIndex);
+		}
+	}
+
+	bIndexDirty = false;
 }
 
-FString UMOInventoryComponent::GetInventoryDebugString() const
+/*
+ * Fast array replication notifications.
+ */
+void FMOInventoryList::PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 /*FinalSize*/)
 {
-	FString Result;
-
-	for (const FMOInventoryEntry& Entry : Inventory.Entries)
+	bool bSlotsMoved = false;
+	for (const int32 AddedIndex : AddedIndices)
 	{
-		Result += FString::Printf(
-			TEXT("Guid=%s Def=%s Qty=%d\n"),
-			*Entry.ItemGuid.ToString(EGuidFormats::Short),
-			*Entry.ItemDefinitionId.ToString(),
-			Entry.Quantity
-		);
+		if (Entries.IsValidIndex(AddedIndex))
+		{
+			RecountEntry(Entries[AddedIndex]);
+			if (OwnerComponent)
+			{
+				bSlotsMoved |= OwnerComponent->ApplyReplicatedEntrySlot(Entries[AddedIndex], false);
+			}
+		}
 	}
 
-	if (Result.IsEmpty())
+	if (!bIndexDirty)
 	{
-		Result = TEXT("(empty)");
+		for (const int32 AddedIndex : AddedIndices)
+		{
+			if (Entries.IsValidIndex(AddedIndex) && Entries[AddedIndex].ItemGuid.IsValid())
+			{
+				IndexByGuid.Add(Entries[AddedIndex].ItemGuid, AddedIndex);
+			}
+		}
 	}
 
-	return Result;
+	bPendingReplicationBroadcast = true;
+	bPendingSlotsBroadcast |= bSlotsMoved;
 }
 
-void UMOInventoryComponent::BroadcastInventoryChanged()
+void FMOInventoryList::PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 /*FinalSize*/)
 {
-	OnInventoryChanged.Broadcast();
-}
+	// Counted* fields are not replicated, so they still hold the pre-change contribution.
+	bool bSlotsMoved = false;
+	for (const int32 ChangedIndex : ChangedIndices)
+	{
+		if (Entries.IsValidIndex(ChangedIndex))
+		{
+			RecountEntry(Entries[ChangedIndex]);
+			if (OwnerComponent)
+			{
+				bSlotsMoved |= OwnerComponent->ApplyReplicatedEntrySlot(Entries[ChangedIndex], false);
+			}
+		}
+	}
 
-/*
- * Fast array replication notifications.
- */
-void FMOInventoryList::PostReplicatedAdd(const TArrayView<int32>& /*AddedIndices*/, int32 /*FinalSize*/)
-{
-	if (OwnerComponent)
+	// Changes never move entries; FindIndexByGuid catches a GUID rewritten in place.
+	if (!bIndexDirty)
 	{
-		OwnerComponent->OnInventoryChanged.Broadcast();
+		for (const int32 ChangedIndex : ChangedIndices)
+		{
+			if (Entries.IsValidIndex(ChangedIndex) && Entries[ChangedIndex].ItemGuid.IsValid())
+			{
+				IndexByGuid.Add(Entries[ChangedIndex].ItemGuid, ChangedIndex);
+			}
+		}
 	}
+
+	bPendingReplicationBroadcast = true;
+	bPendingSlotsBroadcast |= bSlotsMoved;
 }
 
-void FMOInventoryList::PostReplicatedChange(const TArrayView<int32>& /*ChangedIndices*/, int32 /*FinalSize*/)
+void FMOInventoryList::PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 /*FinalSize*/)
 {
-	if (OwnerComponent)
+	for (const int32 RemovedIndex : RemovedIndices)
 	{
-		OwnerComponent->OnInventoryChanged.Broadcast();
+		if (Entries.IsValidIndex(RemovedIndex))
+		{
+			UncountEntry(Entries[RemovedIndex]);
+			if (OwnerComponent && OwnerComponent->ApplyReplicatedEntrySlot(Entries[RemovedIndex], true))
+			{
+				bPendingSlotsBroadcast = true;
+			}
+		}
 	}
+
+	// The serializer swap-removes after this returns, so surviving indices shift. Rebuild lazily.
+	bIndexDirty = true;
+	bPendingReplicationBroadcast = true;
 }
 
-void FMOInventoryList::PostReplicatedRemove(const TArrayView<int32>& /*RemovedIndices*/, int32 /*FinalSize*/)
+void FMOInventoryList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& /*Parameters*/)
 {
+	// One broadcast per update, however many adds, changes and removes it carried
+	if (!bPendingReplicationBroadcast)
+	{
+		return;
+	}
+
+	bPendingReplicationBroadcast = false;
 	if (OwnerComponent)
 	{
-		OwnerComponent->OnInventoryChanged.Broadcast();
+		if (bPendingSlotsBroadcast)
+		{
+			OwnerComponent->BroadcastSlotsChanged();
+		}
+		OwnerComponent->BroadcastInventoryChanged();
 	}
+	bPendingSlotsBroadcast = false;
 }
 
 /*
@@ -252,12 +1077,24 @@ void UMOInventoryComponent::EnsureSlotsInitialized()
 
 		if (SlotItemGuids.Num() != SlotCount)
 		{
-			SlotItemGuids.SetNum(SlotCount);
-			MarkSlotItemGuidsDirty();
+			ResizeSlotsAuthority(SlotCount);
 		}
 	}
 }
 
+void UMOInventoryComponent::ResizeSlotsAuthority(int32 NewSlotCount)
+{
+	// Unslot anything past the new end first so those entries replicate the change.
+	for (int32 SlotIndex = NewSlotCount; SlotIndex < SlotItemGuids.Num(); ++SlotIndex)
+	{
+		WriteSlotGuid(SlotIndex, FGuid());
+	}
+
+	SlotItemGuids.SetNum(NewSlotCount);
+	InvalidateSlotIndex();
+	NoteAllSlotsChanged();
+}
+
 bool UMOInventoryComponent::IsSlotIndexValid(int32 SlotIndex) const
 {
 	return SlotIndex >= 0 && SlotIndex < SlotItemGuids.Num();
@@ -265,8 +1102,8 @@ bool UMOInventoryComponent::IsSlotIndexValid(int32 SlotIndex) const
 
 int32 UMOInventoryComponent::GetSlotCount() const
 {
-	// Clients may not have SlotItemGuids yet, but do have the design-time SlotCount.
-	return (SlotItemGuids.Num() > 0) ? SlotItemGuids.Num() : FMath::Max(1, SlotCount);
+	// Clients build SlotItemGuids from replicated entries, so it can briefly lag the replicated SlotCount.
+	return FMath::Max(SlotItemGuids.Num(), FMath::Max(1, SlotCount));
 }
 
 bool UMOInventoryComponent::TryGetSlotGuid(int32 SlotIndex, FGuid& OutGuid) const
@@ -295,40 +1132,134 @@ bool UMOInventoryComponent::TryGetSlotEntry(int32 SlotIndex, FMOInventoryEntry&
 	return TryGetEntryByGuid(SlotGuid, OutEntry);
 }
 
-bool UMOInventoryComponent::IsGuidInSlots(const FGuid& ItemGuid) const
+int32 UMOInventoryComponent::FindSlotIndexByGuid(const FGuid& ItemGuid) const
 {
 	if (!ItemGuid.IsValid())
 	{
-		return false;
+		return INDEX_NONE;
 	}
 
-	for (const FGuid& SlotGuid : SlotItemGuids)
+	if (bSlotIndexDirty)
 	{
-		if (SlotGuid == ItemGuid)
-		{
-			return true;
-		}
+		RebuildSlotIndex();
 	}
 
-	return false;
+	const int32* FoundSlot = SlotIndexByGuid.Find(ItemGuid);
+	return FoundSlot ? *FoundSlot : INDEX_NONE;
+}
+
+bool UMOInventoryComponent::IsGuidInSlots(const FGuid& ItemGuid) const
+{
+	return FindSlotIndexByGuid(ItemGuid) != INDEX_NONE;
 }
 
 bool UMOInventoryComponent::FindFirstEmptySlot(int32& OutSlotIndex) const
 {
 	OutSlotIndex = INDEX_NONE;
 
-	for (int32 SlotIndex = 0; SlotIndex < SlotItemGuids.Num(); ++SlotIndex)
+	if (bSlotIndexDirty)
+	{
+		RebuildSlotIndex();
+	}
+
+	// Slots below the hint are known full, so the scan only ever moves forward until a slot is cleared.
+	for (int32 SlotIndex = FirstEmptySlotHint; SlotIndex < SlotItemGuids.Num(); ++SlotIndex)
 	{
 		if (!SlotItemGuids[SlotIndex].IsValid())
 		{
+			FirstEmptySlotHint = SlotIndex;
 			OutSlotIndex = SlotIndex;
 			return true;
 		}
 	}
 
+	FirstEmptySlotHint = SlotItemGuids.Num();
 	return false;
 }
 
+void UMOInventoryComponent::WriteSlotGuid(int32 SlotIndex, const FGuid& ItemGuid)
+{
+	const FGuid PreviousGuid = SlotItemGuids[SlotIndex];
+	if (PreviousGuid == ItemGuid)
+	{
+		return;
+	}
+
+	SetSlotGuidLocal(SlotIndex, ItemGuid);
+
+	// The slot assignment replicates on the entries, so a move or swap is just an item delta per entry.
+	const int32 PreviousEntryIndex = FindEntryIndexByGuid(PreviousGuid);
+	if (PreviousEntryIndex != INDEX_NONE && Inventory.Entries[PreviousEntryIndex].SlotIndex == SlotIndex)
+	{
+		FMOInventoryEntry& PreviousEntry = Inventory.Entries[PreviousEntryIndex];
+		PreviousEntry.SlotIndex = INDEX_NONE;
+		PreviousEntry.AppliedSlotIndex = INDEX_NONE;
+		MarkEntryDirty(PreviousEntry);
+	}
+
+	const int32 NewEntryIndex = FindEntryIndexByGuid(ItemGuid);
+	if (NewEntryIndex != INDEX_NONE)
+	{
+		FMOInventoryEntry& NewEntry = Inventory.Entries[NewEntryIndex];
+		NewEntry.SlotIndex = SlotIndex;
+		NewEntry.AppliedSlotIndex = SlotIndex;
+		MarkEntryDirty(NewEntry);
+	}
+}
+
+void UMOInventoryComponent::SetSlotGuidLocal(int32 SlotIndex, const FGuid& ItemGuid)
+{
+	FGuid& SlotGuid = SlotItemGuids[SlotIndex];
+
+	if (!bSlotIndexDirty)
+	{
+		const int32* PreviousSlot = SlotGuid.IsValid() ? SlotIndexByGuid.Find(SlotGuid) : nullptr;
+		if (PreviousSlot && *PreviousSlot == SlotIndex)
+		{
+			SlotIndexByGuid.Remove(SlotGuid);
+		}
+
+		if (ItemGuid.IsValid())
+		{
+			SlotIndexByGuid.Add(ItemGuid, SlotIndex);
+		}
+	}
+
+	if (SlotGuid != ItemGuid)
+	{
+		NoteSlotChanged(SlotIndex);
+	}
+
+	SlotGuid = ItemGuid;
+
+	if (!ItemGuid.IsValid())
+	{
+		FirstEmptySlotHint = FMath::Min(FirstEmptySlotHint, SlotIndex);
+	}
+}
+
+void UMOInventoryComponent::InvalidateSlotIndex()
+{
+	bSlotIndexDirty = true;
+}
+
+void UMOInventoryComponent::RebuildSlotIndex() const
+{
+	SlotIndexByGuid.Reset();
+	FirstEmptySlotHint = 0;
+
+	for (int32 SlotIndex = 0; SlotIndex < SlotItemGuids.Num(); ++SlotIndex)
+	{
+		const FGuid& SlotGuid = SlotItemGuids[SlotIndex];
+		if (SlotGuid.IsValid() && !SlotIndexByGuid.Contains(SlotGuid))
+		{
+			SlotIndexByGuid.Add(SlotGuid, SlotIndex);
+		}
+	}
+
+	bSlotIndexDirty = false;
+}
+
 bool UMOInventoryComponent::TryAutoAssignGuidToEmptySlot(const FGuid& ItemGuid)
 {
 	if (!bAutoAssignNewItemsToSlots)
@@ -352,7 +1283,7 @@ bool UMOInventoryComponent::TryAutoAssignGuidToEmptySlot(const FGuid& ItemGuid)
 		return false;
 	}
 
-	SlotItemGuids[EmptySlotIndex] = ItemGuid;
+	WriteSlotGuid(EmptySlotIndex, ItemGuid);
 	return true;
 }
 
@@ -363,19 +1294,11 @@ void UMOInventoryComponent::RemoveGuidFromSlotsInternal(const FGuid& ItemGuid)
 		return;
 	}
 
-	bool bChanged = false;
-	for (FGuid& SlotGuid : SlotItemGuids)
-	{
-		if (SlotGuid == ItemGuid)
-		{
-			SlotGuid.Invalidate();
-			bChanged = true;
-		}
-	}
-
-	if (bChanged)
+	// Slot GUIDs are unique (SetSlotGuid and ApplySaveDataAuthority enforce it), so one lookup covers it.
+	const int32 SlotIndex = FindSlotIndexByGuid(ItemGuid);
+	if (SlotIndex != INDEX_NONE)
 	{
-		MarkSlotItemGuidsDirty();
+		WriteSlotGuid(SlotIndex, FGuid());
 	}
 }
 
@@ -398,9 +1321,8 @@ bool UMOInventoryComponent::SetSlotGuid(int32 SlotIndex, const FGuid& ItemGuid)
 	// Clearing is allowed by passing invalid guid.
 	if (!ItemGuid.IsValid())
 	{
-		SlotItemGuids[SlotIndex].Invalidate();
-		MarkSlotItemGuidsDirty();
-		OnSlotsChanged.Broadcast();
+		WriteSlotGuid(SlotIndex, FGuid());
+		BroadcastSlotsChanged();
 		return true;
 	}
 
@@ -414,9 +1336,8 @@ bool UMOInventoryComponent::SetSlotGuid(int32 SlotIndex, const FGuid& ItemGuid)
 	// Enforce uniqueness: remove the guid from any other slot first.
 	RemoveGuidFromSlotsInternal(ItemGuid);
 
-	SlotItemGuids[SlotIndex] = ItemGuid;
-	MarkSlotItemGuidsDirty();
-	OnSlotsChanged.Broadcast();
+	WriteSlotGuid(SlotIndex, ItemGuid);
+	BroadcastSlotsChanged();
 	return true;
 }
 
@@ -446,25 +1367,75 @@ bool UMOInventoryComponent::SwapSlots(int32 SlotIndexA, int32 SlotIndexB)
 		return true;
 	}
 
-	const FGuid TempGuid = SlotItemGuids[SlotIndexA];
-	SlotItemGuids[SlotIndexA] = SlotItemGuids[SlotIndexB];
-	SlotItemGuids[SlotIndexB] = TempGuid;
+	const FGuid GuidA = SlotItemGuids[SlotIndexA];
+	const FGuid GuidB = SlotItemGuids[SlotIndexB];
+	WriteSlotGuid(SlotIndexA, GuidB);
+	WriteSlotGuid(SlotIndexB, GuidA);
 
-	MarkSlotItemGuidsDirty();
-	OnSlotsChanged.Broadcast();
+	BroadcastSlotsChanged();
 	return true;
 }
 
-void UMOInventoryComponent::MarkSlotItemGuidsDirty()
+void UMOInventoryComponent::OnRep_SlotCount()
 {
-#if defined(MARK_PROPERTY_DIRTY_FROM_NAME)
-	MARK_PROPERTY_DIRTY_FROM_NAME(UMOInventoryComponent, SlotItemGuids, this);
-#endif
+	// Entries may already have grown the local slot array past a stale count; never drop live slots here.
+	const int32 NewSlotCount = FMath::Max(1, SlotCount);
+	if (SlotItemGuids.Num() < NewSlotCount)
+	{
+		const int32 PreviousNum = SlotItemGuids.Num();
+		SlotItemGuids.SetNum(NewSlotCount);
+		for (int32 SlotIndex = PreviousNum; SlotIndex < NewSlotCount; ++SlotIndex)
+		{
+			NoteSlotChanged(SlotIndex);
+		}
+	}
+	else if (SlotItemGuids.Num() > NewSlotCount)
+	{
+		// Trim empty trailing slots only; an occupied one stays until its entry's update moves it.
+		int32 NewNum = SlotItemGuids.Num();
+		while (NewNum > NewSlotCount && !SlotItemGuids[NewNum - 1].IsValid())
+		{
+			--NewNum;
+		}
+
+		if (NewNum < SlotItemGuids.Num())
+		{
+			SlotItemGuids.SetNum(NewNum);
+			InvalidateSlotIndex();
+		}
+	}
+
+	BroadcastSlotsChanged();
 }
 
-void UMOInventoryComponent::OnRep_SlotItemGuids()
+bool UMOInventoryComponent::ApplyReplicatedEntrySlot(FMOInventoryEntry& Entry, bool bRemoved)
 {
-	OnSlotsChanged.Broadcast();
+	// Quantity/definition changes redraw whichever slot shows this entry, moved or not.
+	NoteEntrySlotChanged(Entry.ItemGuid);
+
+	const int32 NewSlotIndex = bRemoved ? INDEX_NONE : Entry.SlotIndex;
+	if (Entry.AppliedSlotIndex == NewSlotIndex)
+	{
+		return false;
+	}
+
+	// Only clear the old slot if nothing else has moved in yet (swaps arrive as two changes in either order).
+	if (SlotItemGuids.IsValidIndex(Entry.AppliedSlotIndex) && SlotItemGuids[Entry.AppliedSlotIndex] == Entry.ItemGuid)
+	{
+		SetSlotGuidLocal(Entry.AppliedSlotIndex, FGuid());
+	}
+
+	if (NewSlotIndex >= 0)
+	{
+		if (NewSlotIndex >= SlotItemGuids.Num())
+		{
+			SlotItemGuids.SetNum(NewSlotIndex + 1);
+		}
+		SetSlotGuidLocal(NewSlotIndex, Entry.ItemGuid);
+	}
+
+	Entry.AppliedSlotIndex = NewSlotIndex;
+	return true;
 }
 
 /*
@@ -480,8 +1451,8 @@ void UMOInventoryComponent::ClearInventoryAndSlots()
 	}
 
 	// Clear entries
-	Inventory.Entries.Reset();
-	Inventory.MarkArrayDirty();
+	Inventory.ResetEntries();
+	MarkEntriesArrayDirty();
 	BroadcastInventoryChanged();
 
 	// Clear slots
@@ -490,9 +1461,10 @@ void UMOInventoryComponent::ClearInventoryAndSlots()
 	{
 		SlotGuid.Invalidate();
 	}
+	InvalidateSlotIndex();
+	NoteAllSlotsChanged();
 
-	MarkSlotItemGuidsDirty();
-	OnSlotsChanged.Broadcast();
+	BroadcastSlotsChanged();
 }
 
 bool UMOInventoryComponent::SetSlotCountAuthority(int32 NewSlotCount)
@@ -505,21 +1477,23 @@ bool UMOInventoryComponent::SetSlotCountAuthority(int32 NewSlotCount)
 	}
 
 	SlotCount = FMath::Max(1, NewSlotCount);
-	SlotItemGuids.SetNum(SlotCount);
+	ResizeSlotsAuthority(SlotCount);
 
-	MarkSlotItemGuidsDirty();
-	OnSlotsChanged.Broadcast();
+	BroadcastSlotsChanged();
 	return true;
 }
 
 bool UMOInventoryComponent::AddItemByGuidWithoutSlotAutoAssign(const FGuid& ItemGuid, const FName ItemDefinitionId, int32 QuantityToAdd)
 {
 	const bool bPreviousAutoAssign = bAutoAssignNewItemsToSlots;
+	const bool bPreviousAutoStack = bAutoStackNewItems;
 	bAutoAssignNewItemsToSlots = false;
+	bAutoStackNewItems = false;
 
 	const bool bResult = AddItemByGuid(ItemGuid, ItemDefinitionId, QuantityToAdd);
 
 	bAutoAssignNewItemsToSlots = bPreviousAutoAssign;
+	bAutoStackNewItems = bPreviousAutoStack;
 	return bResult;
 }
 
@@ -565,7 +1539,7 @@ bool UMOInventoryComponent::ApplySaveDataAuthority(const FMOInventorySaveData& I
 	bAutoAssignNewItemsToSlots = false;
 
 	// Reset inventory entries
-	Inventory.Entries.Reset();
+	Inventory.ResetEntries();
 
 	// Restore entries
 	for (const FMOInventoryItemSaveEntry& ItemSaveEntry : InSaveData.Items)
@@ -579,19 +1553,39 @@ bool UMOInventoryComponent::ApplySaveDataAuthority(const FMOInventorySaveData& I
 		NewEntry.ItemGuid = ItemSaveEntry.ItemGuid;
 		NewEntry.ItemDefinitionId = ItemSaveEntry.ItemDefinitionId;
 		NewEntry.Quantity = ItemSaveEntry.Quantity;
-		Inventory.Entries.Add(NewEntry);
+		Inventory.AddEntry(NewEntry);
 	}
 
-	Inventory.MarkArrayDirty();
+	MarkEntriesArrayDirty();
 	BroadcastInventoryChanged();
 
-	// Restore slots
+	// Restore slots through WriteSlotGuid so each slotted entry records (and replicates) its slot.
 	SlotCount = DesiredSlotCount;
-	SlotItemGuids = InSaveData.SlotItemGuids;
+	SlotItemGuids.Reset();
 	SlotItemGuids.SetNum(SlotCount);
+	InvalidateSlotIndex();
 
-	MarkSlotItemGuidsDirty();
-	OnSlotsChanged.Broadcast();
+	const int32 SavedSlotCount = FMath::Min(InSaveData.SlotItemGuids.Num(), SlotCount);
+	for (int32 SlotIndex = 0; SlotIndex < SavedSlotCount; ++SlotIndex)
+	{
+		const FGuid& SavedGuid = InSaveData.SlotItemGuids[SlotIndex];
+		if (!SavedGuid.IsValid() || FindEntryIndexByGuid(SavedGuid) == INDEX_NONE)
+		{
+			continue;
+		}
+
+		// Older saves could hold the same GUID in two slots; keep the first so slots stay one-to-one.
+		if (FindSlotIndexByGuid(SavedGuid) != INDEX_NONE)
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] ApplySaveDataAuthority: dropping duplicate slot GUID %s"), *SavedGuid.ToString(EGuidFormats::Short));
+			continue;
+		}
+
+		WriteSlotGuid(SlotIndex, SavedGuid);
+	}
+	NoteAllSlotsChanged();
+
+	BroadcastSlotsChanged();
 
 	bAutoAssignNewItemsToSlots = bPreviousAutoAssign;
 	return true;
@@ -602,13 +1596,12 @@ namespace
 	static TSubclassOf<AActor> ResolveDropActorClassFromDataTable(const FName& ItemDefinitionId)
 	{
 		// First try using the strongly-typed item definition lookup
-		FMOItemDefinitionRow ItemDef;
-		if (UMOItemDatabaseSettings::GetItemDefinition(ItemDefinitionId, ItemDef))
+		if (const FMOItemDefinitionRow* ItemDef = UMOItemDatabaseSettings::FindItemDefinition(ItemDefinitionId))
 		{
 			// Check WorldVisual.WorldActorClass
-			if (!ItemDef.WorldVisual.WorldActorClass.IsNull())
+			if (!ItemDef->WorldVisual.WorldActorClass.IsNull())
 			{
-				UClass* LoadedClass = ItemDef.WorldVisual.WorldActorClass.LoadSynchronous();
+				UClass* LoadedClass = ItemDef->WorldVisual.WorldActorClass.LoadSynchronous();
 				if (LoadedClass && LoadedClass->IsChildOf(AActor::StaticClass()))
 				{
 					return LoadedClass;
@@ -711,6 +1704,7 @@ namespace
 		{
 			ItemComp->ItemDefinitionId = ItemDefinitionId;
 			ItemComp->Quantity = Quantity;
+			ItemComp->RefreshWorldItemIndex();
 			UE_LOG(LogMOFramework, Log, TEXT("[MOInventory] Drop: Set ItemComponent ItemDefinitionId=%s, Quantity=%d"), *ItemDefinitionId.ToString(), Quantity);
 		}
 
@@ -863,7 +1857,18 @@ AActor* UMOInventoryComponent::DropItemByGuid(const FGuid& ItemGuid, const FVect
 	UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] DropItemByGuid: SpawnTransform Location=%s, Rotation=%s"),
 		*SpawnTransform.GetLocation().ToString(), *SpawnTransform.GetRotation().Rotator().ToString());
 
-	AActor* SpawnedActor = World->SpawnActor<AActor>(DropActorClass, SpawnTransform, SpawnParams);
+	// World items come from the pool so a drop/pickup loop reuses actors instead of spawning one per drop.
+	AActor* SpawnedActor = nullptr;
+	UMOWorldItemPoolSubsystem* WorldItemPool = World->GetSubsystem<UMOWorldItemPoolSubsystem>();
+	if (WorldItemPool && DropActorClass->IsChildOf(AMOWorldItem::StaticClass()))
+	{
+		SpawnedActor = WorldItemPool->AcquireWorldItem(TSubclassOf<AMOWorldItem>(DropActorClass.Get()), SpawnTransform, SpawnParams);
+	}
+	else
+	{
+		SpawnedActor = World->SpawnActor<AActor>(DropActorClass, SpawnTransform, SpawnParams);
+	}
+
 	if (!IsValid(SpawnedActor))
 	{
 		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventory] DropItemByGuid: spawn failed for ItemDefinitionId=%s"), *Entry.ItemDefinitionId.ToString());
@@ -931,6 +1936,8 @@ void UMOInventoryComponent::ApplyStartingItems()
 
 	UE_LOG(LogMOFramework, Log, TEXT("[MOInventory] Applying %d starting items"), StartingItems.Num());
 
+	FMOInventoryTransactionScope Transaction(this);
+
 	for (const FMOStartingInventoryItem& StartingItem : StartingItems)
 	{
 		if (StartingItem.ItemDefinitionId.IsNone() || StartingItem.Quantity <= 0)
@@ -938,14 +1945,12 @@ void UMOInventoryComponent::ApplyStartingItems()
 			continue;
 		}
 
-		// Generate a unique GUID for this starting item
-		const FGuid NewItemGuid = FGuid::NewGuid();
-
 		// Add to inventory (without auto-assign so we can control slot placement)
 		const bool bPreviousAutoAssign = bAutoAssignNewItemsToSlots;
 		bAutoAssignNewItemsToSlots = false;
 
-		const bool bAdded = AddItemByGuid(NewItemGuid, StartingItem.ItemDefinitionId, StartingItem.Quantity);
+		TArray<FGuid> NewStackGuids;
+		const bool bAdded = AddItemInternal(FGuid::NewGuid(), StartingItem.ItemDefinitionId, StartingItem.Quantity, &NewStackGuids);
 
 		bAutoAssignNewItemsToSlots = bPreviousAutoAssign;
 
@@ -955,17 +1960,21 @@ void UMOInventoryComponent::ApplyStartingItems()
 			continue;
 		}
 
-		// Assign to specific slot or auto-assign
-		if (StartingItem.SlotIndex >= 0 && IsSlotIndexValid(StartingItem.SlotIndex))
-		{
-			SlotItemGuids[StartingItem.SlotIndex] = NewItemGuid;
-			MarkSlotItemGuidsDirty();
-		}
-		else if (bAutoAssignNewItemsToSlots)
+		// The first new stack takes the requested slot; any overflow stacks (and a first stack with no
+		// usable slot) auto-assign. Nothing is new if the quantity merged into existing stacks.
+		for (int32 StackIndex = 0; StackIndex < NewStackGuids.Num(); ++StackIndex)
 		{
-			TryAutoAssignGuidToEmptySlot(NewItemGuid);
+			const bool bRequestedSlot = StackIndex == 0 && IsSlotIndexValid(StartingItem.SlotIndex);
+			if (bRequestedSlot)
+			{
+				WriteSlotGuid(StartingItem.SlotIndex, NewStackGuids[StackIndex]);
+			}
+			else if (bAutoAssignNewItemsToSlots)
+			{
+				TryAutoAssignGuidToEmptySlot(NewStackGuids[StackIndex]);
+			}
 		}
 	}
 
-	OnSlotsChanged.Broadcast();
+	BroadcastSlotsChanged();
 }
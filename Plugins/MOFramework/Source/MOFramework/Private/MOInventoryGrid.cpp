@@ -5,6 +5,7 @@
 #include "Components/UniformGridSlot.h"
 
 #include "MOInventoryComponent.h"
+#include "MOItemAssetStreamingSubsystem.h"
 #include "MOInventorySlot.h"
 
 UMOInventoryGrid::UMOInventoryGrid(const FObjectInitializer& ObjectInitializer)
@@ -70,6 +71,23 @@ void UMOInventoryGrid::RebuildGrid()
 		return;
 	}
 
+	// Queue every icon in the inventory as one streaming batch before the slots ask for them one by one.
+	if (IsValid(InventoryComponent))
+	{
+		if (UMOItemAssetStreamingSubsystem* Streaming = UMOItemAssetStreamingSubsystem::Get(this))
+		{
+			TArray<FMOInventoryEntry> Entries;
+			InventoryComponent->GetInventoryEntries(Entries);
+
+			TArray<FName> ItemDefinitionIds;
+			for (const FMOInventoryEntry& Entry : Entries)
+			{
+				ItemDefinitionIds.AddUnique(Entry.ItemDefinitionId);
+			}
+			Streaming->PrefetchItemDefinitions(ItemDefinitionIds, true, false);
+		}
+	}
+
 	for (int32 SlotIndex = 0; SlotIndex < SlotCount; ++SlotIndex)
 	{
 		UMOInventorySlot* NewSlotWidget = CreateWidget<UMOInventorySlot>(OwningPlayerController, SlotWidgetClass);
@@ -103,6 +121,28 @@ void UMOInventoryGrid::RefreshAllSlots()
 	}
 }
 
+void UMOInventoryGrid::RefreshSlots(const TArray<int32>& SlotIndices)
+{
+	for (const int32 SlotIndex : SlotIndices)
+	{
+		if (SlotWidgets.IsValidIndex(SlotIndex) && IsValid(SlotWidgets[SlotIndex]))
+		{
+			SlotWidgets[SlotIndex]->RefreshFromInventory();
+		}
+	}
+}
+
+bool UMOInventoryGrid::RebuildGridIfSlotCountChanged()
+{
+	if (SlotWidgets.Num() == GetDesiredSlotCount())
+	{
+		return false;
+	}
+
+	RebuildGrid();
+	return true;
+}
+
 void UMOInventoryGrid::HandleSlotClicked(int32 SlotIndex, const FGuid& ItemGuid)
 {
 	OnGridSlotClicked.Broadcast(SlotIndex, ItemGuid);
@@ -30,6 +30,7 @@ void UMOInventoryMenu::NativeDestruct()
 		// If your names differ, update them here.
 		InventoryComponent->OnInventoryChanged.RemoveDynamic(this, &UMOInventoryMenu::HandleInventoryChanged);
 		InventoryComponent->OnSlotsChanged.RemoveDynamic(this, &UMOInventoryMenu::HandleSlotsChanged);
+		InventoryComponent->OnSlotContentsChanged.RemoveDynamic(this, &UMOInventoryMenu::HandleSlotContentsChanged);
 	}
 
 	Super::NativeDestruct();
@@ -49,8 +50,10 @@ void UMOInventoryMenu::InitializeMenu(UMOInventoryComponent* InInventoryComponen
 		// Remove any existing bindings first to prevent duplicates
 		InventoryComponent->OnInventoryChanged.RemoveDynamic(this, &UMOInventoryMenu::HandleInventoryChanged);
 		InventoryComponent->OnSlotsChanged.RemoveDynamic(this, &UMOInventoryMenu::HandleSlotsChanged);
+		InventoryComponent->OnSlotContentsChanged.RemoveDynamic(this, &UMOInventoryMenu::HandleSlotContentsChanged);
 		InventoryComponent->OnInventoryChanged.AddDynamic(this, &UMOInventoryMenu::HandleInventoryChanged);
 		InventoryComponent->OnSlotsChanged.AddDynamic(this, &UMOInventoryMenu::HandleSlotsChanged);
+		InventoryComponent->OnSlotContentsChanged.AddDynamic(this, &UMOInventoryMenu::HandleSlotContentsChanged);
 	}
 
 	if (InventoryGrid)
@@ -86,17 +89,28 @@ FReply UMOInventoryMenu::NativeOnKeyDown(const FGeometry& InGeometry, const FKey
 
 void UMOInventoryMenu::HandleInventoryChanged()
 {
-	RefreshAll();
+	// Slot widgets are redrawn from HandleSlotContentsChanged; only the info panel needs a refresh here.
+	if (ItemInfoPanel)
+	{
+		ItemInfoPanel->SetSelectedItemGuid(SelectedItemGuid);
+	}
 }
 
 void UMOInventoryMenu::HandleSlotsChanged()
 {
-	if (InventoryGrid)
+	// Layout only changes when the slot count does; contents arrive via HandleSlotContentsChanged.
+	if (InventoryGrid && InventoryGrid->RebuildGridIfSlotCountChanged())
 	{
-		InventoryGrid->RebuildGrid();
+		RefreshAll();
 	}
+}
 
-	RefreshAll();
+void UMOInventoryMenu::HandleSlotContentsChanged(const TArray<int32>& SlotIndices)
+{
+	if (InventoryGrid)
+	{
+		InventoryGrid->RefreshSlots(SlotIndices);
+	}
 }
 
 void UMOInventoryMenu::HandleGridSlotClicked(int32 SlotIndex, const FGuid& ItemGuid)
@@ -15,6 +15,7 @@
 
 #include "MOInventoryComponent.h"
 #include "MOItemDatabaseSettings.h"
+#include "MOItemAssetStreamingSubsystem.h"
 #include "MODragVisualWidget.h"
 #include "MOWorldItem.h"
 #include "GameFramework/PlayerController.h"
@@ -148,8 +149,20 @@ void UMOInventorySlot::ApplyVisualDataToWidget()
 
 		if (CachedVisualData.bHasItem)
 		{
-			// Try to get icon from DataTable first
-			UTexture2D* DataTableIcon = UMOItemDatabaseSettings::GetItemIconSmall(CachedVisualData.ItemDefinitionId);
+			// Try to get icon from DataTable first. In game it streams in and we refresh once it lands.
+			UTexture2D* DataTableIcon = nullptr;
+			UTexture2D* PlaceholderIcon = nullptr;
+			if (UMOItemAssetStreamingSubsystem* Streaming = UMOItemAssetStreamingSubsystem::Get(this))
+			{
+				DataTableIcon = Streaming->RequestItemIcon(CachedVisualData.ItemDefinitionId, false,
+					FSimpleDelegate::CreateWeakLambda(this, [this]() { ApplyVisualDataToWidget(); }));
+				PlaceholderIcon = Streaming->GetPlaceholderIcon();
+			}
+			else
+			{
+				DataTableIcon = UMOItemDatabaseSettings::GetItemIconSmall(CachedVisualData.ItemDefinitionId);
+			}
+
 			if (IsValid(DataTableIcon))
 			{
 				DesiredTexture = DataTableIcon;
@@ -157,7 +170,7 @@ void UMOInventorySlot::ApplyVisualDataToWidget()
 			else
 			{
 				// Fall back to default item icon
-				DesiredTexture = DefaultItemIcon;
+				DesiredTexture = IsValid(DefaultItemIcon) ? DefaultItemIcon.Get() : PlaceholderIcon;
 			}
 		}
 
@@ -423,11 +436,24 @@ bool UMOInventorySlot::NativeOnDrop(const FGeometry& InGeometry, const FDragDrop
 		return true;
 	}
 
-	// Same inventory: swap slots
+	// Same inventory: merge onto a matching stack, otherwise swap slots
 	if (SourceInventory == InventoryComponent)
 	{
-		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventorySlot] Swapping slots %d <-> %d"), SourceSlot, TargetSlot);
-		InventoryComponent->SwapSlots(SourceSlot, TargetSlot);
+		FMOInventoryEntry SourceEntry;
+		FMOInventoryEntry TargetEntry;
+		const bool bSameDefinition = InventoryComponent->TryGetSlotEntry(SourceSlot, SourceEntry)
+			&& InventoryComponent->TryGetSlotEntry(TargetSlot, TargetEntry)
+			&& SourceEntry.ItemDefinitionId == TargetEntry.ItemDefinitionId;
+
+		if (bSameDefinition && InventoryComponent->MergeStacks(SourceEntry.ItemGuid, TargetEntry.ItemGuid))
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOInventorySlot] Merged stack %d into %d"), SourceSlot, TargetSlot);
+		}
+		else
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOInventorySlot] Swapping slots %d <-> %d"), SourceSlot, TargetSlot);
+			InventoryComponent->SwapSlots(SourceSlot, TargetSlot);
+		}
 	}
 	else
 	{
@@ -473,7 +499,11 @@ UUserWidget* UMOInventorySlot::CreateDragVisual()
 	UTexture2D* IconTexture = nullptr;
 	if (CachedVisualData.bHasItem)
 	{
-		IconTexture = UMOItemDatabaseSettings::GetItemIconSmall(CachedVisualData.ItemDefinitionId);
+		// The slot already requested this icon, so it is normally resident by the time a drag starts.
+		UMOItemAssetStreamingSubsystem* Streaming = UMOItemAssetStreamingSubsystem::Get(this);
+		IconTexture = Streaming
+			? Streaming->RequestItemIcon(CachedVisualData.ItemDefinitionId, false)
+			: UMOItemDatabaseSettings::GetItemIconSmall(CachedVisualData.ItemDefinitionId);
 		UE_LOG(LogMOFramework, Warning, TEXT("[MOInventorySlot] Got icon from DataTable: %s"),
 			IsValid(IconTexture) ? *IconTexture->GetName() : TEXT("NULL"));
 	}
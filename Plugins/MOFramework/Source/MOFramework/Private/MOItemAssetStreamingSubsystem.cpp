@@ -0,0 +1,240 @@
+#include "MOItemAssetStreamingSubsystem.h"
+#include "MOFramework.h"
+
+#include "Engine/GameInstance.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "Materials/MaterialInterface.h"
+#include "TimerManager.h"
+
+#include "MOItemDatabaseSettings.h"
+#include "MOItemDefinitionRow.h"
+
+UMOItemAssetStreamingSubsystem* UMOItemAssetStreamingSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+	return GameInstance ? GameInstance->GetSubsystem<UMOItemAssetStreamingSubsystem>() : nullptr;
+}
+
+void UMOItemAssetStreamingSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Placeholders stream in first so they are resident by the time anything needs them; the callbacks
+	// take the hard references that keep them that way.
+	const UMOItemDatabaseSettings* Settings = GetDefault<UMOItemDatabaseSettings>();
+	if (Settings && !GetPlaceholderIcon())
+	{
+		RequestAsset(Settings->PlaceholderIcon, FSimpleDelegate::CreateWeakLambda(this, [this]() { GetPlaceholderIcon(); }));
+	}
+	if (Settings && !GetPlaceholderWorldMesh())
+	{
+		RequestAsset(Settings->PlaceholderWorldMesh, FSimpleDelegate::CreateWeakLambda(this, [this]() { GetPlaceholderWorldMesh(); }));
+	}
+}
+
+void UMOItemAssetStreamingSubsystem::Deinitialize()
+{
+	if (UGameInstance* GameInstance = GetGameInstance())
+	{
+		GameInstance->GetTimerManager().ClearAllTimersForObject(this);
+	}
+
+	for (const TPair<uint32, TSharedPtr<FStreamableHandle>>& Batch : InFlightBatches)
+	{
+		if (Batch.Value.IsValid())
+		{
+			Batch.Value->CancelHandle();
+		}
+	}
+
+	InFlightBatches.Reset();
+	PlaceholderIcon = nullptr;
+	PlaceholderWorldMesh = nullptr;
+	PendingPaths.Reset();
+	WaitingCallbacks.Reset();
+	bFlushScheduled = false;
+
+	UE_LOG(LogMOFramework, Log, TEXT("[MOStreaming] Shutdown: ResidentHits=%d AsyncAssets=%d Batches=%d/%d AsyncBatchLoad=%.1fms"),
+		Stats.ResidentHits, Stats.AsyncRequestedAssets, Stats.BatchesCompleted, Stats.BatchesIssued, Stats.AsyncBatchLoadSeconds * 1000.0f);
+
+	Super::Deinitialize();
+}
+
+/*
+ * Requests
+ */
+
+UObject* UMOItemAssetStreamingSubsystem::RequestAsset(const FSoftObjectPath& AssetPath, FSimpleDelegate OnLoaded)
+{
+	if (AssetPath.IsNull())
+	{
+		return nullptr;
+	}
+
+	if (UObject* Resident = AssetPath.ResolveObject())
+	{
+		++Stats.ResidentHits;
+		return Resident;
+	}
+
+	TArray<FSimpleDelegate>* Callbacks = WaitingCallbacks.Find(AssetPath);
+	if (!Callbacks)
+	{
+		// First request for this path: it goes out with this frame's batch.
+		Callbacks = &WaitingCallbacks.Add(AssetPath);
+		PendingPaths.Add(AssetPath);
+		ScheduleFlush();
+	}
+
+	if (OnLoaded.IsBound())
+	{
+		Callbacks->Add(MoveTemp(OnLoaded));
+	}
+
+	return nullptr;
+}
+
+UTexture2D* UMOItemAssetStreamingSubsystem::RequestItemIcon(FName ItemDefinitionId, bool bLarge, FSimpleDelegate OnLoaded)
+{
+	const FMOItemDefinitionRow* Definition = UMOItemDatabaseSettings::FindItemDefinition(ItemDefinitionId);
+	if (!Definition)
+	{
+		return nullptr;
+	}
+
+	const TSoftObjectPtr<UTexture2D>& Icon = (bLarge && !Definition->UI.IconLarge.IsNull()) ? Definition->UI.IconLarge : Definition->UI.IconSmall;
+	return RequestAsset(Icon, MoveTemp(OnLoaded));
+}
+
+void UMOItemAssetStreamingSubsystem::PrefetchItemDefinitions(const TArray<FName>& ItemDefinitionIds, bool bIcons, bool bWorldVisuals)
+{
+	for (const FName ItemDefinitionId : ItemDefinitionIds)
+	{
+		const FMOItemDefinitionRow* Definition = UMOItemDatabaseSettings::FindItemDefinition(ItemDefinitionId);
+		if (!Definition)
+		{
+			continue;
+		}
+
+		if (bIcons)
+		{
+			RequestAsset(Definition->UI.IconSmall.ToSoftObjectPath());
+			RequestAsset(Definition->UI.IconLarge.ToSoftObjectPath());
+		}
+
+		if (bWorldVisuals)
+		{
+			RequestAsset(Definition->WorldVisual.StaticMesh.ToSoftObjectPath());
+			RequestAsset(Definition->WorldVisual.MaterialOverride.ToSoftObjectPath());
+		}
+	}
+}
+
+UTexture2D* UMOItemAssetStreamingSubsystem::GetPlaceholderIcon()
+{
+	if (!PlaceholderIcon)
+	{
+		const UMOItemDatabaseSettings* Settings = GetDefault<UMOItemDatabaseSettings>();
+		PlaceholderIcon = Settings ? Settings->PlaceholderIcon.Get() : nullptr;
+	}
+	return PlaceholderIcon;
+}
+
+UStaticMesh* UMOItemAssetStreamingSubsystem::GetPlaceholderWorldMesh()
+{
+	if (!PlaceholderWorldMesh)
+	{
+		const UMOItemDatabaseSettings* Settings = GetDefault<UMOItemDatabaseSettings>();
+		PlaceholderWorldMesh = Settings ? Settings->PlaceholderWorldMesh.Get() : nullptr;
+	}
+	return PlaceholderWorldMesh;
+}
+
+/*
+ * Batching
+ */
+
+void UMOItemAssetStreamingSubsystem::ScheduleFlush()
+{
+	if (bFlushScheduled)
+	{
+		return;
+	}
+
+	UGameInstance* GameInstance = GetGameInstance();
+	if (!GameInstance)
+	{
+		FlushPendingRequests();
+		return;
+	}
+
+	bFlushScheduled = true;
+	GameInstance->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UMOItemAssetStreamingSubsystem::FlushPendingRequests));
+}
+
+void UMOItemAssetStreamingSubsystem::FlushPendingRequests()
+{
+	bFlushScheduled = false;
+
+	if (PendingPaths.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> BatchPaths = MoveTemp(PendingPaths);
+	PendingPaths.Reset();
+
+	Stats.AsyncRequestedAssets += BatchPaths.Num();
+	++Stats.BatchesIssued;
+
+	const uint32 BatchId = ++NextBatchId;
+	const double StartSeconds = FPlatformTime::Seconds();
+	TArray<FSoftObjectPath> RequestPaths = BatchPaths;
+
+	TSharedPtr<FStreamableHandle> Handle = StreamableManager.RequestAsyncLoad(
+		MoveTemp(RequestPaths),
+		FStreamableDelegate::CreateUObject(this, &UMOItemAssetStreamingSubsystem::HandleBatchLoaded, BatchId, MoveTemp(BatchPaths), StartSeconds),
+		FStreamableManager::AsyncLoadHighPriority);
+
+	// Held only until the batch completes; a batch that completed inside the request needs no holding.
+	if (Handle.IsValid() && !Handle->HasLoadCompleted())
+	{
+		InFlightBatches.Add(BatchId, Handle);
+	}
+}
+
+void UMOItemAssetStreamingSubsystem::HandleBatchLoaded(uint32 BatchId, TArray<FSoftObjectPath> BatchPaths, double StartSeconds)
+{
+	// Keep the batch's handle (and so its assets) alive until the callbacks below have taken what they need.
+	TSharedPtr<FStreamableHandle> Handle;
+	InFlightBatches.RemoveAndCopyValue(BatchId, Handle);
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartSeconds;
+	++Stats.BatchesCompleted;
+	Stats.AsyncBatchLoadSeconds += static_cast<float>(ElapsedSeconds);
+
+	UE_LOG(LogMOFramework, Verbose, TEXT("[MOStreaming] Batch of %d assets loaded in %.2fms"), BatchPaths.Num(), ElapsedSeconds * 1000.0);
+
+	for (const FSoftObjectPath& AssetPath : BatchPaths)
+	{
+		TArray<FSimpleDelegate> Callbacks;
+		if (!WaitingCallbacks.RemoveAndCopyValue(AssetPath, Callbacks))
+		{
+			continue;
+		}
+
+		if (!AssetPath.ResolveObject())
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOStreaming] Failed to load %s"), *AssetPath.ToString());
+			continue;
+		}
+
+		for (FSimpleDelegate& Callback : Callbacks)
+		{
+			Callback.ExecuteIfBound();
+		}
+	}
+}
@@ -11,6 +11,7 @@
 #include "MOIdentityComponent.h"
 #include "MOInventoryComponent.h"
 #include "MOItemDatabaseSettings.h"
+#include "MOWorldItemIndexSubsystem.h"
 
 UMOItemComponent::UMOItemComponent()
 {
@@ -27,6 +28,48 @@ void UMOItemComponent::BeginPlay()
 
 	// Make the initial definition available to listeners.
 	OnItemDefinitionIdChanged.Broadcast(ItemDefinitionId);
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UMOWorldItemIndexSubsystem* ItemIndex = World->GetSubsystem<UMOWorldItemIndexSubsystem>())
+		{
+			ItemIndex->RegisterItem(this);
+		}
+	}
+}
+
+void UMOItemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	RemoveFromWorldItemIndex();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UMOItemComponent::RemoveFromWorldItemIndex()
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UMOWorldItemIndexSubsystem* ItemIndex = World->GetSubsystem<UMOWorldItemIndexSubsystem>())
+		{
+			ItemIndex->UnregisterItem(this);
+		}
+	}
+}
+
+void UMOItemComponent::RefreshWorldItemIndex()
+{
+	if (!HasBegunPlay())
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		if (UMOWorldItemIndexSubsystem* ItemIndex = World->GetSubsystem<UMOWorldItemIndexSubsystem>())
+		{
+			ItemIndex->UpdateItem(this);
+		}
+	}
 }
 
 void UMOItemComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -179,6 +222,7 @@ void UMOItemComponent::ApplyWorldItemActiveState()
 
 void UMOItemComponent::OnRep_ItemDefinitionId()
 {
+	RefreshWorldItemIndex();
 	OnItemDefinitionIdChanged.Broadcast(ItemDefinitionId);
 }
 
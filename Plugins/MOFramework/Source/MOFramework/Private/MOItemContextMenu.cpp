@@ -135,10 +135,9 @@ void UMOItemContextMenu::RefreshButtonVisibility_Implementation()
 	}
 
 	// Lookup item definition
-	FMOItemDefinitionRow ItemDef;
-	const bool bFoundDef = UMOItemDatabaseSettings::GetItemDefinition(SlotEntry.ItemDefinitionId, ItemDef);
+	const FMOItemDefinitionRow* ItemDef = SlotEntry.GetDefinition();
 
-	const bool bIsConsumable = bFoundDef ? ItemDef.bConsumable : false;
+	const bool bIsConsumable = ItemDef ? ItemDef->bConsumable : false;
 	const bool bHasMultiple = SlotEntry.Quantity > 1;
 
 	// Show/hide buttons based on item properties
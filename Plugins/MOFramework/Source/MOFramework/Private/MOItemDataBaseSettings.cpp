@@ -9,78 +9,215 @@ UDataTable* UMOItemDatabaseSettings::GetItemDefinitionsDataTable() const
 	return ItemDefinitionsDataTable.LoadSynchronous();
 }
 
-bool UMOItemDatabaseSettings::GetItemDefinition(FName ItemDefinitionId, FMOItemDefinitionRow& OutDefinition)
+namespace
 {
-	OutDefinition = FMOItemDefinitionRow();
+	/**
+	 * Interned view of the item DataTable. Handle N maps to Rows[N]/Ids[N]; slot 0 is reserved as the invalid handle.
+	 * Row pointers point into the DataTable's own row storage, so nothing is copied and the table is rebuilt
+	 * whenever the DataTable reports a change.
+	 */
+	struct FMOItemDefinitionRegistry
+	{
+		TWeakObjectPtr<UDataTable> SourceTable;
+		FDelegateHandle TableChangedHandle;
+		TArray<const FMOItemDefinitionRow*> Rows;
+		TArray<FName> Ids;
+		TMap<FName, uint16> HandleById;
+		bool bBuilt = false;
+
+		/** Set when the table at FailedPath is missing or has the wrong row struct; not retried until reset or repointed. */
+		FSoftObjectPath FailedPath;
+		bool bBuildFailed = false;
+	};
+
+	FMOItemDefinitionRegistry& GetItemDefinitionRegistry()
+	{
+		static FMOItemDefinitionRegistry Registry;
+		return Registry;
+	}
 
-	if (ItemDefinitionId.IsNone())
+	const FMOItemDefinitionRegistry& EnsureItemDefinitionRegistry()
 	{
-		return false;
+		FMOItemDefinitionRegistry& Registry = GetItemDefinitionRegistry();
+		if (Registry.bBuilt && Registry.SourceTable.IsValid())
+		{
+			return Registry;
+		}
+
+		// A misconfigured table would otherwise be reloaded (and warned about) on every lookup.
+		const UMOItemDatabaseSettings* Settings = GetDefault<UMOItemDatabaseSettings>();
+		const FSoftObjectPath ConfiguredPath = Settings ? Settings->ItemDefinitionsDataTable.ToSoftObjectPath() : FSoftObjectPath();
+		if (Registry.bBuildFailed && Registry.FailedPath == ConfiguredPath)
+		{
+			return Registry;
+		}
+
+		UMOItemDatabaseSettings::ResetItemDefinitionHandles();
+
+		UDataTable* DataTable = Settings ? Settings->GetItemDefinitionsDataTable() : nullptr;
+		if (!IsValid(DataTable))
+		{
+			Registry.FailedPath = ConfiguredPath;
+			Registry.bBuildFailed = true;
+			return Registry;
+		}
+
+		const UScriptStruct* RowStruct = DataTable->GetRowStruct();
+		if (!RowStruct || !RowStruct->IsChildOf(FMOItemDefinitionRow::StaticStruct()))
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOItemDatabase] Item DataTable '%s' does not use FMOItemDefinitionRow; definition lookups will fail."), *DataTable->GetName());
+
+			// Still listen for changes so fixing the table in the editor retries the build.
+			Registry.SourceTable = DataTable;
+			Registry.TableChangedHandle = DataTable->OnDataTableChanged().AddStatic(&UMOItemDatabaseSettings::ResetItemDefinitionHandles);
+			Registry.FailedPath = ConfiguredPath;
+			Registry.bBuildFailed = true;
+			return Registry;
+		}
+
+		const TMap<FName, uint8*>& RowMap = DataTable->GetRowMap();
+		const int32 MaxHandles = TNumericLimits<uint16>::Max();
+		const int32 NumToIntern = FMath::Min(RowMap.Num(), MaxHandles);
+		if (RowMap.Num() > MaxHandles)
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOItemDatabase] %d item definitions exceed the %d handle limit; the rest are unreachable by handle."), RowMap.Num(), MaxHandles);
+		}
+
+		Registry.Rows.Reserve(NumToIntern + 1);
+		Registry.Ids.Reserve(NumToIntern + 1);
+		Registry.HandleById.Reserve(NumToIntern);
+		Registry.Rows.Add(nullptr);
+		Registry.Ids.Add(NAME_None);
+
+		for (const TPair<FName, uint8*>& RowPair : RowMap)
+		{
+			if (Registry.Rows.Num() > MaxHandles)
+			{
+				break;
+			}
+
+			const uint16 Handle = static_cast<uint16>(Registry.Rows.Num());
+			Registry.Rows.Add(reinterpret_cast<const FMOItemDefinitionRow*>(RowPair.Value));
+			Registry.Ids.Add(RowPair.Key);
+			Registry.HandleById.Add(RowPair.Key, Handle);
+		}
+
+		Registry.SourceTable = DataTable;
+		Registry.TableChangedHandle = DataTable->OnDataTableChanged().AddStatic(&UMOItemDatabaseSettings::ResetItemDefinitionHandles);
+		Registry.bBuilt = true;
+		return Registry;
 	}
+}
 
-	const UMOItemDatabaseSettings* Settings = GetDefault<UMOItemDatabaseSettings>();
-	if (!Settings)
+#if WITH_EDITOR
+void UMOItemDatabaseSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMOItemDatabaseSettings, ItemDefinitionsDataTable))
 	{
-		return false;
+		ResetItemDefinitionHandles();
 	}
+}
+#endif
 
-	UDataTable* DataTable = Settings->GetItemDefinitionsDataTable();
-	if (!IsValid(DataTable))
+void UMOItemDatabaseSettings::ResetItemDefinitionHandles()
+{
+	FMOItemDefinitionRegistry& Registry = GetItemDefinitionRegistry();
+
+	if (UDataTable* OldTable = Registry.SourceTable.Get())
 	{
-		return false;
+		OldTable->OnDataTableChanged().Remove(Registry.TableChangedHandle);
 	}
 
-	const FMOItemDefinitionRow* FoundRow = DataTable->FindRow<FMOItemDefinitionRow>(ItemDefinitionId, TEXT("GetItemDefinition"), false);
-	if (!FoundRow)
+	Registry.SourceTable.Reset();
+	Registry.TableChangedHandle.Reset();
+	Registry.Rows.Reset();
+	Registry.Ids.Reset();
+	Registry.HandleById.Reset();
+	Registry.bBuilt = false;
+	Registry.FailedPath.Reset();
+	Registry.bBuildFailed = false;
+}
+
+FMOItemDefinitionHandle UMOItemDatabaseSettings::GetItemDefinitionHandle(FName ItemDefinitionId)
+{
+	if (ItemDefinitionId.IsNone())
 	{
-		return false;
+		return FMOItemDefinitionHandle();
 	}
 
-	OutDefinition = *FoundRow;
-	return true;
+	const uint16* Found = EnsureItemDefinitionRegistry().HandleById.Find(ItemDefinitionId);
+	return Found ? FMOItemDefinitionHandle(*Found) : FMOItemDefinitionHandle();
 }
 
-UTexture2D* UMOItemDatabaseSettings::GetItemIconSmall(FName ItemDefinitionId)
+const FMOItemDefinitionRow* UMOItemDatabaseSettings::GetItemDefinitionByHandle(FMOItemDefinitionHandle Handle)
 {
-	FMOItemDefinitionRow Definition;
-	if (!GetItemDefinition(ItemDefinitionId, Definition))
+	if (!Handle.IsValid())
 	{
 		return nullptr;
 	}
 
-	if (Definition.UI.IconSmall.IsNull())
+	const FMOItemDefinitionRegistry& Registry = EnsureItemDefinitionRegistry();
+	return Registry.Rows.IsValidIndex(Handle.Index) ? Registry.Rows[Handle.Index] : nullptr;
+}
+
+FName UMOItemDatabaseSettings::GetItemDefinitionIdByHandle(FMOItemDefinitionHandle Handle)
+{
+	if (!Handle.IsValid())
 	{
-		return nullptr;
+		return NAME_None;
 	}
 
-	return Definition.UI.IconSmall.LoadSynchronous();
+	const FMOItemDefinitionRegistry& Registry = EnsureItemDefinitionRegistry();
+	return Registry.Ids.IsValidIndex(Handle.Index) ? Registry.Ids[Handle.Index] : NAME_None;
 }
 
-UTexture2D* UMOItemDatabaseSettings::GetItemIconLarge(FName ItemDefinitionId)
+const FMOItemDefinitionRow* UMOItemDatabaseSettings::FindItemDefinition(FName ItemDefinitionId)
 {
-	FMOItemDefinitionRow Definition;
-	if (!GetItemDefinition(ItemDefinitionId, Definition))
+	return GetItemDefinitionByHandle(GetItemDefinitionHandle(ItemDefinitionId));
+}
+
+bool UMOItemDatabaseSettings::GetItemDefinition(FName ItemDefinitionId, FMOItemDefinitionRow& OutDefinition)
+{
+	OutDefinition = FMOItemDefinitionRow();
+
+	const FMOItemDefinitionRow* FoundRow = FindItemDefinition(ItemDefinitionId);
+	if (!FoundRow)
 	{
-		return nullptr;
+		return false;
 	}
 
-	if (Definition.UI.IconLarge.IsNull())
+	OutDefinition = *FoundRow;
+	return true;
+}
+
+UTexture2D* UMOItemDatabaseSettings::GetItemIconSmall(FName ItemDefinitionId)
+{
+	const FMOItemDefinitionRow* Definition = FindItemDefinition(ItemDefinitionId);
+	if (!Definition || Definition->UI.IconSmall.IsNull())
 	{
 		return nullptr;
 	}
 
-	return Definition.UI.IconLarge.LoadSynchronous();
+	return Definition->UI.IconSmall.LoadSynchronous();
 }
 
-FText UMOItemDatabaseSettings::GetItemDisplayName(FName ItemDefinitionId)
+UTexture2D* UMOItemDatabaseSettings::GetItemIconLarge(FName ItemDefinitionId)
 {
-	FMOItemDefinitionRow Definition;
-	if (!GetItemDefinition(ItemDefinitionId, Definition))
+	const FMOItemDefinitionRow* Definition = FindItemDefinition(ItemDefinitionId);
+	if (!Definition || Definition->UI.IconLarge.IsNull())
 	{
-		return FText::GetEmpty();
+		return nullptr;
 	}
 
-	return Definition.DisplayName;
+	return Definition->UI.IconLarge.LoadSynchronous();
+}
+
+FText UMOItemDatabaseSettings::GetItemDisplayName(FName ItemDefinitionId)
+{
+	const FMOItemDefinitionRow* Definition = FindItemDefinition(ItemDefinitionId);
+	return Definition ? Definition->DisplayName : FText::GetEmpty();
 }
 
 bool UMOItemDatabaseSettings::IsConfigured()
@@ -5,6 +5,7 @@
 #include "Components/PanelWidget.h"
 #include "MOInventoryComponent.h"
 #include "MOItemDatabaseSettings.h"
+#include "MOItemAssetStreamingSubsystem.h"
 #include "MOFramework.h"
 
 void UMOItemInfoPanel::NativeConstruct()
@@ -177,8 +178,8 @@ void UMOItemInfoPanel::RefreshPanel()
 	}
 
 	// Get the item definition from the DataTable
-	FMOItemDefinitionRow ItemDef;
-	if (!UMOItemDatabaseSettings::GetItemDefinition(FoundEntry.ItemDefinitionId, ItemDef))
+	const FMOItemDefinitionRow* FoundDef = FoundEntry.GetDefinition();
+	if (!FoundDef)
 	{
 		UE_LOG(LogMOFramework, Warning, TEXT("[ItemInfoPanel] RefreshPanel - No item definition found for %s, showing basic info"),
 			*FoundEntry.ItemDefinitionId.ToString());
@@ -187,6 +188,7 @@ void UMOItemInfoPanel::RefreshPanel()
 		if (QuantityText) { QuantityText->SetText(FText::AsNumber(FoundEntry.Quantity)); }
 		return;
 	}
+	const FMOItemDefinitionRow& ItemDef = *FoundDef;
 
 	UE_LOG(LogMOFramework, Warning, TEXT("[ItemInfoPanel] RefreshPanel - Got item definition: DisplayName=%s"),
 		*ItemDef.DisplayName.ToString());
@@ -307,13 +309,26 @@ void UMOItemInfoPanel::RefreshPanel()
 	if (ItemIconImage)
 	{
 		UTexture2D* IconTexture = nullptr;
-		if (!ItemDef.UI.IconLarge.IsNull())
+		if (UMOItemAssetStreamingSubsystem* Streaming = UMOItemAssetStreamingSubsystem::Get(this))
 		{
-			IconTexture = ItemDef.UI.IconLarge.LoadSynchronous();
+			// Large icon (or small if none) streams in; show the placeholder and refresh when it lands.
+			IconTexture = Streaming->RequestItemIcon(FoundEntry.ItemDefinitionId, true,
+				FSimpleDelegate::CreateWeakLambda(this, [this]() { RefreshPanel(); }));
+			if (!IconTexture)
+			{
+				IconTexture = Streaming->GetPlaceholderIcon();
+			}
 		}
-		if (!IconTexture && !ItemDef.UI.IconSmall.IsNull())
+		else
 		{
-			IconTexture = ItemDef.UI.IconSmall.LoadSynchronous();
+			if (!ItemDef.UI.IconLarge.IsNull())
+			{
+				IconTexture = ItemDef.UI.IconLarge.LoadSynchronous();
+			}
+			if (!IconTexture && !ItemDef.UI.IconSmall.IsNull())
+			{
+				IconTexture = ItemDef.UI.IconSmall.LoadSynchronous();
+			}
 		}
 
 		if (IconTexture)
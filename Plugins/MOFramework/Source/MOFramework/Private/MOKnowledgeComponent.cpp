@@ -53,13 +53,14 @@ FMOInspectionResult UMOKnowledgeComponent::InspectItem(FName ItemDefinitionId, U
 	}
 
 	// Get item definition for inspection data
-	FMOItemDefinitionRow ItemDef;
-	if (!UMOItemDatabaseSettings::GetItemDefinition(ItemDefinitionId, ItemDef))
+	const FMOItemDefinitionRow* FoundDef = UMOItemDatabaseSettings::FindItemDefinition(ItemDefinitionId);
+	if (!FoundDef)
 	{
 		UE_LOG(LogMOFramework, Warning, TEXT("[MOKnowledgeComponent] InspectItem: Item '%s' not found in database"),
 			*ItemDefinitionId.ToString());
 		return Result;
 	}
+	const FMOItemDefinitionRow& ItemDef = *FoundDef;
 
 	Result.bSuccess = true;
 
@@ -0,0 +1,750 @@
+#include "MOMedicalSchedulerSubsystem.h"
+#include "MOAnatomyComponent.h"
+#include "MOVitalsComponent.h"
+#include "MOMetabolismComponent.h"
+#include "MOMentalStateComponent.h"
+#include "MOSurvivalStatsComponent.h"
+#include "MOMedicalDatabaseSettings.h"
+#include "MOFramework.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "TimerManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+// ============================================================================
+// STATS
+// ============================================================================
+
+void FMOMedicalStageStats::Record(double DurationSeconds, int32 TickedCount)
+{
+	const float DurationMs = static_cast<float>(DurationSeconds * 1000.0);
+
+	LastTickedCount = TickedCount;
+	LastDurationMs = DurationMs;
+	PeakDurationMs = FMath::Max(PeakDurationMs, DurationMs);
+	AverageDurationMs = (PassCount == 0) ? DurationMs : FMath::Lerp(AverageDurationMs, DurationMs, 0.1f);
+	PassCount++;
+}
+
+// ============================================================================
+// SUBSYSTEM LIFECYCLE
+// ============================================================================
+
+void UMOMedicalSchedulerSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PassTimerHandle);
+	}
+
+	AnatomyStage = TStageList<UMOAnatomyComponent>();
+	VitalsStage = TStageList<UMOVitalsComponent>();
+	MetabolismStage = TStageList<UMOMetabolismComponent>();
+	MentalStage = TStageList<UMOMentalStateComponent>();
+	SurvivalStage = TStageList<UMOSurvivalStatsComponent>();
+	ActorLODs.Reset();
+	PendingDeltas.Reset();
+	EventQueue.Reset();
+
+	Super::Deinitialize();
+}
+
+bool UMOMedicalSchedulerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UMOMedicalSchedulerSubsystem* UMOMedicalSchedulerSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+	if (!Settings || !Settings->bUseMedicalScheduler)
+	{
+		return nullptr;
+	}
+
+	if (!WorldContextObject)
+	{
+		return nullptr;
+	}
+
+	UWorld* World = WorldContextObject->GetWorld();
+	return World ? World->GetSubsystem<UMOMedicalSchedulerSubsystem>() : nullptr;
+}
+
+// ============================================================================
+// REGISTRATION
+// ============================================================================
+
+template<typename ComponentType>
+bool UMOMedicalSchedulerSubsystem::AddToStage(TStageList<ComponentType>& List, ComponentType* Component)
+{
+	if (!IsValid(Component))
+	{
+		return false;
+	}
+
+	if (List.Components.Contains(Component))
+	{
+		return true;
+	}
+
+	// Late joiners adopt their actor's current tier (e.g. a second component on a dormant pawn)
+	const EMOMedicalSimLOD* ExistingLOD = ActorLODs.Find(Component->GetOwner());
+
+	List.Components.Add(Component);
+	List.Accumulators.Add(0.0f);
+	List.LODs.Add(ExistingLOD ? *ExistingLOD : EMOMedicalSimLOD::Full);
+	List.LiveCount++;
+
+	EnsureTimerRunning();
+	return true;
+}
+
+template<typename ComponentType>
+void UMOMedicalSchedulerSubsystem::RemoveFromStage(TStageList<ComponentType>& List, ComponentType* Component)
+{
+	const int32 Index = List.Components.IndexOfByKey(Component);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	List.LiveCount--;
+
+	if (bIsRunningPass)
+	{
+		// Keep indices stable while the pass is iterating; compact afterwards.
+		List.Components[Index].Reset();
+		bNeedsCompaction = true;
+		return;
+	}
+
+	List.Components.RemoveAtSwap(Index);
+	List.Accumulators.RemoveAtSwap(Index);
+	List.LODs.RemoveAtSwap(Index);
+
+	StopTimerIfIdle();
+}
+
+template<typename ComponentType>
+void UMOMedicalSchedulerSubsystem::CompactStage(TStageList<ComponentType>& List)
+{
+	for (int32 i = List.Components.Num() - 1; i >= 0; --i)
+	{
+		if (!List.Components[i].IsValid())
+		{
+			List.Components.RemoveAtSwap(i);
+			List.Accumulators.RemoveAtSwap(i);
+			List.LODs.RemoveAtSwap(i);
+		}
+	}
+
+	List.LiveCount = List.Components.Num();
+}
+
+void UMOMedicalSchedulerSubsystem::CompactStagesIfNeeded()
+{
+	if (!bNeedsCompaction)
+	{
+		return;
+	}
+
+	bNeedsCompaction = false;
+	CompactStage(AnatomyStage);
+	CompactStage(VitalsStage);
+	CompactStage(MetabolismStage);
+	CompactStage(MentalStage);
+	CompactStage(SurvivalStage);
+}
+
+bool UMOMedicalSchedulerSubsystem::RegisterComponent(UMOAnatomyComponent* Component) { return AddToStage(AnatomyStage, Component); }
+bool UMOMedicalSchedulerSubsystem::RegisterComponent(UMOVitalsComponent* Component) { return AddToStage(VitalsStage, Component); }
+bool UMOMedicalSchedulerSubsystem::RegisterComponent(UMOMetabolismComponent* Component) { return AddToStage(MetabolismStage, Component); }
+bool UMOMedicalSchedulerSubsystem::RegisterComponent(UMOMentalStateComponent* Component) { return AddToStage(MentalStage, Component); }
+bool UMOMedicalSchedulerSubsystem::RegisterComponent(UMOSurvivalStatsComponent* Component) { return AddToStage(SurvivalStage, Component); }
+
+void UMOMedicalSchedulerSubsystem::UnregisterComponent(UMOAnatomyComponent* Component) { RemoveFromStage(AnatomyStage, Component); }
+void UMOMedicalSchedulerSubsystem::UnregisterComponent(UMOVitalsComponent* Component) { RemoveFromStage(VitalsStage, Component); }
+void UMOMedicalSchedulerSubsystem::UnregisterComponent(UMOMetabolismComponent* Component) { RemoveFromStage(MetabolismStage, Component); }
+void UMOMedicalSchedulerSubsystem::UnregisterComponent(UMOMentalStateComponent* Component) { RemoveFromStage(MentalStage, Component); }
+void UMOMedicalSchedulerSubsystem::UnregisterComponent(UMOSurvivalStatsComponent* Component) { RemoveFromStage(SurvivalStage, Component); }
+
+// ============================================================================
+// TIMER
+// ============================================================================
+
+void UMOMedicalSchedulerSubsystem::EnsureTimerRunning()
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (TimerManager.IsTimerActive(PassTimerHandle))
+	{
+		return;
+	}
+
+	const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+	PassInterval = Settings ? FMath::Max(Settings->SchedulerPassInterval, 0.05f) : 0.5f;
+
+	TimerManager.SetTimer(
+		PassTimerHandle,
+		this,
+		&UMOMedicalSchedulerSubsystem::RunPass,
+		PassInterval,
+		true
+	);
+
+	UE_LOG(LogMOFramework, Log, TEXT("[MOMedicalScheduler] Started pass timer (%.2fs)"), PassInterval);
+}
+
+void UMOMedicalSchedulerSubsystem::StopTimerIfIdle()
+{
+	if (GetTotalLiveCount() > 0)
+	{
+		return;
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PassTimerHandle);
+	}
+}
+
+int32 UMOMedicalSchedulerSubsystem::GetTotalLiveCount() const
+{
+	return AnatomyStage.LiveCount + VitalsStage.LiveCount + MetabolismStage.LiveCount
+		+ MentalStage.LiveCount + SurvivalStage.LiveCount;
+}
+
+// ============================================================================
+// PASS
+// ============================================================================
+
+template<typename ComponentType>
+void UMOMedicalSchedulerSubsystem::RunStage(EMOMedicalSimStage Stage, TStageList<ComponentType>& List, float DeltaSeconds,
+	void (ComponentType::*AdvanceFunction)(float), float ComponentType::*IntervalMember)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	int32 TickedCount = 0;
+
+	// Index loop: components may register (append) while we iterate.
+	for (int32 i = 0; i < List.Components.Num(); ++i)
+	{
+		ComponentType* Component = List.Components[i].Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		float& Accumulator = List.Accumulators[i];
+		Accumulator += DeltaSeconds;
+
+		// Dormant components only bank time; it is caught up when they wake
+		const EMOMedicalSimLOD LOD = List.LODs[i];
+		if (LOD == EMOMedicalSimLOD::Dormant)
+		{
+			continue;
+		}
+
+		const float Step = GetStepForLOD(Component->*IntervalMember, LOD);
+		while (Accumulator + KINDA_SMALL_NUMBER >= Step)
+		{
+			Accumulator -= Step;
+			(Component->*AdvanceFunction)(Step);
+			TickedCount++;
+
+			// The tick may have ended play for this component.
+			if (!List.Components[i].IsValid())
+			{
+				break;
+			}
+		}
+	}
+
+	FMOMedicalStageStats& Stats = StageStats[static_cast<int32>(Stage)];
+	Stats.RegisteredCount = List.LiveCount;
+	Stats.Record(FPlatformTime::Seconds() - StartTime, TickedCount);
+}
+
+void UMOMedicalSchedulerSubsystem::RunVitalsStageBatched(float DeltaSeconds)
+{
+	const double StartTime = FPlatformTime::Seconds();
+	int32 TickedCount = 0;
+
+	VitalsBatch.Reset();
+	VitalsBatchComponents.Reset();
+	VitalsBatchSteps.Reset();
+
+	// Gather: run the first half of each due tick and snapshot derivation inputs
+	TArray<int32, TInlineAllocator<16>> ExtraTickIndices;
+	for (int32 i = 0; i < VitalsStage.Components.Num(); ++i)
+	{
+		UMOVitalsComponent* Component = VitalsStage.Components[i].Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		float& Accumulator = VitalsStage.Accumulators[i];
+		Accumulator += DeltaSeconds;
+
+		const EMOMedicalSimLOD LOD = VitalsStage.LODs[i];
+		if (LOD == EMOMedicalSimLOD::Dormant)
+		{
+			continue;
+		}
+
+		const float Step = GetStepForLOD(Component->TickInterval, LOD);
+		if (Accumulator + KINDA_SMALL_NUMBER < Step)
+		{
+			continue;
+		}
+
+		Accumulator -= Step;
+		if (Accumulator + KINDA_SMALL_NUMBER >= Step)
+		{
+			// Component ticks faster than the pass; catch up the remainder on the scalar path
+			ExtraTickIndices.Add(i);
+		}
+
+		if (Component->BeginVitalsTick())
+		{
+			VitalsBatch.Add(Component->BuildDerivationInput());
+			VitalsBatchComponents.Add(Component);
+			VitalsBatchSteps.Add(Step);
+		}
+	}
+
+	VitalsBatch.DeriveAll();
+
+	// Scatter: apply outputs and run the second half of each tick
+	for (int32 BatchIndex = 0; BatchIndex < VitalsBatchComponents.Num(); ++BatchIndex)
+	{
+		if (UMOVitalsComponent* Component = VitalsBatchComponents[BatchIndex].Get())
+		{
+			Component->ApplyDerivedVitals(VitalsBatch.GetOutput(BatchIndex));
+			Component->FinishVitalsTick(VitalsBatchSteps[BatchIndex]);
+			TickedCount++;
+		}
+	}
+
+	for (const int32 Index : ExtraTickIndices)
+	{
+		float& Accumulator = VitalsStage.Accumulators[Index];
+		while (UMOVitalsComponent* Component = VitalsStage.Components[Index].Get())
+		{
+			const float Step = GetStepForLOD(Component->TickInterval, VitalsStage.LODs[Index]);
+			if (Accumulator + KINDA_SMALL_NUMBER < Step)
+			{
+				break;
+			}
+
+			Accumulator -= Step;
+			Component->AdvanceSimulation(Step);
+			TickedCount++;
+		}
+	}
+
+	FMOMedicalStageStats& Stats = StageStats[static_cast<int32>(EMOMedicalSimStage::Vitals)];
+	Stats.RegisteredCount = VitalsStage.LiveCount;
+	Stats.Record(FPlatformTime::Seconds() - StartTime, TickedCount);
+}
+
+void UMOMedicalSchedulerSubsystem::RunPass()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(MOMedicalScheduler_RunPass);
+
+	const double StartTime = FPlatformTime::Seconds();
+	const float DeltaSeconds = PassInterval;
+
+	bIsRunningPass = true;
+
+	const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+	const bool bLODEnabled = Settings && Settings->bEnableSimulationLOD;
+	LODRefreshAccumulator += DeltaSeconds;
+
+	// Refresh tiers periodically; if LOD was switched off at runtime, wake everyone once
+	if (bLODEnabled ? LODRefreshAccumulator >= Settings->LODUpdateInterval : ActorLODs.Num() > 0)
+	{
+		RefreshLOD();
+	}
+
+	// Wound/condition transitions first so the anatomy stage sees their results
+	ProcessDueEvents();
+
+	// Fixed dependency order: anatomy feeds pain/bleed into vitals, vitals feeds
+	// glucose/oxygen into metabolism and mental, survival reads the results.
+	RunStage(EMOMedicalSimStage::Anatomy, AnatomyStage, DeltaSeconds, &UMOAnatomyComponent::AdvanceSimulation, &UMOAnatomyComponent::TickInterval);
+	if (Settings && Settings->bUseVitalsBatchKernels)
+	{
+		RunVitalsStageBatched(DeltaSeconds);
+	}
+	else
+	{
+		RunStage(EMOMedicalSimStage::Vitals, VitalsStage, DeltaSeconds, &UMOVitalsComponent::AdvanceSimulation, &UMOVitalsComponent::TickInterval);
+	}
+	RunStage(EMOMedicalSimStage::Metabolism, MetabolismStage, DeltaSeconds, &UMOMetabolismComponent::AdvanceSimulation, &UMOMetabolismComponent::TickInterval);
+	RunStage(EMOMedicalSimStage::Mental, MentalStage, DeltaSeconds, &UMOMentalStateComponent::AdvanceSimulation, &UMOMentalStateComponent::TickInterval);
+	RunStage(EMOMedicalSimStage::SurvivalStats, SurvivalStage, DeltaSeconds, &UMOSurvivalStatsComponent::AdvanceSimulation, &UMOSurvivalStatsComponent::TickInterval);
+
+	bIsRunningPass = false;
+
+	CompactStagesIfNeeded();
+	FlushMedicalDeltas();
+
+	int32 TotalTicked = 0;
+	for (const FMOMedicalStageStats& Stats : StageStats)
+	{
+		TotalTicked += Stats.LastTickedCount;
+	}
+
+	PassStats.RegisteredCount = GetTotalLiveCount();
+	PassStats.Record(FPlatformTime::Seconds() - StartTime, TotalTicked);
+
+	StopTimerIfIdle();
+}
+
+// ============================================================================
+// EVENT QUEUE
+// ============================================================================
+
+void UMOMedicalSchedulerSubsystem::ScheduleMedicalEvent(UMOAnatomyComponent* Component, const FGuid& TargetId, bool bIsCondition, uint32 Serial, double Time)
+{
+	if (!Component)
+	{
+		return;
+	}
+
+	FMedicalEvent Event;
+	Event.Time = Time;
+	Event.Component = Component;
+	Event.TargetId = TargetId;
+	Event.Serial = Serial;
+	Event.bIsCondition = bIsCondition;
+	EventQueue.HeapPush(MoveTemp(Event));
+}
+
+void UMOMedicalSchedulerSubsystem::ProcessDueEvents()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(MOMedicalScheduler_ProcessDueEvents);
+
+	UWorld* World = GetWorld();
+	if (!World || EventQueue.Num() == 0)
+	{
+		return;
+	}
+
+	const double Now = World->GetTimeSeconds();
+
+	// Pop everything due first; handlers reschedule into the heap and those
+	// entries must wait for the next pass even if they are already due.
+	DueEvents.Reset();
+	while (EventQueue.Num() > 0 && EventQueue.HeapTop().Time <= Now)
+	{
+		FMedicalEvent Event;
+		EventQueue.HeapPop(Event, EAllowShrinking::No);
+		DueEvents.Add(MoveTemp(Event));
+	}
+
+	for (const FMedicalEvent& Event : DueEvents)
+	{
+		if (UMOAnatomyComponent* Component = Event.Component.Get())
+		{
+			Component->HandleScheduledEvent(Event.TargetId, Event.bIsCondition, Event.Serial);
+		}
+	}
+}
+
+// ============================================================================
+// CHANGE NOTIFICATION
+// ============================================================================
+
+void UMOMedicalSchedulerSubsystem::QueueMedicalDelta(const UActorComponent* Source, const FMOMedicalDelta& Delta)
+{
+	if (!Source || Delta.IsEmpty())
+	{
+		return;
+	}
+
+	UWorld* World = Source->GetWorld();
+	UMOMedicalSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UMOMedicalSchedulerSubsystem>() : nullptr;
+	if (!Scheduler)
+	{
+		return;
+	}
+
+	Scheduler->PendingDeltas.FindOrAdd(Source->GetOwner()).ChangedFields |= Delta.ChangedFields;
+
+	// Inside a pass the flush happens when the pass ends
+	if (!Scheduler->bIsRunningPass && !Scheduler->bDeltaFlushScheduled)
+	{
+		Scheduler->bDeltaFlushScheduled = true;
+		World->GetTimerManager().SetTimerForNextTick(Scheduler, &UMOMedicalSchedulerSubsystem::FlushMedicalDeltas);
+	}
+}
+
+void UMOMedicalSchedulerSubsystem::FlushMedicalDeltas()
+{
+	bDeltaFlushScheduled = false;
+
+	if (PendingDeltas.Num() == 0)
+	{
+		return;
+	}
+
+	// Listeners may queue new deltas while we broadcast
+	TMap<TWeakObjectPtr<AActor>, FMOMedicalDelta> Deltas = MoveTemp(PendingDeltas);
+	PendingDeltas.Reset();
+
+	for (const TPair<TWeakObjectPtr<AActor>, FMOMedicalDelta>& Pair : Deltas)
+	{
+		if (AActor* Pawn = Pair.Key.Get())
+		{
+			OnMedicalDelta.Broadcast(Pawn, Pair.Value);
+		}
+	}
+}
+
+// ============================================================================
+// LEVEL OF DETAIL
+// ============================================================================
+
+float UMOMedicalSchedulerSubsystem::GetStepForLOD(float Interval, EMOMedicalSimLOD LOD) const
+{
+	const float BaseStep = FMath::Max(Interval, KINDA_SMALL_NUMBER);
+	return (LOD == EMOMedicalSimLOD::Coarse) ? BaseStep * CoarseStepMultiplier : BaseStep;
+}
+
+EMOMedicalSimLOD UMOMedicalSchedulerSubsystem::ComputeActorLOD(const AActor* Actor, const TArray<FVector>& Viewpoints) const
+{
+	const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+	if (!Actor || !Settings)
+	{
+		return EMOMedicalSimLOD::Full;
+	}
+
+	// Possessed pawns are always fully simulated, wherever their camera is
+	const APawn* Pawn = Cast<APawn>(Actor);
+	if (Pawn && Pawn->IsPlayerControlled())
+	{
+		return EMOMedicalSimLOD::Full;
+	}
+
+	double MinDistSq = TNumericLimits<double>::Max();
+	const FVector ActorLocation = Actor->GetActorLocation();
+	for (const FVector& Viewpoint : Viewpoints)
+	{
+		MinDistSq = FMath::Min(MinDistSq, FVector::DistSquared(ActorLocation, Viewpoint));
+	}
+
+	if (MinDistSq <= FMath::Square(static_cast<double>(Settings->FullDetailDistance)))
+	{
+		return EMOMedicalSimLOD::Full;
+	}
+
+	if (MinDistSq <= FMath::Square(static_cast<double>(Settings->CoarseDetailDistance)))
+	{
+		return EMOMedicalSimLOD::Coarse;
+	}
+
+	// Bleeding pawns can die; keep them simulated so death happens on time
+	const UMOAnatomyComponent* Anatomy = Actor->FindComponentByClass<UMOAnatomyComponent>();
+	if (Anatomy && Anatomy->GetTotalBleedRate() > 0.0f)
+	{
+		return EMOMedicalSimLOD::Coarse;
+	}
+
+	return EMOMedicalSimLOD::Dormant;
+}
+
+template<typename ComponentType, typename CatchUpReturnType>
+void UMOMedicalSchedulerSubsystem::ApplyLODToStage(TStageList<ComponentType>& List, CatchUpReturnType (ComponentType::*CatchUpFunction)(float),
+	float ComponentType::*IntervalMember, float MaxCatchUpStep)
+{
+	for (int32 i = 0; i < List.Components.Num(); ++i)
+	{
+		ComponentType* Component = List.Components[i].Get();
+		if (!Component)
+		{
+			continue;
+		}
+
+		const EMOMedicalSimLOD* Found = ActorLODs.Find(Component->GetOwner());
+		const EMOMedicalSimLOD NewLOD = Found ? *Found : EMOMedicalSimLOD::Full;
+		const EMOMedicalSimLOD OldLOD = List.LODs[i];
+		List.LODs[i] = NewLOD;
+
+		if (OldLOD != EMOMedicalSimLOD::Dormant || NewLOD == EMOMedicalSimLOD::Dormant)
+		{
+			continue;
+		}
+
+		// Waking up: replay the banked time in a few large steps
+		const float Interval = FMath::Max(Component->*IntervalMember, KINDA_SMALL_NUMBER);
+		const float MaxStep = FMath::Max(MaxCatchUpStep, Interval);
+		float& Accumulator = List.Accumulators[i];
+
+		while (Accumulator + KINDA_SMALL_NUMBER >= Interval)
+		{
+			const float Step = FMath::Min(Accumulator, MaxStep);
+			Accumulator -= Step;
+			(Component->*CatchUpFunction)(Step);
+
+			if (!List.Components[i].IsValid())
+			{
+				break;
+			}
+		}
+	}
+}
+
+void UMOMedicalSchedulerSubsystem::RefreshLOD()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(MOMedicalScheduler_RefreshLOD);
+
+	LODRefreshAccumulator = 0.0f;
+
+	const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+	const bool bLODEnabled = Settings && Settings->bEnableSimulationLOD;
+	CoarseStepMultiplier = Settings ? FMath::Max(Settings->CoarseStepMultiplier, 1.0f) : 4.0f;
+
+	ActorLODs.Reset();
+	FMemory::Memzero(LODCounts);
+
+	UWorld* World = GetWorld();
+	if (bLODEnabled && World)
+	{
+		TArray<FVector> Viewpoints;
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			if (const APlayerController* PC = It->Get())
+			{
+				FVector Location;
+				FRotator Rotation;
+				PC->GetPlayerViewPoint(Location, Rotation);
+				Viewpoints.Add(Location);
+			}
+		}
+
+		// Every stage shares owners, but a pawn may be missing some components
+		auto ClassifyOwners = [this, &Viewpoints](const auto& List)
+		{
+			for (const auto& WeakComponent : List.Components)
+			{
+				const AActor* Owner = WeakComponent.IsValid() ? WeakComponent->GetOwner() : nullptr;
+				if (Owner && !ActorLODs.Contains(Owner))
+				{
+					const EMOMedicalSimLOD LOD = ComputeActorLOD(Owner, Viewpoints);
+					ActorLODs.Add(Owner, LOD);
+					LODCounts[static_cast<int32>(LOD)]++;
+				}
+			}
+		};
+
+		ClassifyOwners(AnatomyStage);
+		ClassifyOwners(VitalsStage);
+		ClassifyOwners(MetabolismStage);
+		ClassifyOwners(MentalStage);
+		ClassifyOwners(SurvivalStage);
+	}
+
+	// Catch-up advances can end play; defer removals the same way a pass does
+	const bool bWasRunningPass = bIsRunningPass;
+	bIsRunningPass = true;
+
+	const float MaxCatchUpStep = Settings ? Settings->DormantCatchUpMaxStep : 10.0f;
+
+	// Metabolism integrates long spans itself, so it catches up in a single call
+	ApplyLODToStage(AnatomyStage, &UMOAnatomyComponent::AdvanceSimulation, &UMOAnatomyComponent::TickInterval, MaxCatchUpStep);
+	ApplyLODToStage(VitalsStage, &UMOVitalsComponent::AdvanceSimulation, &UMOVitalsComponent::TickInterval, MaxCatchUpStep);
+	ApplyLODToStage(MetabolismStage, &UMOMetabolismComponent::FastForward, &UMOMetabolismComponent::TickInterval, TNumericLimits<float>::Max());
+	ApplyLODToStage(MentalStage, &UMOMentalStateComponent::AdvanceSimulation, &UMOMentalStateComponent::TickInterval, MaxCatchUpStep);
+	ApplyLODToStage(SurvivalStage, &UMOSurvivalStatsComponent::AdvanceSimulation, &UMOSurvivalStatsComponent::TickInterval, MaxCatchUpStep);
+
+	bIsRunningPass = bWasRunningPass;
+	if (!bIsRunningPass)
+	{
+		CompactStagesIfNeeded();
+	}
+}
+
+EMOMedicalSimLOD UMOMedicalSchedulerSubsystem::GetActorLOD(const AActor* Actor) const
+{
+	const EMOMedicalSimLOD* Found = ActorLODs.Find(Actor);
+	return Found ? *Found : EMOMedicalSimLOD::Full;
+}
+
+int32 UMOMedicalSchedulerSubsystem::GetActorCountForLOD(EMOMedicalSimLOD LOD) const
+{
+	const int32 Index = static_cast<int32>(LOD);
+	if (Index < 0 || Index >= static_cast<int32>(EMOMedicalSimLOD::MAX))
+	{
+		return 0;
+	}
+
+	return LODCounts[Index];
+}
+
+// ============================================================================
+// STATS QUERIES
+// ============================================================================
+
+FMOMedicalStageStats UMOMedicalSchedulerSubsystem::GetStageStats(EMOMedicalSimStage Stage) const
+{
+	const int32 Index = static_cast<int32>(Stage);
+	if (Index < 0 || Index >= static_cast<int32>(EMOMedicalSimStage::MAX))
+	{
+		return FMOMedicalStageStats();
+	}
+
+	return StageStats[Index];
+}
+
+void UMOMedicalSchedulerSubsystem::ResetStats()
+{
+	for (FMOMedicalStageStats& Stats : StageStats)
+	{
+		const int32 Registered = Stats.RegisteredCount;
+		Stats = FMOMedicalStageStats();
+		Stats.RegisteredCount = Registered;
+	}
+
+	const int32 Registered = PassStats.RegisteredCount;
+	PassStats = FMOMedicalStageStats();
+	PassStats.RegisteredCount = Registered;
+}
+
+FString UMOMedicalSchedulerSubsystem::GetStatsDebugString() const
+{
+	FString Result = FString::Printf(TEXT("MedicalScheduler: %d components, pass %.3fms (avg %.3fms, peak %.3fms)\n"),
+		PassStats.RegisteredCount, PassStats.LastDurationMs, PassStats.AverageDurationMs, PassStats.PeakDurationMs);
+
+	if (ActorLODs.Num() > 0)
+	{
+		Result += FString::Printf(TEXT("  LOD: %d full, %d coarse, %d dormant\n"),
+			LODCounts[static_cast<int32>(EMOMedicalSimLOD::Full)],
+			LODCounts[static_cast<int32>(EMOMedicalSimLOD::Coarse)],
+			LODCounts[static_cast<int32>(EMOMedicalSimLOD::Dormant)]);
+	}
+
+	if (EventQueue.Num() > 0)
+	{
+		Result += FString::Printf(TEXT("  Events: %d pending, next at %.1fs\n"), EventQueue.Num(), EventQueue.HeapTop().Time);
+	}
+
+	const UEnum* StageEnum = StaticEnum<EMOMedicalSimStage>();
+	for (int32 i = 0; i < static_cast<int32>(EMOMedicalSimStage::MAX); ++i)
+	{
+		const FMOMedicalStageStats& Stats = StageStats[i];
+		Result += FString::Printf(TEXT("  %s: %d registered, %d ticked, %.3fms (avg %.3fms, peak %.3fms)\n"),
+			StageEnum ? *StageEnum->GetDisplayNameTextByIndex(i).ToString() : TEXT("?"),
+			Stats.RegisteredCount, Stats.LastTickedCount, Stats.LastDurationMs, Stats.AverageDurationMs, Stats.PeakDurationMs);
+	}
+
+	return Result;
+}
@@ -1,6 +1,35 @@
 #include "MOMedicalTypes.h"
 #include "MOAnatomyComponent.h"
 #include "MOMetabolismComponent.h"
+#include "MOIdentityComponent.h"
+#include "MOMedicalDatabaseSettings.h"
+#include "GameFramework/Actor.h"
+
+namespace MOMedicalNetQuantize
+{
+	/**
+	 * Write Value as an integer in [0, 2^NumBits - 1] spanning [Min, Max], or read it back.
+	 * Values outside the range are clamped.
+	 */
+	static void SerializeQuantized(FArchive& Ar, float& Value, float Min, float Max, int32 NumBits)
+	{
+		const uint32 MaxQuantized = (1u << NumBits) - 1;
+		uint32 Quantized = 0;
+
+		if (Ar.IsSaving())
+		{
+			const float Alpha = (FMath::Clamp(Value, Min, Max) - Min) / (Max - Min);
+			Quantized = static_cast<uint32>(FMath::RoundToInt(Alpha * MaxQuantized));
+		}
+
+		Ar.SerializeInt(Quantized, MaxQuantized + 1);
+
+		if (Ar.IsLoading())
+		{
+			Value = Min + (Max - Min) * (static_cast<float>(Quantized) / MaxQuantized);
+		}
+	}
+}
 
 // ============================================================================
 // FMOWoundList Implementation
@@ -220,3 +249,107 @@ void FMODigestingFoodList::RemoveCompletedItems()
 		MarkArrayDirty();
 	}
 }
+
+// ============================================================================
+// FMOBodyPartState / FMOVitalSigns Net Serialization
+// ============================================================================
+
+bool FMOBodyPartState::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace MOMedicalNetQuantize;
+
+	Ar << PartType;
+	Ar << Status;
+
+	// Field			Min		Max			Bits	Step
+	// MaxHP			0		1000		12		~0.25
+	// HP fraction		0		1			10		~0.1%
+	// BoneDensity		0.1		2.0			8		~0.007
+	SerializeQuantized(Ar, MaxHP, 0.0f, 1000.0f, 12);
+
+	float HPFraction = (MaxHP > 0.0f) ? CurrentHP / MaxHP : 0.0f;
+	SerializeQuantized(Ar, HPFraction, 0.0f, 1.0f, 10);
+	if (Ar.IsLoading())
+	{
+		CurrentHP = HPFraction * MaxHP;
+	}
+
+	SerializeQuantized(Ar, BoneDensity, 0.1f, 2.0f, 8);
+
+	bOutSuccess = true;
+	return true;
+}
+
+bool FMOVitalSigns::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	using namespace MOMedicalNetQuantize;
+
+	// Field				Min		Max			Bits	Step
+	// BloodVolume			0		10000		12		~2.4 mL
+	// MaxBloodVolume		0		10000		12		~2.4 mL
+	// HeartRate			0		300			10		~0.3 bpm
+	// BaseHeartRate		0		300			10		~0.3 bpm
+	// SystolicBP			0		300			10		~0.3 mmHg
+	// DiastolicBP			0		200			10		~0.2 mmHg
+	// RespiratoryRate		0		60			8		~0.24 /min
+	// SpO2					0		100			10		~0.1 %
+	// BodyTemperature		20		45			10		~0.025 C
+	// BloodGlucose			0		600			10		~0.6 mg/dL
+	SerializeQuantized(Ar, BloodVolume, 0.0f, 10000.0f, 12);
+	SerializeQuantized(Ar, MaxBloodVolume, 0.0f, 10000.0f, 12);
+	SerializeQuantized(Ar, HeartRate, 0.0f, 300.0f, 10);
+	SerializeQuantized(Ar, BaseHeartRate, 0.0f, 300.0f, 10);
+	SerializeQuantized(Ar, SystolicBP, 0.0f, 300.0f, 10);
+	SerializeQuantized(Ar, DiastolicBP, 0.0f, 200.0f, 10);
+	SerializeQuantized(Ar, RespiratoryRate, 0.0f, 60.0f, 8);
+	SerializeQuantized(Ar, SpO2, 0.0f, 100.0f, 10);
+	SerializeQuantized(Ar, BodyTemperature, 20.0f, 45.0f, 10);
+	SerializeQuantized(Ar, BloodGlucose, 0.0f, 600.0f, 10);
+
+	bOutSuccess = true;
+	return true;
+}
+
+// ============================================================================
+// FMOMedicalRandom Implementation
+// ============================================================================
+
+int32 FMOMedicalRandom::MakeSeed(const FGuid& IdentityGuid, int32 WorldSeed, uint32 Salt)
+{
+	// Only content-based hashes here; FName hashes differ between runs
+	uint32 Hash = FCrc::MemCrc32(&IdentityGuid, sizeof(FGuid));
+	Hash = HashCombine(Hash, static_cast<uint32>(WorldSeed));
+	Hash = HashCombine(Hash, Salt);
+	return static_cast<int32>(Hash);
+}
+
+void FMOMedicalRandom::InitStream(FRandomStream& Stream, const UActorComponent* Component)
+{
+	if (!Component)
+	{
+		Stream.Initialize(0);
+		return;
+	}
+
+	const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+	const int32 WorldSeed = Settings ? Settings->MedicalRandomSeed : 0;
+
+	// Different component types on the same pawn get independent streams
+	const uint32 Salt = FCrc::StrCrc32(*Component->GetClass()->GetName());
+
+	FGuid IdentityGuid;
+	AActor* Owner = Component->GetOwner();
+	if (UMOIdentityComponent* Identity = Owner ? Owner->FindComponentByClass<UMOIdentityComponent>() : nullptr)
+	{
+		IdentityGuid = Identity->GetOrCreateGuid();
+	}
+
+	if (!IdentityGuid.IsValid() && Owner)
+	{
+		// No stable identity: fall back to the actor name, which is deterministic for
+		// placed actors and for spawns made in the same order
+		IdentityGuid.A = FCrc::StrCrc32(*Owner->GetName());
+	}
+
+	Stream.Initialize(MakeSeed(IdentityGuid, WorldSeed, Salt));
+}
@@ -2,6 +2,8 @@
 #include "MOVitalsComponent.h"
 #include "MOAnatomyComponent.h"
 #include "MOMetabolismComponent.h"
+#include "MOMedicalSchedulerSubsystem.h"
+#include "MOIdentityComponent.h"
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 
@@ -23,27 +25,50 @@ void UMOMentalStateComponent::BeginPlay()
 		CachedMetabolismComp = Owner->FindComponentByClass<UMOMetabolismComponent>();
 	}
 
+	ReseedRandomStream();
+
+	// Loading or possession can assign the identity GUID after BeginPlay
+	if (UMOIdentityComponent* Identity = GetOwner() ? GetOwner()->FindComponentByClass<UMOIdentityComponent>() : nullptr)
+	{
+		Identity->OnGuidAvailable.AddUniqueDynamic(this, &UMOMentalStateComponent::HandleIdentityGuidAvailable);
+	}
+
 	// Initialize previous state
 	PreviousConsciousness = MentalState.Consciousness;
 
 	// Start tick timer on authority
 	if (GetOwnerRole() == ROLE_Authority)
 	{
-		if (UWorld* World = GetWorld())
+		// Prefer the batched world scheduler; fall back to a per-component timer
+		UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this);
+		if (!Scheduler || !Scheduler->RegisterComponent(this))
 		{
-			World->GetTimerManager().SetTimer(
-				TickTimerHandle,
-				this,
-				&UMOMentalStateComponent::TickMentalState,
-				TickInterval,
-				true
-			);
+			if (UWorld* World = GetWorld())
+			{
+				World->GetTimerManager().SetTimer(
+					TickTimerHandle,
+					this,
+					&UMOMentalStateComponent::TickMentalState,
+					TickInterval,
+					true
+				);
+			}
 		}
 	}
 }
 
 void UMOMentalStateComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UMOIdentityComponent* Identity = GetOwner() ? GetOwner()->FindComponentByClass<UMOIdentityComponent>() : nullptr)
+	{
+		Identity->OnGuidAvailable.RemoveDynamic(this, &UMOMentalStateComponent::HandleIdentityGuidAvailable);
+	}
+
+	if (UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this))
+	{
+		Scheduler->UnregisterComponent(this);
+	}
+
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(TickTimerHandle);
@@ -300,7 +325,17 @@ float UMOMentalStateComponent::GetStumblingChance() const
 
 bool UMOMentalStateComponent::RollForStumble()
 {
-	return FMath::FRand() < MentalState.StumblingChance;
+	return RandomStream.FRand() < MentalState.StumblingChance;
+}
+
+void UMOMentalStateComponent::ReseedRandomStream()
+{
+	FMOMedicalRandom::InitStream(RandomStream, this);
+}
+
+void UMOMentalStateComponent::HandleIdentityGuidAvailable(const FGuid& StableGuid)
+{
+	ReseedRandomStream();
 }
 
 // ============================================================================
@@ -331,13 +366,18 @@ bool UMOMentalStateComponent::ApplySaveDataAuthority(const FMOMentalStateSaveDat
 // ============================================================================
 
 void UMOMentalStateComponent::TickMentalState()
+{
+	AdvanceSimulation(TickInterval);
+}
+
+void UMOMentalStateComponent::AdvanceSimulation(float DeltaSeconds)
 {
 	if (GetOwnerRole() != ROLE_Authority)
 	{
 		return;
 	}
 
-	float ScaledDeltaTime = TickInterval * TimeScaleMultiplier;
+	float ScaledDeltaTime = DeltaSeconds * TimeScaleMultiplier;
 
 	// Update external shock factors (blood loss, etc.)
 	UpdateExternalShockFactors();
@@ -375,8 +415,35 @@ void UMOMentalStateComponent::TickMentalState()
 		PreviousConsciousness = MentalState.Consciousness;
 	}
 
-	// Broadcast general mental state changed for UI updates
-	OnMentalStateChanged.Broadcast();
+	// Notify UI only when something visibly changed
+	const FMOMedicalDelta Delta = ConsumeMentalDelta();
+	if (!Delta.IsEmpty())
+	{
+		OnMentalStateChanged.Broadcast();
+		UMOMedicalSchedulerSubsystem::QueueMedicalDelta(this, Delta);
+	}
+}
+
+FMOMedicalDelta UMOMentalStateComponent::ConsumeMentalDelta()
+{
+	FMOMedicalDelta Delta;
+	FMOMentalState& Last = LastNotifiedMentalState;
+
+	if (MentalState.Consciousness != Last.Consciousness)
+	{
+		Last.Consciousness = MentalState.Consciousness;
+		Delta.MarkField(EMOMedicalDeltaField::Consciousness);
+	}
+
+	Delta.CheckField(EMOMedicalDeltaField::Shock, Last.ShockAccumulation, MentalState.ShockAccumulation, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Stress, Last.TraumaticStress, MentalState.TraumaticStress, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Stress, Last.MoraleFatigue, MentalState.MoraleFatigue, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::MentalEffects, Last.AimShakeIntensity, MentalState.AimShakeIntensity, 0.01f);
+	Delta.CheckField(EMOMedicalDeltaField::MentalEffects, Last.TunnelVisionIntensity, MentalState.TunnelVisionIntensity, 0.01f);
+	Delta.CheckField(EMOMedicalDeltaField::MentalEffects, Last.BlurredVisionIntensity, MentalState.BlurredVisionIntensity, 0.01f);
+	Delta.CheckField(EMOMedicalDeltaField::MentalEffects, Last.StumblingChance, MentalState.StumblingChance, 0.01f);
+
+	return Delta;
 }
 
 void UMOMentalStateComponent::CalculateConsciousnessLevel()
@@ -2,6 +2,7 @@
 #include "MOVitalsComponent.h"
 #include "MOAnatomyComponent.h"
 #include "MOItemDefinitionRow.h"
+#include "MOMedicalSchedulerSubsystem.h"
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 
@@ -27,21 +28,31 @@ void UMOMetabolismComponent::BeginPlay()
 	// Start tick timer on authority
 	if (GetOwnerRole() == ROLE_Authority)
 	{
-		if (UWorld* World = GetWorld())
+		// Prefer the batched world scheduler; fall back to a per-component timer
+		UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this);
+		if (!Scheduler || !Scheduler->RegisterComponent(this))
 		{
-			World->GetTimerManager().SetTimer(
-				TickTimerHandle,
-				this,
-				&UMOMetabolismComponent::TickMetabolism,
-				TickInterval,
-				true
-			);
+			if (UWorld* World = GetWorld())
+			{
+				World->GetTimerManager().SetTimer(
+					TickTimerHandle,
+					this,
+					&UMOMetabolismComponent::TickMetabolism,
+					TickInterval,
+					true
+				);
+			}
 		}
 	}
 }
 
 void UMOMetabolismComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this))
+	{
+		Scheduler->UnregisterComponent(this);
+	}
+
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(TickTimerHandle);
@@ -59,6 +70,13 @@ void UMOMetabolismComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty
 	DOREPLIFETIME_CONDITION(UMOMetabolismComponent, DigestingFood, COND_OwnerOnly);
 }
 
+void UMOMetabolismComponent::GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize)
+{
+	Super::GetResourceSizeEx(CumulativeResourceSize);
+
+	CumulativeResourceSize.AddDedicatedSystemMemoryBytes(DigestingFood.Items.GetAllocatedSize());
+}
+
 // ============================================================================
 // FOOD API
 // ============================================================================
@@ -463,13 +481,18 @@ bool UMOMetabolismComponent::ApplySaveDataAuthority(const FMOMetabolismSaveData&
 // ============================================================================
 
 void UMOMetabolismComponent::TickMetabolism()
+{
+	AdvanceSimulation(TickInterval);
+}
+
+void UMOMetabolismComponent::AdvanceSimulation(float DeltaSeconds)
 {
 	if (GetOwnerRole() != ROLE_Authority)
 	{
 		return;
 	}
 
-	float ScaledDeltaTime = TickInterval * TimeScaleMultiplier;
+	float ScaledDeltaTime = DeltaSeconds * TimeScaleMultiplier;
 
 	// Process all metabolism functions
 	ProcessDigestion(ScaledDeltaTime);
@@ -480,6 +503,41 @@ void UMOMetabolismComponent::TickMetabolism()
 	ProcessTrainingAdaptations(ScaledDeltaTime);
 	UpdateBodyWeight(ScaledDeltaTime);
 
+	UpdateMetabolismState();
+}
+
+bool UMOMetabolismComponent::FastForward(float Seconds)
+{
+	if (GetOwnerRole() != ROLE_Authority || Seconds <= 0.0f)
+	{
+		return false;
+	}
+
+	float RemainingTime = Seconds * TimeScaleMultiplier;
+	const float MaxSegment = FMath::Max(FastForwardMaxSegment, 1.0f);
+
+	// Split at digestion phase boundaries so every segment integrates exactly for food;
+	// the remaining processes are linear in time (with clamps) and take the segment as one step
+	while (RemainingTime > KINDA_SMALL_NUMBER)
+	{
+		const float Segment = FMath::Min(RemainingTime, GetNextDigestionBoundary(MaxSegment));
+		RemainingTime -= Segment;
+
+		FastForwardDigestion(Segment);
+		ProcessBasalMetabolism(Segment);
+		ProcessHydration(Segment);
+		ProcessNutrientDecay(Segment);
+		ProcessFitnessDecay(Segment);
+		ProcessTrainingAdaptations(Segment);
+		UpdateBodyWeight(Segment);
+	}
+
+	UpdateMetabolismState();
+	return true;
+}
+
+void UMOMetabolismComponent::UpdateMetabolismState()
+{
 	// Check for state changes
 	bool bIsDehydrated = IsDehydrated();
 	bool bIsStarving = IsStarving();
@@ -499,18 +557,65 @@ void UMOMetabolismComponent::TickMetabolism()
 	// Check deficiencies
 	CheckDeficiencies();
 
-	// Broadcast general metabolism changed for UI updates
-	OnMetabolismChanged.Broadcast();
+	// Notify UI only when something visibly changed
+	const FMOMedicalDelta Delta = ConsumeMetabolismDelta();
+	if (!Delta.IsEmpty())
+	{
+		OnMetabolismChanged.Broadcast();
+		UMOMedicalSchedulerSubsystem::QueueMedicalDelta(this, Delta);
+	}
 }
 
-void UMOMetabolismComponent::ProcessDigestion(float DeltaTime)
+FMOMedicalDelta UMOMetabolismComponent::ConsumeMetabolismDelta()
 {
-	TArray<FGuid> CompletedItems;
+	FMOMedicalDelta Delta;
+	FMONutrientLevels& Last = LastNotifiedNutrients;
+	FMOBodyComposition& LastBody = LastNotifiedBody;
+
+	Delta.CheckField(EMOMedicalDeltaField::Glycogen, Last.GlycogenStores, Nutrients.GlycogenStores, 1.0f);
+	Delta.CheckField(EMOMedicalDeltaField::Hydration, Last.HydrationLevel, Nutrients.HydrationLevel, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::ProteinBalance, Last.ProteinBalance, Nutrients.ProteinBalance, 0.5f);
+
+	Delta.CheckField(EMOMedicalDeltaField::Micronutrients, Last.VitaminA, Nutrients.VitaminA, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Micronutrients, Last.VitaminB, Nutrients.VitaminB, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Micronutrients, Last.VitaminC, Nutrients.VitaminC, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Micronutrients, Last.VitaminD, Nutrients.VitaminD, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Micronutrients, Last.Iron, Nutrients.Iron, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Micronutrients, Last.Calcium, Nutrients.Calcium, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Micronutrients, Last.Potassium, Nutrients.Potassium, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::Micronutrients, Last.Sodium, Nutrients.Sodium, 0.5f);
+
+	Delta.CheckField(EMOMedicalDeltaField::BodyComposition, LastBody.TotalWeight, BodyComposition.TotalWeight, 0.05f);
+	Delta.CheckField(EMOMedicalDeltaField::BodyComposition, LastBody.BodyFatPercent, BodyComposition.BodyFatPercent, 0.05f);
+	Delta.CheckField(EMOMedicalDeltaField::BodyComposition, LastBody.MuscleMass, BodyComposition.MuscleMass, 0.05f);
+	Delta.CheckField(EMOMedicalDeltaField::Fitness, LastBody.StrengthLevel, BodyComposition.StrengthLevel, 0.1f);
+	Delta.CheckField(EMOMedicalDeltaField::Fitness, LastBody.CardiovascularFitness, BodyComposition.CardiovascularFitness, 0.1f);
+
+	if (DigestingFood.Items.Num() != LastNotifiedDigestCount)
+	{
+		LastNotifiedDigestCount = DigestingFood.Items.Num();
+		Delta.MarkField(EMOMedicalDeltaField::Digestion);
+	}
+
+	return Delta;
+}
 
+void UMOMetabolismComponent::ProcessDigestion(float DeltaTime)
+{
 	for (FMODigestingFood& Food : DigestingFood.Items)
 	{
 		ProcessDigestingFood(Food, DeltaTime);
+	}
 
+	RemoveCompletedFood();
+}
+
+void UMOMetabolismComponent::RemoveCompletedFood()
+{
+	TArray<FGuid> CompletedItems;
+
+	for (const FMODigestingFood& Food : DigestingFood.Items)
+	{
 		if (Food.IsDigestionComplete())
 		{
 			CompletedItems.Add(Food.DigestId);
@@ -595,6 +700,94 @@ void UMOMetabolismComponent::ProcessDigestingFood(FMODigestingFood& Food, float
 					IronAbsorb, CalciumAbsorb, PotassiumAbsorb, SodiumAbsorb);
 }
 
+float UMOMetabolismComponent::GetNextDigestionBoundary(float MaxSegment) const
+{
+	// Phase edges as fractions of TotalDigestDuration (see ProcessDigestingFood)
+	static constexpr float PhaseBoundaries[] = { 0.1f, 0.3f, 0.7f, 1.0f };
+
+	float Result = MaxSegment;
+	for (const FMODigestingFood& Food : DigestingFood.Items)
+	{
+		if (Food.TotalDigestDuration <= 0.0f)
+		{
+			continue;
+		}
+
+		for (const float Fraction : PhaseBoundaries)
+		{
+			const float TimeToBoundary = Food.TotalDigestDuration * Fraction - Food.DigestTime;
+			if (TimeToBoundary > KINDA_SMALL_NUMBER)
+			{
+				Result = FMath::Min(Result, TimeToBoundary);
+				break;
+			}
+		}
+	}
+
+	return Result;
+}
+
+void UMOMetabolismComponent::FastForwardDigestion(float DeltaTime)
+{
+	// Per tick, ProcessDigestingFood removes a fraction Rate * dt / Duration of each
+	// remaining nutrient while its phase is active. In the small-step limit that is
+	// exponential decay, so over a span of ActiveTime the retained fraction is
+	// exp(-Rate * ActiveTime / Duration).
+	auto GetActiveTime = [](float Start, float End, float PhaseStart, float PhaseEnd)
+	{
+		return FMath::Max(0.0f, FMath::Min(End, PhaseEnd) - FMath::Max(Start, PhaseStart));
+	};
+
+	for (FMODigestingFood& Food : DigestingFood.Items)
+	{
+		const float StartTime = Food.DigestTime;
+		Food.DigestTime += DeltaTime;
+
+		const float Duration = Food.TotalDigestDuration;
+		if (Duration <= 0.0f)
+		{
+			continue;
+		}
+
+		// Nothing absorbs past the end of digestion; leftovers are discarded on completion
+		const float EndTime = FMath::Min(Food.DigestTime, Duration);
+		const float FullTime = GetActiveTime(StartTime, EndTime, 0.0f, Duration);
+		const float CarbTime = GetActiveTime(StartTime, EndTime, 0.0f, Duration * 0.3f);
+		const float ProteinTime = GetActiveTime(StartTime, EndTime, Duration * 0.1f, Duration * 0.7f);
+
+		const float CarbRetained = FMath::Exp(-3.0f * CarbTime / Duration);
+		const float ProteinRetained = FMath::Exp(-1.7f * ProteinTime / Duration);
+		const float WaterRetained = FMath::Exp(-2.0f * FullTime / Duration);
+		const float SlowRetained = FMath::Exp(-FullTime / Duration);
+
+		auto Absorb = [](float& Remaining, float Retained)
+		{
+			const float Absorbed = Remaining * (1.0f - Retained);
+			Remaining = FMath::Max(0.0f, Remaining - Absorbed);
+			return Absorbed;
+		};
+
+		const float CarbAbsorb = Absorb(Food.RemainingCarbs, CarbRetained);
+		const float ProteinAbsorb = Absorb(Food.RemainingProtein, ProteinRetained);
+		const float FatAbsorb = Absorb(Food.RemainingFat, SlowRetained);
+		const float WaterAbsorb = Absorb(Food.RemainingWater, WaterRetained);
+		const float VitAAbsorb = Absorb(Food.RemainingVitaminA, SlowRetained);
+		const float VitBAbsorb = Absorb(Food.RemainingVitaminB, SlowRetained);
+		const float VitCAbsorb = Absorb(Food.RemainingVitaminC, SlowRetained);
+		const float VitDAbsorb = Absorb(Food.RemainingVitaminD, SlowRetained);
+		const float IronAbsorb = Absorb(Food.RemainingIron, SlowRetained);
+		const float CalciumAbsorb = Absorb(Food.RemainingCalcite, SlowRetained);
+		const float PotassiumAbsorb = Absorb(Food.RemainingPotassium, SlowRetained);
+		const float SodiumAbsorb = Absorb(Food.RemainingSodium, SlowRetained);
+
+		AbsorbNutrients(CarbAbsorb, ProteinAbsorb, FatAbsorb, WaterAbsorb,
+						VitAAbsorb, VitBAbsorb, VitCAbsorb, VitDAbsorb,
+						IronAbsorb, CalciumAbsorb, PotassiumAbsorb, SodiumAbsorb);
+	}
+
+	RemoveCompletedFood();
+}
+
 void UMOMetabolismComponent::ProcessBasalMetabolism(float DeltaTime)
 {
 	// BMR is in kcal/day, convert to kcal/second
@@ -14,6 +14,7 @@
 #include "MOInventoryComponent.h"
 #include "MOItemComponent.h"
 #include "MOPersistenceSettings.h"
+#include "MOWorldItemIndexSubsystem.h"
 
 static FString StripUEDPIEPrefixes(const FString& InPath)
 {
@@ -811,50 +812,36 @@ void UMOPersistenceSubsystem::CaptureWorldItems(UWorld* World, UMOWorldSaveGame*
 
     SaveObject->WorldItems.Reset();
 
-    int32 TotalActors = 0;
+    // The world item index already holds every actor with an item component; no need to walk the whole world.
+    UMOWorldItemIndexSubsystem* ItemIndex = World->GetSubsystem<UMOWorldItemIndexSubsystem>();
+    if (!ItemIndex)
+    {
+        UE_LOG(LogMOFramework, Warning, TEXT("[MOPersist] SAVE ITEMS: No world item index for %s"), *GetNameSafe(World));
+        return;
+    }
+
+    TArray<UMOItemComponent*> IndexedItems;
+    ItemIndex->GetAllItems(IndexedItems);
+
     int32 SkippedNoPersist = 0;
     int32 SkippedNoIdentity = 0;
-    int32 SkippedNoItem = 0;
     int32 SkippedDestroyed = 0;
-    int32 SkippedPawn = 0;
 
-    for (TActorIterator<AActor> It(World); It; ++It)
+    for (UMOItemComponent* ItemComponent : IndexedItems)
     {
-        AActor* Actor = *It;
-        TotalActors++;
-
-        // Detailed check to see why items might be skipped
-        if (Actor->GetClass()->GetName().Contains(TEXT("WorldItem")) || Actor->GetClass()->GetName().Contains(TEXT("Apple")))
-        {
-            UMOIdentityComponent* DbgIdentity = Actor->FindComponentByClass<UMOIdentityComponent>();
-            UMOItemComponent* DbgItem = Actor->FindComponentByClass<UMOItemComponent>();
-            UE_LOG(LogMOFramework, Warning, TEXT("[MOPersist] WORLD ITEM CHECK: %s (Class: %s) at %s - Identity: %s, Item: %s, IsPawn: %s"),
-                *Actor->GetName(),
-                *Actor->GetClass()->GetName(),
-                *Actor->GetActorLocation().ToString(),
-                DbgIdentity ? TEXT("YES") : TEXT("NO"),
-                DbgItem ? TEXT("YES") : TEXT("NO"),
-                Cast<APawn>(Actor) ? TEXT("YES") : TEXT("NO"));
-        }
-
-        if (!IsPersistedWorldItemActor(Actor))
+        AActor* Actor = ItemComponent->GetOwner();
+        if (!IsValid(Actor) || Actor->IsActorBeingDestroyed() || Cast<APawn>(Actor))
         {
             SkippedNoPersist++;
             continue;
         }
 
         UMOIdentityComponent* IdentityComponent = Actor->FindComponentByClass<UMOIdentityComponent>();
-        UMOItemComponent* ItemComponent = Actor->FindComponentByClass<UMOItemComponent>();
         if (!IsValid(IdentityComponent))
         {
             SkippedNoIdentity++;
             continue;
         }
-        if (!IsValid(ItemComponent))
-        {
-            SkippedNoItem++;
-            continue;
-        }
 
         const FGuid ItemGuid = IdentityComponent->GetOrCreateGuid();
         if (!ItemGuid.IsValid())
@@ -888,8 +875,8 @@ void UMOPersistenceSubsystem::CaptureWorldItems(UWorld* World, UMOWorldSaveGame*
         SaveObject->WorldItems.Add(ItemRecord);
     }
 
-    UE_LOG(LogMOFramework, Warning, TEXT("[MOPersist] SAVE ITEMS SUMMARY: TotalActors=%d Captured=%d SkippedNoPersist=%d SkippedNoIdentity=%d SkippedNoItem=%d SkippedDestroyed=%d"),
-        TotalActors, SaveObject->WorldItems.Num(), SkippedNoPersist, SkippedNoIdentity, SkippedNoItem, SkippedDestroyed);
+    UE_LOG(LogMOFramework, Warning, TEXT("[MOPersist] SAVE ITEMS SUMMARY: Indexed=%d Captured=%d SkippedNoPersist=%d SkippedNoIdentity=%d SkippedDestroyed=%d"),
+        IndexedItems.Num(), SaveObject->WorldItems.Num(), SkippedNoPersist, SkippedNoIdentity, SkippedDestroyed);
 }
 
 void UMOPersistenceSubsystem::DestroyAllPersistedWorldItems(UWorld* World)
@@ -899,12 +886,21 @@ void UMOPersistenceSubsystem::DestroyAllPersistedWorldItems(UWorld* World)
         return;
     }
 
+    UMOWorldItemIndexSubsystem* ItemIndex = World->GetSubsystem<UMOWorldItemIndexSubsystem>();
+    if (!ItemIndex)
+    {
+        return;
+    }
+
+    TArray<UMOItemComponent*> IndexedItems;
+    ItemIndex->GetAllItems(IndexedItems);
+
     TArray<AActor*> ActorsToDestroy;
-    ActorsToDestroy.Reserve(64);
+    ActorsToDestroy.Reserve(IndexedItems.Num());
 
-    for (TActorIterator<AActor> It(World); It; ++It)
+    for (UMOItemComponent* ItemComponent : IndexedItems)
     {
-        AActor* Actor = *It;
+        AActor* Actor = ItemComponent->GetOwner();
         if (!IsPersistedWorldItemActor(Actor))
         {
             continue;
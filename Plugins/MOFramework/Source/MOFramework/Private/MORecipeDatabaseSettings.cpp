@@ -1,33 +1,249 @@
 #include "MORecipeDatabaseSettings.h"
+#include "MOFramework.h"
 
 #include "Engine/DataTable.h"
 #include "Engine/Texture2D.h"
 
+/*
+ * Recipe index
+ */
+
+void FMORecipeIndex::Reset()
+{
+	Rows.Reset();
+	Ids.Reset();
+	ByStation.Reset();
+	BySkill.Reset();
+	ByKnowledge.Reset();
+	ByIngredient.Reset();
+	ByOutput.Reset();
+	PositionById.Reset();
+}
+
+void FMORecipeIndex::Build(const UDataTable& DataTable)
+{
+	Reset();
+
+	const UScriptStruct* RowStruct = DataTable.GetRowStruct();
+	if (!RowStruct || !RowStruct->IsChildOf(FMORecipeDefinitionRow::StaticStruct()))
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MORecipeDatabase] Recipe DataTable '%s' does not use FMORecipeDefinitionRow; recipe lookups will fail."), *DataTable.GetName());
+		return;
+	}
+
+	const TMap<FName, uint8*>& RowMap = DataTable.GetRowMap();
+	Rows.Reserve(RowMap.Num());
+	Ids.Reserve(RowMap.Num());
+	PositionById.Reserve(RowMap.Num());
+	ByStation.SetNum(static_cast<int32>(EMOCraftingStation::Loom) + 1);
+
+	for (const TPair<FName, uint8*>& RowPair : RowMap)
+	{
+		const FMORecipeDefinitionRow* Recipe = reinterpret_cast<const FMORecipeDefinitionRow*>(RowPair.Value);
+		const int32 Position = Rows.Add(Recipe);
+		Ids.Add(RowPair.Key);
+		PositionById.Add(RowPair.Key, Position);
+
+		const int32 StationIndex = static_cast<int32>(Recipe->RequiredStation);
+		if (!ByStation.IsValidIndex(StationIndex))
+		{
+			ByStation.SetNum(StationIndex + 1);
+		}
+		ByStation[StationIndex].Add(Position);
+
+		BySkill.FindOrAdd(Recipe->RequiredSkillId).Add(Position);
+
+		for (const FName& KnowledgeId : Recipe->RequiredKnowledge)
+		{
+			TArray<int32>& Unlocks = ByKnowledge.FindOrAdd(KnowledgeId);
+			if (Unlocks.Num() == 0 || Unlocks.Last() != Position)
+			{
+				Unlocks.Add(Position);
+			}
+		}
+
+		for (const FMORecipeIngredient& Ingredient : Recipe->Ingredients)
+		{
+			TArray<int32>& Consumers = ByIngredient.FindOrAdd(Ingredient.ItemDefinitionId);
+			if (Consumers.Num() == 0 || Consumers.Last() != Position)
+			{
+				Consumers.Add(Position);
+			}
+		}
+
+		for (const FMORecipeOutput& Output : Recipe->Outputs)
+		{
+			TArray<int32>& Producers = ByOutput.FindOrAdd(Output.ItemDefinitionId);
+			if (Producers.Num() == 0 || Producers.Last() != Position)
+			{
+				Producers.Add(Position);
+			}
+		}
+	}
+}
+
+const TArray<int32>& FMORecipeIndex::GetStationBucket(EMOCraftingStation Station) const
+{
+	static const TArray<int32> Empty;
+	const int32 StationIndex = static_cast<int32>(Station);
+	return ByStation.IsValidIndex(StationIndex) ? ByStation[StationIndex] : Empty;
+}
+
+void FMORecipeIndex::GetStationPositions(EMOCraftingStation Station, TArray<int32>& OutPositions) const
+{
+	OutPositions.Reset();
+
+	const TArray<int32>& HandRecipes = GetStationBucket(EMOCraftingStation::None);
+	if (Station == EMOCraftingStation::None)
+	{
+		OutPositions = HandRecipes;
+		return;
+	}
+
+	// Both buckets are ascending, so a merge keeps DataTable order without sorting.
+	const TArray<int32>& StationRecipes = GetStationBucket(Station);
+	OutPositions.Reserve(HandRecipes.Num() + StationRecipes.Num());
+
+	int32 HandIdx = 0;
+	int32 StationIdx = 0;
+	while (HandIdx < HandRecipes.Num() || StationIdx < StationRecipes.Num())
+	{
+		const bool bTakeHand = StationIdx >= StationRecipes.Num()
+			|| (HandIdx < HandRecipes.Num() && HandRecipes[HandIdx] < StationRecipes[StationIdx]);
+		OutPositions.Add(bTakeHand ? HandRecipes[HandIdx++] : StationRecipes[StationIdx++]);
+	}
+}
+
+namespace
+{
+	struct FMORecipeIndexCache
+	{
+		FMORecipeIndex Index;
+		TWeakObjectPtr<UDataTable> SourceTable;
+		FDelegateHandle TableChangedHandle;
+		FMORecipeIndexResetSignature OnReset;
+		bool bBuilt = false;
+
+		/** Set when the table at FailedPath could not be loaded; not retried until reset or repointed. */
+		FSoftObjectPath FailedPath;
+		bool bBuildFailed = false;
+	};
+
+	FMORecipeIndexCache& GetRecipeIndexCache()
+	{
+		static FMORecipeIndexCache Cache;
+		return Cache;
+	}
+
+	void AppendRecipeIds(const FMORecipeIndex& Index, const TArray<int32>* Positions, TArray<FName>& OutRecipeIds)
+	{
+		if (!Positions)
+		{
+			return;
+		}
+
+		OutRecipeIds.Reserve(OutRecipeIds.Num() + Positions->Num());
+		for (const int32 Position : *Positions)
+		{
+			OutRecipeIds.Add(Index.Ids[Position]);
+		}
+	}
+}
+
 UDataTable* UMORecipeDatabaseSettings::GetRecipeDefinitionsDataTable() const
 {
 	return RecipeDefinitionsDataTable.LoadSynchronous();
 }
 
-const FMORecipeDefinitionRow* UMORecipeDatabaseSettings::GetRecipeDefinition(FName RecipeId)
+#if WITH_EDITOR
+void UMORecipeDatabaseSettings::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
 {
-	if (RecipeId.IsNone())
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	if (PropertyChangedEvent.GetMemberPropertyName() == GET_MEMBER_NAME_CHECKED(UMORecipeDatabaseSettings, RecipeDefinitionsDataTable))
 	{
-		return nullptr;
+		ResetRecipeIndex();
+	}
+}
+#endif
+
+const FMORecipeIndex& UMORecipeDatabaseSettings::GetRecipeIndex()
+{
+	FMORecipeIndexCache& Cache = GetRecipeIndexCache();
+	if (Cache.bBuilt && Cache.SourceTable.IsValid())
+	{
+		return Cache.Index;
 	}
 
+	// A missing table would otherwise be reloaded on every lookup.
 	const UMORecipeDatabaseSettings* Settings = GetDefault<UMORecipeDatabaseSettings>();
-	if (!Settings)
+	const FSoftObjectPath ConfiguredPath = Settings ? Settings->RecipeDefinitionsDataTable.ToSoftObjectPath() : FSoftObjectPath();
+	if (Cache.bBuildFailed && Cache.FailedPath == ConfiguredPath)
 	{
-		return nullptr;
+		return Cache.Index;
 	}
 
-	UDataTable* DataTable = Settings->GetRecipeDefinitionsDataTable();
+	ResetRecipeIndex();
+
+	UDataTable* DataTable = Settings ? Settings->GetRecipeDefinitionsDataTable() : nullptr;
 	if (!IsValid(DataTable))
+	{
+		Cache.FailedPath = ConfiguredPath;
+		Cache.bBuildFailed = true;
+		return Cache.Index;
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	Cache.Index.Build(*DataTable);
+
+	Cache.SourceTable = DataTable;
+	Cache.TableChangedHandle = DataTable->OnDataTableChanged().AddStatic(&UMORecipeDatabaseSettings::ResetRecipeIndex);
+	Cache.bBuilt = true;
+
+	UE_LOG(LogMOFramework, Log, TEXT("[MORecipeDatabase] Indexed %d recipes from '%s' in %.2fms"),
+		Cache.Index.Rows.Num(), *DataTable->GetName(), (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+
+	return Cache.Index;
+}
+
+void UMORecipeDatabaseSettings::ResetRecipeIndex()
+{
+	FMORecipeIndexCache& Cache = GetRecipeIndexCache();
+
+	// Listeners may still read Ids here (not Rows: the table may already have changed under them).
+	if (Cache.bBuilt)
+	{
+		Cache.OnReset.Broadcast(Cache.Index);
+	}
+
+	if (UDataTable* OldTable = Cache.SourceTable.Get())
+	{
+		OldTable->OnDataTableChanged().Remove(Cache.TableChangedHandle);
+	}
+
+	Cache.SourceTable.Reset();
+	Cache.TableChangedHandle.Reset();
+	Cache.Index.Reset();
+	Cache.bBuilt = false;
+	Cache.FailedPath.Reset();
+	Cache.bBuildFailed = false;
+}
+
+FMORecipeIndexResetSignature& UMORecipeDatabaseSettings::OnRecipeIndexReset()
+{
+	return GetRecipeIndexCache().OnReset;
+}
+
+const FMORecipeDefinitionRow* UMORecipeDatabaseSettings::GetRecipeDefinition(FName RecipeId)
+{
+	if (RecipeId.IsNone())
 	{
 		return nullptr;
 	}
 
-	return DataTable->FindRow<FMORecipeDefinitionRow>(RecipeId, TEXT("GetRecipeDefinition"), false);
+	const FMORecipeIndex& Index = GetRecipeIndex();
+	const int32* Position = Index.PositionById.Find(RecipeId);
+	return Position ? Index.Rows[*Position] : nullptr;
 }
 
 bool UMORecipeDatabaseSettings::GetRecipeDefinitionBP(FName RecipeId, FMORecipeDefinitionRow& OutDefinition)
@@ -73,48 +289,31 @@ FText UMORecipeDatabaseSettings::GetRecipeDisplayName(FName RecipeId)
 
 void UMORecipeDatabaseSettings::GetAllRecipeIds(TArray<FName>& OutRecipeIds)
 {
-	OutRecipeIds.Empty();
-
-	const UMORecipeDatabaseSettings* Settings = GetDefault<UMORecipeDatabaseSettings>();
-	if (!Settings)
-	{
-		return;
-	}
+	OutRecipeIds = GetRecipeIndex().Ids;
+}
 
-	UDataTable* DataTable = Settings->GetRecipeDefinitionsDataTable();
-	if (!IsValid(DataTable))
-	{
-		return;
-	}
+void UMORecipeDatabaseSettings::GetRecipesForStation(EMOCraftingStation Station, TArray<FName>& OutRecipeIds)
+{
+	OutRecipeIds.Reset();
 
-	OutRecipeIds = DataTable->GetRowNames();
+	const FMORecipeIndex& Index = GetRecipeIndex();
+	AppendRecipeIds(Index, &Index.GetStationBucket(Station), OutRecipeIds);
 }
 
-void UMORecipeDatabaseSettings::GetRecipesForStation(EMOCraftingStation Station, TArray<FName>& OutRecipeIds)
+void UMORecipeDatabaseSettings::GetRecipesForSkill(FName SkillId, TArray<FName>& OutRecipeIds)
 {
-	OutRecipeIds.Empty();
+	OutRecipeIds.Reset();
 
-	const UMORecipeDatabaseSettings* Settings = GetDefault<UMORecipeDatabaseSettings>();
-	if (!Settings)
-	{
-		return;
-	}
+	const FMORecipeIndex& Index = GetRecipeIndex();
+	AppendRecipeIds(Index, Index.BySkill.Find(SkillId), OutRecipeIds);
+}
 
-	UDataTable* DataTable = Settings->GetRecipeDefinitionsDataTable();
-	if (!IsValid(DataTable))
-	{
-		return;
-	}
+void UMORecipeDatabaseSettings::GetRecipesRequiringKnowledge(FName KnowledgeId, TArray<FName>& OutRecipeIds)
+{
+	OutRecipeIds.Reset();
 
-	TArray<FName> AllRecipeIds = DataTable->GetRowNames();
-	for (const FName& RecipeId : AllRecipeIds)
-	{
-		const FMORecipeDefinitionRow* Recipe = DataTable->FindRow<FMORecipeDefinitionRow>(RecipeId, TEXT("GetRecipesForStation"), false);
-		if (Recipe && Recipe->RequiredStation == Station)
-		{
-			OutRecipeIds.Add(RecipeId);
-		}
-	}
+	const FMORecipeIndex& Index = GetRecipeIndex();
+	AppendRecipeIds(Index, Index.ByKnowledge.Find(KnowledgeId), OutRecipeIds);
 }
 
 bool UMORecipeDatabaseSettings::IsConfigured()
@@ -1,6 +1,7 @@
 #include "MORecipeEntryWidget.h"
 #include "MOFramework.h"
 #include "MOCommonButton.h"
+#include "MOItemAssetStreamingSubsystem.h"
 #include "Components/TextBlock.h"
 #include "Components/Image.h"
 #include "Components/Border.h"
@@ -67,7 +68,20 @@ void UMORecipeEntryWidget::UpdateVisuals()
 	// Update icon
 	if (RecipeIcon && !EntryData.Icon.IsNull())
 	{
-		UTexture2D* IconTexture = EntryData.Icon.LoadSynchronous();
+		// In game the icon streams in and the entry redraws once it lands; editor previews load directly.
+		UTexture2D* IconTexture = nullptr;
+		if (UMOItemAssetStreamingSubsystem* Streaming = UMOItemAssetStreamingSubsystem::Get(this))
+		{
+			IconTexture = Streaming->RequestAsset(EntryData.Icon, FSimpleDelegate::CreateWeakLambda(this, [this]() { UpdateVisuals(); }));
+			if (!IconTexture)
+			{
+				IconTexture = Streaming->GetPlaceholderIcon();
+			}
+		}
+		else
+		{
+			IconTexture = EntryData.Icon.LoadSynchronous();
+		}
 		if (IconTexture)
 		{
 			RecipeIcon->SetBrushFromTexture(IconTexture);
@@ -0,0 +1,95 @@
+#include "MOSimulationClockSubsystem.h"
+#include "MOFramework.h"
+
+#include "Engine/World.h"
+
+void UMOSimulationClockSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Starts level with world time so existing world-time stamps stay comparable.
+	AnchorWorldTime = GetWorldTime();
+	AnchorSimTime = AnchorWorldTime;
+}
+
+bool UMOSimulationClockSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UMOSimulationClockSubsystem* UMOSimulationClockSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UMOSimulationClockSubsystem>() : nullptr;
+}
+
+double UMOSimulationClockSubsystem::GetSimTime(const UObject* WorldContextObject)
+{
+	if (const UMOSimulationClockSubsystem* Clock = Get(WorldContextObject))
+	{
+		return Clock->GetTime();
+	}
+
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetTimeSeconds() : 0.0;
+}
+
+double UMOSimulationClockSubsystem::GetTime() const
+{
+	return AnchorSimTime + (GetWorldTime() - AnchorWorldTime) * TimeScale;
+}
+
+void UMOSimulationClockSubsystem::SetTimeScale(float NewTimeScale)
+{
+	NewTimeScale = FMath::Max(NewTimeScale, 0.0f);
+	if (NewTimeScale == TimeScale)
+	{
+		return;
+	}
+
+	Rebase();
+	TimeScale = NewTimeScale;
+
+	UE_LOG(LogMOFramework, Log, TEXT("[MOSimClock] Time scale %.2f"), TimeScale);
+
+	OnClockChanged.Broadcast();
+}
+
+void UMOSimulationClockSubsystem::FastForward(float SimSeconds)
+{
+	if (SimSeconds <= 0.0f)
+	{
+		return;
+	}
+
+	Rebase();
+	AnchorSimTime += SimSeconds;
+
+	UE_LOG(LogMOFramework, Log, TEXT("[MOSimClock] Fast-forwarded %.1fs to %.1fs"), SimSeconds, AnchorSimTime);
+
+	OnClockChanged.Broadcast();
+}
+
+double UMOSimulationClockSubsystem::GetWorldDelayUntil(double SimTime) const
+{
+	const double Remaining = SimTime - GetTime();
+	if (Remaining <= 0.0)
+	{
+		return 0.0;
+	}
+
+	return TimeScale > 0.0f ? Remaining / TimeScale : TNumericLimits<double>::Max();
+}
+
+void UMOSimulationClockSubsystem::Rebase()
+{
+	const double WorldTime = GetWorldTime();
+	AnchorSimTime += (WorldTime - AnchorWorldTime) * TimeScale;
+	AnchorWorldTime = WorldTime;
+}
+
+double UMOSimulationClockSubsystem::GetWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	return World ? World->GetTimeSeconds() : 0.0;
+}
@@ -5,6 +5,7 @@
 #include "MOVitalsComponent.h"
 #include "MOMetabolismComponent.h"
 #include "MOMentalStateComponent.h"
+#include "MOMedicalSchedulerSubsystem.h"
 #include "Components/WidgetSwitcher.h"
 #include "Components/ScrollBox.h"
 #include "Components/VerticalBox.h"
@@ -587,11 +588,30 @@ void UMOStatusPanel::BindToMedicalComponents(UMOVitalsComponent* Vitals, UMOMeta
 	// Unbind from any previous components first
 	UnbindFromMedicalComponents();
 
+	// Prefer one coalesced delta per frame over three per-component events
+	UWorld* World = GetWorld();
+	UMOMedicalSchedulerSubsystem* Scheduler = World ? World->GetSubsystem<UMOMedicalSchedulerSubsystem>() : nullptr;
+	const UActorComponent* AnyComponent = IsValid(Vitals) ? static_cast<UActorComponent*>(Vitals)
+		: IsValid(Metabolism) ? static_cast<UActorComponent*>(Metabolism)
+		: static_cast<UActorComponent*>(MentalState);
+	AActor* Pawn = IsValid(AnyComponent) ? AnyComponent->GetOwner() : nullptr;
+
+	const bool bUseDeltas = Scheduler && Pawn;
+	if (bUseDeltas)
+	{
+		BoundScheduler = Scheduler;
+		BoundPawn = Pawn;
+		Scheduler->OnMedicalDelta.AddDynamic(this, &UMOStatusPanel::HandleMedicalDelta);
+	}
+
 	// Bind to vitals
 	if (IsValid(Vitals))
 	{
 		BoundVitals = Vitals;
-		Vitals->OnVitalsChanged.AddDynamic(this, &UMOStatusPanel::HandleVitalsChanged);
+		if (!bUseDeltas)
+		{
+			Vitals->OnVitalsChanged.AddDynamic(this, &UMOStatusPanel::HandleVitalsChanged);
+		}
 		UpdateVitalsFields();
 		UE_LOG(LogMOFramework, Log, TEXT("[MOStatusPanel] Bound to VitalsComponent"));
 	}
@@ -600,7 +620,10 @@ void UMOStatusPanel::BindToMedicalComponents(UMOVitalsComponent* Vitals, UMOMeta
 	if (IsValid(Metabolism))
 	{
 		BoundMetabolism = Metabolism;
-		Metabolism->OnMetabolismChanged.AddDynamic(this, &UMOStatusPanel::HandleMetabolismChanged);
+		if (!bUseDeltas)
+		{
+			Metabolism->OnMetabolismChanged.AddDynamic(this, &UMOStatusPanel::HandleMetabolismChanged);
+		}
 		UpdateMetabolismFields();
 		UE_LOG(LogMOFramework, Log, TEXT("[MOStatusPanel] Bound to MetabolismComponent"));
 	}
@@ -609,7 +632,10 @@ void UMOStatusPanel::BindToMedicalComponents(UMOVitalsComponent* Vitals, UMOMeta
 	if (IsValid(MentalState))
 	{
 		BoundMentalState = MentalState;
-		MentalState->OnMentalStateChanged.AddDynamic(this, &UMOStatusPanel::HandleMentalStateChanged);
+		if (!bUseDeltas)
+		{
+			MentalState->OnMentalStateChanged.AddDynamic(this, &UMOStatusPanel::HandleMentalStateChanged);
+		}
 		UpdateMentalStateFields();
 		UE_LOG(LogMOFramework, Log, TEXT("[MOStatusPanel] Bound to MentalStateComponent"));
 	}
@@ -617,6 +643,13 @@ void UMOStatusPanel::BindToMedicalComponents(UMOVitalsComponent* Vitals, UMOMeta
 
 void UMOStatusPanel::UnbindFromMedicalComponents()
 {
+	if (UMOMedicalSchedulerSubsystem* Scheduler = BoundScheduler.Get())
+	{
+		Scheduler->OnMedicalDelta.RemoveDynamic(this, &UMOStatusPanel::HandleMedicalDelta);
+	}
+	BoundScheduler.Reset();
+	BoundPawn.Reset();
+
 	if (UMOVitalsComponent* Vitals = BoundVitals.Get())
 	{
 		Vitals->OnVitalsChanged.RemoveDynamic(this, &UMOStatusPanel::HandleVitalsChanged);
@@ -651,7 +684,30 @@ void UMOStatusPanel::HandleMentalStateChanged()
 	UpdateMentalStateFields();
 }
 
-void UMOStatusPanel::UpdateVitalsFields()
+void UMOStatusPanel::HandleMedicalDelta(AActor* Pawn, const FMOMedicalDelta& Delta)
+{
+	if (Pawn != BoundPawn.Get())
+	{
+		return;
+	}
+
+	if (Delta.HasAnyField(FMOMedicalDelta::VitalsFields))
+	{
+		UpdateVitalsFields(Delta.ChangedFields);
+	}
+
+	if (Delta.HasAnyField(FMOMedicalDelta::MetabolismFields))
+	{
+		UpdateMetabolismFields(Delta.ChangedFields);
+	}
+
+	if (Delta.HasAnyField(FMOMedicalDelta::MentalFields))
+	{
+		UpdateMentalStateFields();
+	}
+}
+
+void UMOStatusPanel::UpdateVitalsFields(int32 ChangedFields)
 {
 	UMOVitalsComponent* Vitals = BoundVitals.Get();
 	if (!Vitals)
@@ -660,43 +716,66 @@ void UMOStatusPanel::UpdateVitalsFields()
 	}
 
 	const FMOVitalSigns& Signs = Vitals->GetVitalSigns();
+	FMOMedicalDelta Delta;
+	Delta.ChangedFields = ChangedFields;
 
 	// Heart Rate - normalized based on resting range (60-100 normal, above/below is concerning)
-	float HRNorm = FMath::GetMappedRangeValueClamped(FVector2D(40.0f, 120.0f), FVector2D(0.0f, 1.0f), Signs.HeartRate);
-	// Invert so middle range is "good"
-	HRNorm = 1.0f - FMath::Abs(HRNorm - 0.5f) * 2.0f;
-	UpdateFieldValueFloat(FName("HeartRate"), Signs.HeartRate, HRNorm);
+	if (Delta.HasField(EMOMedicalDeltaField::HeartRate))
+	{
+		float HRNorm = FMath::GetMappedRangeValueClamped(FVector2D(40.0f, 120.0f), FVector2D(0.0f, 1.0f), Signs.HeartRate);
+		// Invert so middle range is "good"
+		HRNorm = 1.0f - FMath::Abs(HRNorm - 0.5f) * 2.0f;
+		UpdateFieldValueFloat(FName("HeartRate"), Signs.HeartRate, HRNorm);
+	}
 
 	// Blood Pressure
-	UpdateFieldValueFloat(FName("BloodPressureSystolic"), Signs.SystolicBP, -1.0f);
-	UpdateFieldValueFloat(FName("BloodPressureDiastolic"), Signs.DiastolicBP, -1.0f);
+	if (Delta.HasField(EMOMedicalDeltaField::BloodPressure))
+	{
+		UpdateFieldValueFloat(FName("BloodPressureSystolic"), Signs.SystolicBP, -1.0f);
+		UpdateFieldValueFloat(FName("BloodPressureDiastolic"), Signs.DiastolicBP, -1.0f);
+	}
 
 	// SpO2 - normalized 90-100
-	float SpO2Norm = FMath::GetMappedRangeValueClamped(FVector2D(80.0f, 100.0f), FVector2D(0.0f, 1.0f), Signs.SpO2);
-	UpdateFieldValueFloat(FName("SpO2"), Signs.SpO2, SpO2Norm);
+	if (Delta.HasField(EMOMedicalDeltaField::SpO2))
+	{
+		float SpO2Norm = FMath::GetMappedRangeValueClamped(FVector2D(80.0f, 100.0f), FVector2D(0.0f, 1.0f), Signs.SpO2);
+		UpdateFieldValueFloat(FName("SpO2"), Signs.SpO2, SpO2Norm);
+	}
 
 	// Temperature - normalized around 37C
-	float TempNorm = 1.0f - FMath::Abs(Signs.BodyTemperature - 37.0f) / 5.0f;
-	TempNorm = FMath::Clamp(TempNorm, 0.0f, 1.0f);
-	UpdateFieldValueFloat(FName("BodyTemperature"), Signs.BodyTemperature, TempNorm);
+	if (Delta.HasField(EMOMedicalDeltaField::BodyTemperature))
+	{
+		float TempNorm = 1.0f - FMath::Abs(Signs.BodyTemperature - 37.0f) / 5.0f;
+		TempNorm = FMath::Clamp(TempNorm, 0.0f, 1.0f);
+		UpdateFieldValueFloat(FName("BodyTemperature"), Signs.BodyTemperature, TempNorm);
+	}
 
 	// Blood Volume - normalized to max
-	float BloodNorm = Signs.BloodVolume / Signs.MaxBloodVolume;
-	UpdateFieldValueFloat(FName("BloodVolume"), Signs.BloodVolume, BloodNorm);
+	if (Delta.HasField(EMOMedicalDeltaField::BloodVolume))
+	{
+		float BloodNorm = Signs.BloodVolume / Signs.MaxBloodVolume;
+		UpdateFieldValueFloat(FName("BloodVolume"), Signs.BloodVolume, BloodNorm);
+	}
 
 	// Respiratory Rate
-	float RRNorm = FMath::GetMappedRangeValueClamped(FVector2D(8.0f, 30.0f), FVector2D(0.0f, 1.0f), Signs.RespiratoryRate);
-	RRNorm = 1.0f - FMath::Abs(RRNorm - 0.4f) * 1.5f; // ~16 is optimal
-	RRNorm = FMath::Clamp(RRNorm, 0.0f, 1.0f);
-	UpdateFieldValueFloat(FName("RespiratoryRate"), Signs.RespiratoryRate, RRNorm);
+	if (Delta.HasField(EMOMedicalDeltaField::RespiratoryRate))
+	{
+		float RRNorm = FMath::GetMappedRangeValueClamped(FVector2D(8.0f, 30.0f), FVector2D(0.0f, 1.0f), Signs.RespiratoryRate);
+		RRNorm = 1.0f - FMath::Abs(RRNorm - 0.4f) * 1.5f; // ~16 is optimal
+		RRNorm = FMath::Clamp(RRNorm, 0.0f, 1.0f);
+		UpdateFieldValueFloat(FName("RespiratoryRate"), Signs.RespiratoryRate, RRNorm);
+	}
 
 	// Blood Glucose - normalized 70-140 range
-	float GlucoseNorm = FMath::GetMappedRangeValueClamped(FVector2D(40.0f, 180.0f), FVector2D(0.0f, 1.0f), Signs.BloodGlucose);
-	GlucoseNorm = 1.0f - FMath::Abs(GlucoseNorm - 0.5f) * 2.0f;
-	UpdateFieldValueFloat(FName("BloodGlucose"), Signs.BloodGlucose, GlucoseNorm);
+	if (Delta.HasField(EMOMedicalDeltaField::BloodGlucose))
+	{
+		float GlucoseNorm = FMath::GetMappedRangeValueClamped(FVector2D(40.0f, 180.0f), FVector2D(0.0f, 1.0f), Signs.BloodGlucose);
+		GlucoseNorm = 1.0f - FMath::Abs(GlucoseNorm - 0.5f) * 2.0f;
+		UpdateFieldValueFloat(FName("BloodGlucose"), Signs.BloodGlucose, GlucoseNorm);
+	}
 }
 
-void UMOStatusPanel::UpdateMetabolismFields()
+void UMOStatusPanel::UpdateMetabolismFields(int32 ChangedFields)
 {
 	UMOMetabolismComponent* Metabolism = BoundMetabolism.Get();
 	if (!Metabolism)
@@ -707,32 +786,52 @@ void UMOStatusPanel::UpdateMetabolismFields()
 	const FMONutrientLevels& Nutrients = Metabolism->GetNutrientLevels();
 	const FMOBodyComposition& Body = Metabolism->GetBodyComposition();
 
+	FMOMedicalDelta Delta;
+	Delta.ChangedFields = ChangedFields;
+	const int32 NutritionFields = FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::Glycogen)
+		| FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::Hydration)
+		| FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::ProteinBalance)
+		| FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::Digestion);
+	const int32 FitnessFields = FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::BodyComposition)
+		| FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::Fitness)
+		| FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::Glycogen)
+		| FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::Hydration);
+
 	// Nutrition - Hunger is based on glycogen stores (energy reserves)
-	float HungerPercent = (Nutrients.MaxGlycogen > 0.0f) ? (Nutrients.GlycogenStores / Nutrients.MaxGlycogen) : 0.0f;
-	UpdateFieldValueFloat(FName("Hunger"), HungerPercent * 100.0f, HungerPercent);
-	UpdateFieldValueFloat(FName("Thirst"), Nutrients.HydrationLevel, Nutrients.HydrationLevel / 100.0f);
-	UpdateFieldValueFloat(FName("GlycogenStores"), Nutrients.GlycogenStores, Nutrients.GlycogenStores / Nutrients.MaxGlycogen);
-	UpdateFieldValueFloat(FName("HydrationLevel"), Nutrients.HydrationLevel, Nutrients.HydrationLevel / 100.0f);
-	UpdateFieldValueFloat(FName("ProteinBalance"), Nutrients.ProteinBalance, -1.0f);
-	UpdateFieldValueFloat(FName("CalorieBalance"), Metabolism->GetDailyCalorieBalance(), -1.0f);
+	if (Delta.HasAnyField(NutritionFields))
+	{
+		float HungerPercent = (Nutrients.MaxGlycogen > 0.0f) ? (Nutrients.GlycogenStores / Nutrients.MaxGlycogen) : 0.0f;
+		UpdateFieldValueFloat(FName("Hunger"), HungerPercent * 100.0f, HungerPercent);
+		UpdateFieldValueFloat(FName("Thirst"), Nutrients.HydrationLevel, Nutrients.HydrationLevel / 100.0f);
+		UpdateFieldValueFloat(FName("GlycogenStores"), Nutrients.GlycogenStores, Nutrients.GlycogenStores / Nutrients.MaxGlycogen);
+		UpdateFieldValueFloat(FName("HydrationLevel"), Nutrients.HydrationLevel, Nutrients.HydrationLevel / 100.0f);
+		UpdateFieldValueFloat(FName("ProteinBalance"), Nutrients.ProteinBalance, -1.0f);
+		UpdateFieldValueFloat(FName("CalorieBalance"), Metabolism->GetDailyCalorieBalance(), -1.0f);
+	}
 
 	// Nutrients (vitamins/minerals as % daily value)
-	UpdateFieldValueFloat(FName("VitaminA"), Nutrients.VitaminA, Nutrients.VitaminA / 100.0f);
-	UpdateFieldValueFloat(FName("VitaminB"), Nutrients.VitaminB, Nutrients.VitaminB / 100.0f);
-	UpdateFieldValueFloat(FName("VitaminC"), Nutrients.VitaminC, Nutrients.VitaminC / 100.0f);
-	UpdateFieldValueFloat(FName("VitaminD"), Nutrients.VitaminD, Nutrients.VitaminD / 100.0f);
-	UpdateFieldValueFloat(FName("Iron"), Nutrients.Iron, Nutrients.Iron / 100.0f);
-	UpdateFieldValueFloat(FName("Calcium"), Nutrients.Calcium, Nutrients.Calcium / 100.0f);
-	UpdateFieldValueFloat(FName("Potassium"), Nutrients.Potassium, Nutrients.Potassium / 100.0f);
-	UpdateFieldValueFloat(FName("Sodium"), Nutrients.Sodium, Nutrients.Sodium / 100.0f);
-
-	// Fitness
-	UpdateFieldValueFloat(FName("MuscleMass"), Body.MuscleMass, Body.MuscleMass / 50.0f);
-	UpdateFieldValueFloat(FName("BodyFatPercent"), Body.BodyFatPercent, -1.0f);
-	UpdateFieldValueFloat(FName("CardiovascularFitness"), Body.CardiovascularFitness, Body.CardiovascularFitness / 100.0f);
-	UpdateFieldValueFloat(FName("StrengthLevel"), Body.StrengthLevel, Body.StrengthLevel / 100.0f);
-	UpdateFieldValueFloat(FName("TotalWeight"), Body.TotalWeight, -1.0f);
-	UpdateFieldValueFloat(FName("Stamina"), Metabolism->GetCurrentStamina() * 100.0f, Metabolism->GetCurrentStamina());
+	if (Delta.HasField(EMOMedicalDeltaField::Micronutrients))
+	{
+		UpdateFieldValueFloat(FName("VitaminA"), Nutrients.VitaminA, Nutrients.VitaminA / 100.0f);
+		UpdateFieldValueFloat(FName("VitaminB"), Nutrients.VitaminB, Nutrients.VitaminB / 100.0f);
+		UpdateFieldValueFloat(FName("VitaminC"), Nutrients.VitaminC, Nutrients.VitaminC / 100.0f);
+		UpdateFieldValueFloat(FName("VitaminD"), Nutrients.VitaminD, Nutrients.VitaminD / 100.0f);
+		UpdateFieldValueFloat(FName("Iron"), Nutrients.Iron, Nutrients.Iron / 100.0f);
+		UpdateFieldValueFloat(FName("Calcium"), Nutrients.Calcium, Nutrients.Calcium / 100.0f);
+		UpdateFieldValueFloat(FName("Potassium"), Nutrients.Potassium, Nutrients.Potassium / 100.0f);
+		UpdateFieldValueFloat(FName("Sodium"), Nutrients.Sodium, Nutrients.Sodium / 100.0f);
+	}
+
+	// Fitness (stamina follows glycogen and hydration)
+	if (Delta.HasAnyField(FitnessFields))
+	{
+		UpdateFieldValueFloat(FName("MuscleMass"), Body.MuscleMass, Body.MuscleMass / 50.0f);
+		UpdateFieldValueFloat(FName("BodyFatPercent"), Body.BodyFatPercent, -1.0f);
+		UpdateFieldValueFloat(FName("CardiovascularFitness"), Body.CardiovascularFitness, Body.CardiovascularFitness / 100.0f);
+		UpdateFieldValueFloat(FName("StrengthLevel"), Body.StrengthLevel, Body.StrengthLevel / 100.0f);
+		UpdateFieldValueFloat(FName("TotalWeight"), Body.TotalWeight, -1.0f);
+		UpdateFieldValueFloat(FName("Stamina"), Metabolism->GetCurrentStamina() * 100.0f, Metabolism->GetCurrentStamina());
+	}
 }
 
 void UMOStatusPanel::UpdateMentalStateFields()
@@ -2,6 +2,7 @@
 #include "MOInventoryComponent.h"
 #include "MOItemDatabaseSettings.h"
 #include "MOFramework.h"
+#include "MOMedicalSchedulerSubsystem.h"
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 
@@ -46,17 +47,36 @@ void UMOSurvivalStatsComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	// Only tick on server/authority
+	// Only tick on server/authority; prefer the batched world scheduler
 	if (GetOwnerRole() == ROLE_Authority)
 	{
-		GetWorld()->GetTimerManager().SetTimer(
-			TickTimerHandle,
-			this,
-			&UMOSurvivalStatsComponent::TickStats,
-			TickInterval,
-			true
-		);
+		UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this);
+		if (!Scheduler || !Scheduler->RegisterComponent(this))
+		{
+			GetWorld()->GetTimerManager().SetTimer(
+				TickTimerHandle,
+				this,
+				&UMOSurvivalStatsComponent::TickStats,
+				TickInterval,
+				true
+			);
+		}
+	}
+}
+
+void UMOSurvivalStatsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this))
+	{
+		Scheduler->UnregisterComponent(this);
 	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(TickTimerHandle);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void UMOSurvivalStatsComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -123,20 +143,20 @@ bool UMOSurvivalStatsComponent::ConsumeItem(UMOInventoryComponent* InventoryComp
 	}
 
 	// Get item definition
-	FMOItemDefinitionRow ItemDef;
-	if (!UMOItemDatabaseSettings::GetItemDefinition(FoundEntry.ItemDefinitionId, ItemDef))
+	const FMOItemDefinitionRow* ItemDef = FoundEntry.GetDefinition();
+	if (!ItemDef)
 	{
 		return false;
 	}
 
 	// Check if item is consumable
-	if (!ItemDef.bConsumable)
+	if (!ItemDef->bConsumable)
 	{
 		return false;
 	}
 
 	// Apply nutrition from item
-	ApplyNutrition(ItemDef.Nutrition);
+	ApplyNutrition(ItemDef->Nutrition);
 
 	// Remove one from inventory
 	InventoryComponent->RemoveItemByGuid(ItemGuid, 1);
@@ -214,14 +234,19 @@ bool UMOSurvivalStatsComponent::IsStatCritical(FName StatName) const
 
 void UMOSurvivalStatsComponent::TickStats()
 {
-	ProcessStatTick(Health, FName("Health"), TickInterval);
-	ProcessStatTick(Stamina, FName("Stamina"), TickInterval);
-	ProcessStatTick(Hunger, FName("Hunger"), TickInterval);
-	ProcessStatTick(Thirst, FName("Thirst"), TickInterval);
-	ProcessStatTick(Temperature, FName("Temperature"), TickInterval);
-	ProcessStatTick(Energy, FName("Energy"), TickInterval);
-
-	DecayNutrition(TickInterval);
+	AdvanceSimulation(TickInterval);
+}
+
+void UMOSurvivalStatsComponent::AdvanceSimulation(float DeltaSeconds)
+{
+	ProcessStatTick(Health, FName("Health"), DeltaSeconds);
+	ProcessStatTick(Stamina, FName("Stamina"), DeltaSeconds);
+	ProcessStatTick(Hunger, FName("Hunger"), DeltaSeconds);
+	ProcessStatTick(Thirst, FName("Thirst"), DeltaSeconds);
+	ProcessStatTick(Temperature, FName("Temperature"), DeltaSeconds);
+	ProcessStatTick(Energy, FName("Energy"), DeltaSeconds);
+
+	DecayNutrition(DeltaSeconds);
 }
 
 void UMOSurvivalStatsComponent::ProcessStatTick(FMOSurvivalStat& Stat, FName StatName, float DeltaTime)
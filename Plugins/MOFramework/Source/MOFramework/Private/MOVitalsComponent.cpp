@@ -2,6 +2,8 @@
 #include "MOAnatomyComponent.h"
 #include "MOMetabolismComponent.h"
 #include "MOMentalStateComponent.h"
+#include "MOMedicalSchedulerSubsystem.h"
+#include "MOVitalsKernels.h"
 #include "Net/UnrealNetwork.h"
 #include "TimerManager.h"
 
@@ -26,21 +28,31 @@ void UMOVitalsComponent::BeginPlay()
 	// Start tick timer on authority
 	if (GetOwnerRole() == ROLE_Authority)
 	{
-		if (UWorld* World = GetWorld())
+		// Prefer the batched world scheduler; fall back to a per-component timer
+		UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this);
+		if (!Scheduler || !Scheduler->RegisterComponent(this))
 		{
-			World->GetTimerManager().SetTimer(
-				TickTimerHandle,
-				this,
-				&UMOVitalsComponent::TickVitals,
-				TickInterval,
-				true
-			);
+			if (UWorld* World = GetWorld())
+			{
+				World->GetTimerManager().SetTimer(
+					TickTimerHandle,
+					this,
+					&UMOVitalsComponent::TickVitals,
+					TickInterval,
+					true
+				);
+			}
 		}
 	}
 }
 
 void UMOVitalsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(this))
+	{
+		Scheduler->UnregisterComponent(this);
+	}
+
 	if (UWorld* World = GetWorld())
 	{
 		World->GetTimerManager().ClearTimer(TickTimerHandle);
@@ -326,12 +338,28 @@ bool UMOVitalsComponent::ApplySaveDataAuthority(const FMOVitalsSaveData& InSaveD
 
 void UMOVitalsComponent::TickVitals()
 {
-	if (GetOwnerRole() != ROLE_Authority)
+	AdvanceSimulation(TickInterval);
+}
+
+void UMOVitalsComponent::AdvanceSimulation(float DeltaSeconds)
+{
+	if (!BeginVitalsTick())
 	{
 		return;
 	}
 
-	float ScaledDeltaTime = TickInterval * TimeScaleMultiplier;
+	// Calculate all vital signs
+	ApplyDerivedVitals(FMOVitalsKernels::Derive(BuildDerivationInput()));
+
+	FinishVitalsTick(DeltaSeconds);
+}
+
+bool UMOVitalsComponent::BeginVitalsTick()
+{
+	if (GetOwnerRole() != ROLE_Authority)
+	{
+		return false;
+	}
 
 	// Update pain level from anatomy component
 	if (UMOAnatomyComponent* AnatomyComp = CachedAnatomyComp.Get())
@@ -339,11 +367,12 @@ void UMOVitalsComponent::TickVitals()
 		SetPainLevel(AnatomyComp->GetTotalPainLevel());
 	}
 
-	// Calculate all vital signs
-	CalculateHeartRate();
-	CalculateBloodPressure();
-	CalculateRespiratoryRate();
-	CalculateOxygenSaturation();
+	return true;
+}
+
+void UMOVitalsComponent::FinishVitalsTick(float DeltaSeconds)
+{
+	float ScaledDeltaTime = DeltaSeconds * TimeScaleMultiplier;
 
 	// Natural processes
 	RegenerateBlood(ScaledDeltaTime);
@@ -357,205 +386,54 @@ void UMOVitalsComponent::TickVitals()
 	GlucoseConsumption += (Exertion.CurrentExertion / 100.0f) * 0.05f;  // Activity adds consumption
 	ConsumeGlucose(GlucoseConsumption * ScaledDeltaTime);
 
-	// Broadcast general vitals changed for UI updates
-	OnVitalsChanged.Broadcast();
-}
-
-void UMOVitalsComponent::CalculateHeartRate()
-{
-	float OldHR = Vitals.HeartRate;
-	float BaseHR = Vitals.BaseHeartRate;
-
-	// Exertion contribution (+0 to +80 BPM)
-	float ExertionMod = (Exertion.CurrentExertion / 100.0f) * 80.0f;
-
-	// Blood loss contribution (compensatory tachycardia)
-	float BloodLossMod = 0.0f;
-	switch (GetBloodLossStage())
-	{
-	case EMOBloodLossStage::Class1:
-		BloodLossMod = 20.0f;
-		break;
-	case EMOBloodLossStage::Class2:
-		BloodLossMod = 40.0f;
-		break;
-	case EMOBloodLossStage::Class3:
-		BloodLossMod = 60.0f;
-		break;
-	default:
-		break;
-	}
-
-	// Pain and stress contribution (+0 to +30 BPM)
-	float StressMod = ((Exertion.PainLevel + Exertion.StressLevel) / 200.0f) * 30.0f;
-
-	// Temperature effects
-	float TempMod = 0.0f;
-	if (Vitals.BodyTemperature > 38.0f)  // Fever
-	{
-		TempMod = (Vitals.BodyTemperature - 38.0f) * 10.0f;  // +10 BPM per degree
-	}
-	else if (Vitals.BodyTemperature < 35.0f)  // Hypothermia
-	{
-		// Initially HR increases, then decreases
-		if (Vitals.BodyTemperature > 32.0f)
-		{
-			TempMod = (35.0f - Vitals.BodyTemperature) * 5.0f;  // Increased
-		}
-		else
-		{
-			TempMod = -((32.0f - Vitals.BodyTemperature) * 10.0f);  // Decreased (dangerous)
-		}
-	}
-
-	// Low glucose can increase HR (adrenaline response)
-	float GlucoseMod = 0.0f;
-	if (Vitals.BloodGlucose < 70.0f)
-	{
-		GlucoseMod = (70.0f - Vitals.BloodGlucose) * 0.5f;
-	}
-
-	// Cardiovascular fitness effect (better fitness = lower HR)
-	float FitnessMod = 0.0f;
-	if (UMOMetabolismComponent* MetabComp = CachedMetabolismComp.Get())
-	{
-		// High fitness reduces resting HR and exertion HR
-		float Fitness = MetabComp->BodyComposition.CardiovascularFitness;
-		FitnessMod = -((Fitness - 50.0f) / 50.0f) * 10.0f;  // -10 to +10 BPM from fitness
-	}
-
-	// Calculate final HR
-	Vitals.HeartRate = BaseHR + ExertionMod + BloodLossMod + StressMod + TempMod + GlucoseMod + FitnessMod;
-
-	// Clamp to physiological limits
-	Vitals.HeartRate = FMath::Clamp(Vitals.HeartRate, 20.0f, 220.0f);
-
-	// Severe blood loss eventually causes bradycardia as heart fails
-	if (GetBloodLossStage() == EMOBloodLossStage::Class3 && Vitals.BloodVolume < Vitals.MaxBloodVolume * 0.4f)
-	{
-		// Heart is struggling
-		Vitals.HeartRate = FMath::Max(30.0f, Vitals.HeartRate * 0.7f);
-	}
-
-	CheckAndBroadcastChange(FName("HeartRate"), OldHR, Vitals.HeartRate, 5.0f);
-}
-
-void UMOVitalsComponent::CalculateBloodPressure()
-{
-	float OldSystolic = Vitals.SystolicBP;
-	float OldDiastolic = Vitals.DiastolicBP;
-
-	// Base blood pressure (assuming healthy baseline)
-	float BaseSystolic = 120.0f;
-	float BaseDiastolic = 80.0f;
-
-	// Blood volume effect (most critical)
-	float VolumeRatio = Vitals.BloodVolume / Vitals.MaxBloodVolume;
-	float VolumeMod = 0.0f;
-
-	if (VolumeRatio < 0.85f)  // <15% loss
-	{
-		VolumeMod = 0.0f;  // Compensated
-	}
-	else if (VolumeRatio < 0.70f)  // 15-30% loss
-	{
-		// Pulse pressure narrows (systolic drops more than diastolic)
-		VolumeMod = -(0.85f - VolumeRatio) * 100.0f;  // Systolic drops
-	}
-	else if (VolumeRatio < 0.60f)  // 30-40% loss
-	{
-		VolumeMod = -40.0f - (0.70f - VolumeRatio) * 200.0f;  // Significant drop
-	}
-	else  // >40% loss
-	{
-		VolumeMod = -60.0f - (0.60f - VolumeRatio) * 300.0f;  // Severe drop
-	}
-
-	// Exertion increases BP (systolic more than diastolic)
-	float ExertionSystolicMod = (Exertion.CurrentExertion / 100.0f) * 40.0f;
-	float ExertionDiastolicMod = (Exertion.CurrentExertion / 100.0f) * 10.0f;
-
-	// Stress increases BP
-	float StressMod = ((Exertion.StressLevel + Exertion.PainLevel) / 200.0f) * 20.0f;
-
-	// Calculate final BP
-	Vitals.SystolicBP = BaseSystolic + VolumeMod + ExertionSystolicMod + StressMod;
-	Vitals.DiastolicBP = BaseDiastolic + (VolumeMod * 0.5f) + ExertionDiastolicMod + (StressMod * 0.5f);
-
-	// Clamp to physiological limits
-	Vitals.SystolicBP = FMath::Clamp(Vitals.SystolicBP, 40.0f, 220.0f);
-	Vitals.DiastolicBP = FMath::Clamp(Vitals.DiastolicBP, 20.0f, 140.0f);
-
-	// Ensure systolic > diastolic
-	if (Vitals.SystolicBP <= Vitals.DiastolicBP)
+	// Notify UI only when something visibly changed
+	const FMOMedicalDelta Delta = ConsumeVitalsDelta();
+	if (!Delta.IsEmpty())
 	{
-		Vitals.DiastolicBP = Vitals.SystolicBP - 10.0f;
+		OnVitalsChanged.Broadcast();
+		UMOMedicalSchedulerSubsystem::QueueMedicalDelta(this, Delta);
 	}
-
-	CheckAndBroadcastChange(FName("SystolicBP"), OldSystolic, Vitals.SystolicBP, 5.0f);
-	CheckAndBroadcastChange(FName("DiastolicBP"), OldDiastolic, Vitals.DiastolicBP, 5.0f);
 }
 
-void UMOVitalsComponent::CalculateRespiratoryRate()
+FMOMedicalDelta UMOVitalsComponent::ConsumeVitalsDelta()
 {
-	float OldRR = Vitals.RespiratoryRate;
-	float BaseRR = 16.0f;
-
-	// Exertion increases RR significantly
-	float ExertionMod = (Exertion.CurrentExertion / 100.0f) * 30.0f;  // Up to 46/min during heavy exercise
-
-	// Low SpO2 increases RR (compensation)
-	float SpO2Mod = 0.0f;
-	if (Vitals.SpO2 < 95.0f)
-	{
-		SpO2Mod = (95.0f - Vitals.SpO2) * 0.5f;
-	}
-
-	// Blood loss increases RR
-	float BloodLossMod = 0.0f;
-	switch (GetBloodLossStage())
-	{
-	case EMOBloodLossStage::Class1:
-		BloodLossMod = 4.0f;
-		break;
-	case EMOBloodLossStage::Class2:
-		BloodLossMod = 8.0f;
-		break;
-	case EMOBloodLossStage::Class3:
-		BloodLossMod = 12.0f;
-		break;
-	default:
-		break;
-	}
-
-	// Fever increases RR
-	float TempMod = 0.0f;
-	if (Vitals.BodyTemperature > 38.0f)
-	{
-		TempMod = (Vitals.BodyTemperature - 38.0f) * 2.0f;
-	}
-
-	Vitals.RespiratoryRate = BaseRR + ExertionMod + SpO2Mod + BloodLossMod + TempMod;
-	Vitals.RespiratoryRate = FMath::Clamp(Vitals.RespiratoryRate, 4.0f, 60.0f);
-
-	CheckAndBroadcastChange(FName("RespiratoryRate"), OldRR, Vitals.RespiratoryRate, 2.0f);
+	FMOMedicalDelta Delta;
+	FMOVitalSigns& Last = LastNotifiedVitals;
+
+	Delta.CheckField(EMOMedicalDeltaField::HeartRate, Last.HeartRate, Vitals.HeartRate, 1.0f);
+	Delta.CheckField(EMOMedicalDeltaField::BloodPressure, Last.SystolicBP, Vitals.SystolicBP, 1.0f);
+	Delta.CheckField(EMOMedicalDeltaField::BloodPressure, Last.DiastolicBP, Vitals.DiastolicBP, 1.0f);
+	Delta.CheckField(EMOMedicalDeltaField::SpO2, Last.SpO2, Vitals.SpO2, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::RespiratoryRate, Last.RespiratoryRate, Vitals.RespiratoryRate, 0.5f);
+	Delta.CheckField(EMOMedicalDeltaField::BodyTemperature, Last.BodyTemperature, Vitals.BodyTemperature, 0.05f);
+	Delta.CheckField(EMOMedicalDeltaField::BloodVolume, Last.BloodVolume, Vitals.BloodVolume, 10.0f);
+	Delta.CheckField(EMOMedicalDeltaField::BloodVolume, Last.MaxBloodVolume, Vitals.MaxBloodVolume, 10.0f);
+	Delta.CheckField(EMOMedicalDeltaField::BloodGlucose, Last.BloodGlucose, Vitals.BloodGlucose, 1.0f);
+
+	return Delta;
 }
 
-void UMOVitalsComponent::CalculateOxygenSaturation()
+FMOVitalsDerivationInput UMOVitalsComponent::BuildDerivationInput() const
 {
-	float OldSpO2 = Vitals.SpO2;
-	float BaseSpO2 = 98.0f;
-
-	// Blood volume affects oxygen capacity
-	float VolumeRatio = Vitals.BloodVolume / Vitals.MaxBloodVolume;
-	float VolumeMod = 0.0f;
-	if (VolumeRatio < 0.7f)
+	FMOVitalsDerivationInput In;
+	In.BloodVolume = Vitals.BloodVolume;
+	In.MaxBloodVolume = Vitals.MaxBloodVolume;
+	In.BaseHeartRate = Vitals.BaseHeartRate;
+	In.BodyTemperature = Vitals.BodyTemperature;
+	In.BloodGlucose = Vitals.BloodGlucose;
+	In.SpO2 = Vitals.SpO2;
+	In.CurrentExertion = Exertion.CurrentExertion;
+	In.StressLevel = Exertion.StressLevel;
+	In.PainLevel = Exertion.PainLevel;
+
+	// Cardiovascular fitness (better fitness = lower HR)
+	if (UMOMetabolismComponent* MetabComp = CachedMetabolismComp.Get())
 	{
-		VolumeMod = -((0.7f - VolumeRatio) * 30.0f);  // Significant drop at low blood volume
+		In.Fitness = MetabComp->BodyComposition.CardiovascularFitness;
+		In.bHasFitness = true;
 	}
 
-	// Lung damage (from anatomy component) - TODO: integrate with anatomy
-	float LungMod = 0.0f;
+	// Lung damage reduces oxygen saturation
 	if (UMOAnatomyComponent* AnatomyComp = CachedAnatomyComp.Get())
 	{
 		bool bLeftLungFunctional = AnatomyComp->IsBodyPartFunctional(EMOBodyPartType::LungLeft);
@@ -563,29 +441,37 @@ void UMOVitalsComponent::CalculateOxygenSaturation()
 
 		if (!bLeftLungFunctional && !bRightLungFunctional)
 		{
-			LungMod = -50.0f;  // Both lungs destroyed - critical
+			In.LungMod = -50.0f;  // Both lungs destroyed - critical
 		}
 		else if (!bLeftLungFunctional || !bRightLungFunctional)
 		{
-			LungMod = -15.0f;  // One lung compromised
+			In.LungMod = -15.0f;  // One lung compromised
 		}
 	}
 
-	// Temperature affects oxygen binding
-	float TempMod = 0.0f;
-	if (Vitals.BodyTemperature < 35.0f)  // Hypothermia
-	{
-		// Paradoxically, oxygen binds better to hemoglobin in cold, but tissues use less
-		// Net effect: initially stable, then drops
-		if (Vitals.BodyTemperature < 32.0f)
-		{
-			TempMod = -((32.0f - Vitals.BodyTemperature) * 3.0f);
-		}
-	}
+	return In;
+}
+
+void UMOVitalsComponent::ApplyDerivedVitals(const FMOVitalsDerivationOutput& Derived)
+{
+	// Apply in the original calculation order so listeners see the same intermediate state
+	float OldHR = Vitals.HeartRate;
+	Vitals.HeartRate = Derived.HeartRate;
+	CheckAndBroadcastChange(FName("HeartRate"), OldHR, Vitals.HeartRate, 5.0f);
+
+	float OldSystolic = Vitals.SystolicBP;
+	float OldDiastolic = Vitals.DiastolicBP;
+	Vitals.SystolicBP = Derived.SystolicBP;
+	Vitals.DiastolicBP = Derived.DiastolicBP;
+	CheckAndBroadcastChange(FName("SystolicBP"), OldSystolic, Vitals.SystolicBP, 5.0f);
+	CheckAndBroadcastChange(FName("DiastolicBP"), OldDiastolic, Vitals.DiastolicBP, 5.0f);
 
-	Vitals.SpO2 = BaseSpO2 + VolumeMod + LungMod + TempMod;
-	Vitals.SpO2 = FMath::Clamp(Vitals.SpO2, 0.0f, 100.0f);
+	float OldRR = Vitals.RespiratoryRate;
+	Vitals.RespiratoryRate = Derived.RespiratoryRate;
+	CheckAndBroadcastChange(FName("RespiratoryRate"), OldRR, Vitals.RespiratoryRate, 2.0f);
 
+	float OldSpO2 = Vitals.SpO2;
+	Vitals.SpO2 = Derived.SpO2;
 	CheckAndBroadcastChange(FName("SpO2"), OldSpO2, Vitals.SpO2, 2.0f);
 }
 
@@ -0,0 +1,514 @@
+#include "MOVitalsKernels.h"
+#include "Math/VectorRegister.h"
+
+// ============================================================================
+// SCALAR KERNELS
+// ============================================================================
+
+float FMOVitalsKernels::GetBloodLossPercent(float BloodVolume, float MaxBloodVolume)
+{
+	const float LossFraction = MaxBloodVolume > 0.f ? 1.f - FMath::Clamp(BloodVolume / MaxBloodVolume, 0.f, 1.f) : 1.f;
+	return LossFraction * 100.0f;
+}
+
+float FMOVitalsKernels::DeriveHeartRate(const FMOVitalsDerivationInput& In)
+{
+	const float LossPercent = GetBloodLossPercent(In.BloodVolume, In.MaxBloodVolume);
+
+	// Exertion contribution (+0 to +80 BPM)
+	float ExertionMod = (In.CurrentExertion / 100.0f) * 80.0f;
+
+	// Blood loss contribution (compensatory tachycardia), Class1/2/3
+	float BloodLossMod = 0.0f;
+	if (LossPercent >= 40.0f)
+	{
+		BloodLossMod = 60.0f;
+	}
+	else if (LossPercent >= 30.0f)
+	{
+		BloodLossMod = 40.0f;
+	}
+	else if (LossPercent >= 15.0f)
+	{
+		BloodLossMod = 20.0f;
+	}
+
+	// Pain and stress contribution (+0 to +30 BPM)
+	float StressMod = ((In.PainLevel + In.StressLevel) / 200.0f) * 30.0f;
+
+	// Temperature effects
+	float TempMod = 0.0f;
+	if (In.BodyTemperature > 38.0f)  // Fever
+	{
+		TempMod = (In.BodyTemperature - 38.0f) * 10.0f;  // +10 BPM per degree
+	}
+	else if (In.BodyTemperature < 35.0f)  // Hypothermia
+	{
+		// Initially HR increases, then decreases
+		if (In.BodyTemperature > 32.0f)
+		{
+			TempMod = (35.0f - In.BodyTemperature) * 5.0f;  // Increased
+		}
+		else
+		{
+			TempMod = -((32.0f - In.BodyTemperature) * 10.0f);  // Decreased (dangerous)
+		}
+	}
+
+	// Low glucose can increase HR (adrenaline response)
+	float GlucoseMod = 0.0f;
+	if (In.BloodGlucose < 70.0f)
+	{
+		GlucoseMod = (70.0f - In.BloodGlucose) * 0.5f;
+	}
+
+	// Cardiovascular fitness effect (better fitness = lower HR), -10 to +10 BPM
+	float FitnessMod = 0.0f;
+	if (In.bHasFitness)
+	{
+		FitnessMod = -((In.Fitness - 50.0f) / 50.0f) * 10.0f;
+	}
+
+	float HeartRate = In.BaseHeartRate + ExertionMod + BloodLossMod + StressMod + TempMod + GlucoseMod + FitnessMod;
+
+	// Clamp to physiological limits
+	HeartRate = FMath::Clamp(HeartRate, 20.0f, 220.0f);
+
+	// Severe blood loss eventually causes bradycardia as heart fails
+	if (LossPercent >= 40.0f && In.BloodVolume < In.MaxBloodVolume * 0.4f)
+	{
+		HeartRate = FMath::Max(30.0f, HeartRate * 0.7f);
+	}
+
+	return HeartRate;
+}
+
+void FMOVitalsKernels::DeriveBloodPressure(const FMOVitalsDerivationInput& In, float& OutSystolic, float& OutDiastolic)
+{
+	// Base blood pressure (assuming healthy baseline)
+	const float BaseSystolic = 120.0f;
+	const float BaseDiastolic = 80.0f;
+
+	// Blood volume effect (most critical), by blood loss class
+	float VolumeRatio = In.BloodVolume / In.MaxBloodVolume;
+	float VolumeMod = 0.0f;
+
+	if (VolumeRatio >= 0.85f)  // <15% loss
+	{
+		VolumeMod = 0.0f;  // Compensated
+	}
+	else if (VolumeRatio >= 0.70f)  // 15-30% loss
+	{
+		// Pulse pressure narrows (systolic drops more than diastolic)
+		VolumeMod = -(0.85f - VolumeRatio) * 100.0f;  // Systolic drops
+	}
+	else if (VolumeRatio >= 0.60f)  // 30-40% loss
+	{
+		VolumeMod = -40.0f - (0.70f - VolumeRatio) * 200.0f;  // Significant drop
+	}
+	else  // >40% loss
+	{
+		VolumeMod = -60.0f - (0.60f - VolumeRatio) * 300.0f;  // Severe drop
+	}
+
+	// Exertion increases BP (systolic more than diastolic)
+	float ExertionSystolicMod = (In.CurrentExertion / 100.0f) * 40.0f;
+	float ExertionDiastolicMod = (In.CurrentExertion / 100.0f) * 10.0f;
+
+	// Stress increases BP
+	float StressMod = ((In.StressLevel + In.PainLevel) / 200.0f) * 20.0f;
+
+	float Systolic = BaseSystolic + VolumeMod + ExertionSystolicMod + StressMod;
+	float Diastolic = BaseDiastolic + (VolumeMod * 0.5f) + ExertionDiastolicMod + (StressMod * 0.5f);
+
+	// Clamp to physiological limits
+	Systolic = FMath::Clamp(Systolic, 40.0f, 220.0f);
+	Diastolic = FMath::Clamp(Diastolic, 20.0f, 140.0f);
+
+	// Ensure systolic > diastolic
+	if (Systolic <= Diastolic)
+	{
+		Diastolic = Systolic - 10.0f;
+	}
+
+	OutSystolic = Systolic;
+	OutDiastolic = Diastolic;
+}
+
+float FMOVitalsKernels::DeriveRespiratoryRate(const FMOVitalsDerivationInput& In)
+{
+	const float BaseRR = 16.0f;
+	const float LossPercent = GetBloodLossPercent(In.BloodVolume, In.MaxBloodVolume);
+
+	// Exertion increases RR significantly (up to 46/min during heavy exercise)
+	float ExertionMod = (In.CurrentExertion / 100.0f) * 30.0f;
+
+	// Low SpO2 increases RR (compensation)
+	float SpO2Mod = 0.0f;
+	if (In.SpO2 < 95.0f)
+	{
+		SpO2Mod = (95.0f - In.SpO2) * 0.5f;
+	}
+
+	// Blood loss increases RR, Class1/2/3
+	float BloodLossMod = 0.0f;
+	if (LossPercent >= 40.0f)
+	{
+		BloodLossMod = 12.0f;
+	}
+	else if (LossPercent >= 30.0f)
+	{
+		BloodLossMod = 8.0f;
+	}
+	else if (LossPercent >= 15.0f)
+	{
+		BloodLossMod = 4.0f;
+	}
+
+	// Fever increases RR
+	float TempMod = 0.0f;
+	if (In.BodyTemperature > 38.0f)
+	{
+		TempMod = (In.BodyTemperature - 38.0f) * 2.0f;
+	}
+
+	const float RespiratoryRate = BaseRR + ExertionMod + SpO2Mod + BloodLossMod + TempMod;
+	return FMath::Clamp(RespiratoryRate, 4.0f, 60.0f);
+}
+
+float FMOVitalsKernels::DeriveOxygenSaturation(const FMOVitalsDerivationInput& In)
+{
+	const float BaseSpO2 = 98.0f;
+
+	// Blood volume affects oxygen capacity
+	float VolumeRatio = In.BloodVolume / In.MaxBloodVolume;
+	float VolumeMod = 0.0f;
+	if (VolumeRatio < 0.7f)
+	{
+		VolumeMod = -((0.7f - VolumeRatio) * 30.0f);  // Significant drop at low blood volume
+	}
+
+	// Temperature affects oxygen binding: initially stable in hypothermia, then drops
+	float TempMod = 0.0f;
+	if (In.BodyTemperature < 35.0f)
+	{
+		if (In.BodyTemperature < 32.0f)
+		{
+			TempMod = -((32.0f - In.BodyTemperature) * 3.0f);
+		}
+	}
+
+	const float SpO2 = BaseSpO2 + VolumeMod + In.LungMod + TempMod;
+	return FMath::Clamp(SpO2, 0.0f, 100.0f);
+}
+
+FMOVitalsDerivationOutput FMOVitalsKernels::Derive(const FMOVitalsDerivationInput& In)
+{
+	FMOVitalsDerivationOutput Out;
+	Out.HeartRate = DeriveHeartRate(In);
+	DeriveBloodPressure(In, Out.SystolicBP, Out.DiastolicBP);
+	Out.RespiratoryRate = DeriveRespiratoryRate(In);
+	Out.SpO2 = DeriveOxygenSaturation(In);
+	return Out;
+}
+
+// ============================================================================
+// VECTOR HELPERS
+// ============================================================================
+// These mirror FMath semantics exactly (including NaN handling) so the batch
+// produces bit-identical results to the scalar kernels. No fused multiply-add.
+
+namespace
+{
+	/** FMath::Clamp: X < Min ? Min : (X < Max ? X : Max) */
+	FORCEINLINE VectorRegister4Float MOVectorClamp(const VectorRegister4Float& X, const VectorRegister4Float& Min, const VectorRegister4Float& Max)
+	{
+		return VectorSelect(VectorCompareLT(X, Min), Min, VectorSelect(VectorCompareLT(X, Max), X, Max));
+	}
+
+	/** FMath::Max: A >= B ? A : B */
+	FORCEINLINE VectorRegister4Float MOVectorMax(const VectorRegister4Float& A, const VectorRegister4Float& B)
+	{
+		return VectorSelect(VectorCompareGE(A, B), A, B);
+	}
+
+	FORCEINLINE VectorRegister4Float MOVectorBloodLossPercent(const VectorRegister4Float& Volume, const VectorRegister4Float& MaxVolume)
+	{
+		const VectorRegister4Float Zero = VectorZeroFloat();
+		const VectorRegister4Float One = VectorSetFloat1(1.0f);
+		const VectorRegister4Float Ratio = MOVectorClamp(VectorDivide(Volume, MaxVolume), Zero, One);
+		const VectorRegister4Float LossFraction = VectorSelect(VectorCompareGT(MaxVolume, Zero), VectorSubtract(One, Ratio), One);
+		return VectorMultiply(LossFraction, VectorSetFloat1(100.0f));
+	}
+
+	/** Pick a per-class value: Loss >= 40 ? C3 : Loss >= 30 ? C2 : Loss >= 15 ? C1 : 0 */
+	FORCEINLINE VectorRegister4Float MOVectorBloodLossClass(const VectorRegister4Float& LossPercent, float C1, float C2, float C3)
+	{
+		return VectorSelect(VectorCompareGE(LossPercent, VectorSetFloat1(40.0f)), VectorSetFloat1(C3),
+			VectorSelect(VectorCompareGE(LossPercent, VectorSetFloat1(30.0f)), VectorSetFloat1(C2),
+				VectorSelect(VectorCompareGE(LossPercent, VectorSetFloat1(15.0f)), VectorSetFloat1(C1), VectorZeroFloat())));
+	}
+}
+
+// ============================================================================
+// BATCH
+// ============================================================================
+
+void FMOVitalsBatch::Reset()
+{
+	Count = 0;
+
+	BloodVolume.Reset();
+	MaxBloodVolume.Reset();
+	BaseHeartRate.Reset();
+	BodyTemperature.Reset();
+	BloodGlucose.Reset();
+	InSpO2.Reset();
+	CurrentExertion.Reset();
+	StressLevel.Reset();
+	PainLevel.Reset();
+	Fitness.Reset();
+	HasFitness.Reset();
+	LungMod.Reset();
+
+	HeartRate.Reset();
+	SystolicBP.Reset();
+	DiastolicBP.Reset();
+	RespiratoryRate.Reset();
+	OutSpO2.Reset();
+}
+
+int32 FMOVitalsBatch::Add(const FMOVitalsDerivationInput& In)
+{
+	// Drop padding from a previous derive before appending
+	const int32 Index = Count;
+	if (BloodVolume.Num() != Count)
+	{
+		BloodVolume.SetNum(Count, EAllowShrinking::No);
+		MaxBloodVolume.SetNum(Count, EAllowShrinking::No);
+		BaseHeartRate.SetNum(Count, EAllowShrinking::No);
+		BodyTemperature.SetNum(Count, EAllowShrinking::No);
+		BloodGlucose.SetNum(Count, EAllowShrinking::No);
+		InSpO2.SetNum(Count, EAllowShrinking::No);
+		CurrentExertion.SetNum(Count, EAllowShrinking::No);
+		StressLevel.SetNum(Count, EAllowShrinking::No);
+		PainLevel.SetNum(Count, EAllowShrinking::No);
+		Fitness.SetNum(Count, EAllowShrinking::No);
+		HasFitness.SetNum(Count, EAllowShrinking::No);
+		LungMod.SetNum(Count, EAllowShrinking::No);
+	}
+
+	BloodVolume.Add(In.BloodVolume);
+	MaxBloodVolume.Add(In.MaxBloodVolume);
+	BaseHeartRate.Add(In.BaseHeartRate);
+	BodyTemperature.Add(In.BodyTemperature);
+	BloodGlucose.Add(In.BloodGlucose);
+	InSpO2.Add(In.SpO2);
+	CurrentExertion.Add(In.CurrentExertion);
+	StressLevel.Add(In.StressLevel);
+	PainLevel.Add(In.PainLevel);
+	Fitness.Add(In.Fitness);
+	HasFitness.Add(In.bHasFitness ? 1.0f : 0.0f);
+	LungMod.Add(In.LungMod);
+
+	Count++;
+	return Index;
+}
+
+void FMOVitalsBatch::PadToLaneWidth()
+{
+	const int32 Padded = Align(Count, LaneWidth);
+	const FMOVitalsDerivationInput Pad;
+
+	while (BloodVolume.Num() < Padded)
+	{
+		BloodVolume.Add(Pad.BloodVolume);
+		MaxBloodVolume.Add(Pad.MaxBloodVolume);
+		BaseHeartRate.Add(Pad.BaseHeartRate);
+		BodyTemperature.Add(Pad.BodyTemperature);
+		BloodGlucose.Add(Pad.BloodGlucose);
+		InSpO2.Add(Pad.SpO2);
+		CurrentExertion.Add(Pad.CurrentExertion);
+		StressLevel.Add(Pad.StressLevel);
+		PainLevel.Add(Pad.PainLevel);
+		Fitness.Add(Pad.Fitness);
+		HasFitness.Add(0.0f);
+		LungMod.Add(Pad.LungMod);
+	}
+
+	HeartRate.SetNumUninitialized(Padded, EAllowShrinking::No);
+	SystolicBP.SetNumUninitialized(Padded, EAllowShrinking::No);
+	DiastolicBP.SetNumUninitialized(Padded, EAllowShrinking::No);
+	RespiratoryRate.SetNumUninitialized(Padded, EAllowShrinking::No);
+	OutSpO2.SetNumUninitialized(Padded, EAllowShrinking::No);
+}
+
+FMOVitalsDerivationOutput FMOVitalsBatch::GetOutput(int32 Index) const
+{
+	FMOVitalsDerivationOutput Out;
+	if (Index < 0 || Index >= Count || !HeartRate.IsValidIndex(Index))
+	{
+		return Out;
+	}
+
+	Out.HeartRate = HeartRate[Index];
+	Out.SystolicBP = SystolicBP[Index];
+	Out.DiastolicBP = DiastolicBP[Index];
+	Out.RespiratoryRate = RespiratoryRate[Index];
+	Out.SpO2 = OutSpO2[Index];
+	return Out;
+}
+
+void FMOVitalsBatch::DeriveAllScalar()
+{
+	PadToLaneWidth();
+
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FMOVitalsDerivationInput In;
+		In.BloodVolume = BloodVolume[i];
+		In.MaxBloodVolume = MaxBloodVolume[i];
+		In.BaseHeartRate = BaseHeartRate[i];
+		In.BodyTemperature = BodyTemperature[i];
+		In.BloodGlucose = BloodGlucose[i];
+		In.SpO2 = InSpO2[i];
+		In.CurrentExertion = CurrentExertion[i];
+		In.StressLevel = StressLevel[i];
+		In.PainLevel = PainLevel[i];
+		In.Fitness = Fitness[i];
+		In.bHasFitness = HasFitness[i] > 0.0f;
+		In.LungMod = LungMod[i];
+
+		const FMOVitalsDerivationOutput Out = FMOVitalsKernels::Derive(In);
+		HeartRate[i] = Out.HeartRate;
+		SystolicBP[i] = Out.SystolicBP;
+		DiastolicBP[i] = Out.DiastolicBP;
+		RespiratoryRate[i] = Out.RespiratoryRate;
+		OutSpO2[i] = Out.SpO2;
+	}
+}
+
+void FMOVitalsBatch::DeriveAll()
+{
+	PadToLaneWidth();
+
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float Hundred = VectorSetFloat1(100.0f);
+
+	for (int32 i = 0; i < Count; i += LaneWidth)
+	{
+		const VectorRegister4Float Volume = VectorLoad(&BloodVolume[i]);
+		const VectorRegister4Float MaxVolume = VectorLoad(&MaxBloodVolume[i]);
+		const VectorRegister4Float Temp = VectorLoad(&BodyTemperature[i]);
+		const VectorRegister4Float Glucose = VectorLoad(&BloodGlucose[i]);
+		const VectorRegister4Float PrevSpO2 = VectorLoad(&InSpO2[i]);
+		const VectorRegister4Float Exert = VectorLoad(&CurrentExertion[i]);
+		const VectorRegister4Float Stress = VectorLoad(&StressLevel[i]);
+		const VectorRegister4Float Pain = VectorLoad(&PainLevel[i]);
+
+		const VectorRegister4Float LossPercent = MOVectorBloodLossPercent(Volume, MaxVolume);
+		const VectorRegister4Float VolumeRatio = VectorDivide(Volume, MaxVolume);
+		const VectorRegister4Float ExertFraction = VectorDivide(Exert, Hundred);
+
+		// --- Heart rate ---
+		{
+			const VectorRegister4Float ExertionMod = VectorMultiply(ExertFraction, VectorSetFloat1(80.0f));
+			const VectorRegister4Float BloodLossMod = MOVectorBloodLossClass(LossPercent, 20.0f, 40.0f, 60.0f);
+			const VectorRegister4Float StressMod = VectorMultiply(VectorDivide(VectorAdd(Pain, Stress), VectorSetFloat1(200.0f)), VectorSetFloat1(30.0f));
+
+			const VectorRegister4Float Fever = VectorMultiply(VectorSubtract(Temp, VectorSetFloat1(38.0f)), VectorSetFloat1(10.0f));
+			const VectorRegister4Float MildHypo = VectorMultiply(VectorSubtract(VectorSetFloat1(35.0f), Temp), VectorSetFloat1(5.0f));
+			const VectorRegister4Float SevereHypo = VectorNegate(VectorMultiply(VectorSubtract(VectorSetFloat1(32.0f), Temp), VectorSetFloat1(10.0f)));
+			const VectorRegister4Float Hypo = VectorSelect(VectorCompareGT(Temp, VectorSetFloat1(32.0f)), MildHypo, SevereHypo);
+			const VectorRegister4Float TempMod = VectorSelect(VectorCompareGT(Temp, VectorSetFloat1(38.0f)), Fever,
+				VectorSelect(VectorCompareLT(Temp, VectorSetFloat1(35.0f)), Hypo, Zero));
+
+			const VectorRegister4Float GlucoseMod = VectorSelect(VectorCompareLT(Glucose, VectorSetFloat1(70.0f)),
+				VectorMultiply(VectorSubtract(VectorSetFloat1(70.0f), Glucose), VectorSetFloat1(0.5f)), Zero);
+
+			const VectorRegister4Float Fit = VectorLoad(&Fitness[i]);
+			const VectorRegister4Float FitnessValue = VectorMultiply(
+				VectorNegate(VectorDivide(VectorSubtract(Fit, VectorSetFloat1(50.0f)), VectorSetFloat1(50.0f))), VectorSetFloat1(10.0f));
+			const VectorRegister4Float FitnessMod = VectorSelect(VectorCompareGT(VectorLoad(&HasFitness[i]), Zero), FitnessValue, Zero);
+
+			VectorRegister4Float HR = VectorLoad(&BaseHeartRate[i]);
+			HR = VectorAdd(HR, ExertionMod);
+			HR = VectorAdd(HR, BloodLossMod);
+			HR = VectorAdd(HR, StressMod);
+			HR = VectorAdd(HR, TempMod);
+			HR = VectorAdd(HR, GlucoseMod);
+			HR = VectorAdd(HR, FitnessMod);
+			HR = MOVectorClamp(HR, VectorSetFloat1(20.0f), VectorSetFloat1(220.0f));
+
+			const VectorRegister4Float FailingMask = VectorBitwiseAnd(
+				VectorCompareGE(LossPercent, VectorSetFloat1(40.0f)),
+				VectorCompareLT(Volume, VectorMultiply(MaxVolume, VectorSetFloat1(0.4f))));
+			HR = VectorSelect(FailingMask, MOVectorMax(VectorSetFloat1(30.0f), VectorMultiply(HR, VectorSetFloat1(0.7f))), HR);
+
+			VectorStore(HR, &HeartRate[i]);
+		}
+
+		// --- Blood pressure ---
+		{
+			const VectorRegister4Float Narrowing = VectorNegate(
+				VectorMultiply(VectorSubtract(VectorSetFloat1(0.85f), VolumeRatio), VectorSetFloat1(100.0f)));
+			const VectorRegister4Float Significant = VectorSubtract(VectorSetFloat1(-40.0f),
+				VectorMultiply(VectorSubtract(VectorSetFloat1(0.70f), VolumeRatio), VectorSetFloat1(200.0f)));
+			const VectorRegister4Float Severe = VectorSubtract(VectorSetFloat1(-60.0f),
+				VectorMultiply(VectorSubtract(VectorSetFloat1(0.60f), VolumeRatio), VectorSetFloat1(300.0f)));
+			const VectorRegister4Float VolumeMod = VectorSelect(VectorCompareLT(VolumeRatio, VectorSetFloat1(0.60f)), Severe,
+				VectorSelect(VectorCompareLT(VolumeRatio, VectorSetFloat1(0.70f)), Significant,
+				VectorSelect(VectorCompareLT(VolumeRatio, VectorSetFloat1(0.85f)), Narrowing, Zero)));
+
+			const VectorRegister4Float ExertionSystolicMod = VectorMultiply(ExertFraction, VectorSetFloat1(40.0f));
+			const VectorRegister4Float ExertionDiastolicMod = VectorMultiply(ExertFraction, VectorSetFloat1(10.0f));
+			const VectorRegister4Float StressMod = VectorMultiply(VectorDivide(VectorAdd(Stress, Pain), VectorSetFloat1(200.0f)), VectorSetFloat1(20.0f));
+			const VectorRegister4Float Half = VectorSetFloat1(0.5f);
+
+			VectorRegister4Float Systolic = VectorAdd(VectorAdd(VectorAdd(VectorSetFloat1(120.0f), VolumeMod), ExertionSystolicMod), StressMod);
+			VectorRegister4Float Diastolic = VectorAdd(VectorAdd(VectorAdd(VectorSetFloat1(80.0f), VectorMultiply(VolumeMod, Half)), ExertionDiastolicMod), VectorMultiply(StressMod, Half));
+
+			Systolic = MOVectorClamp(Systolic, VectorSetFloat1(40.0f), VectorSetFloat1(220.0f));
+			Diastolic = MOVectorClamp(Diastolic, VectorSetFloat1(20.0f), VectorSetFloat1(140.0f));
+			Diastolic = VectorSelect(VectorCompareLE(Systolic, Diastolic), VectorSubtract(Systolic, VectorSetFloat1(10.0f)), Diastolic);
+
+			VectorStore(Systolic, &SystolicBP[i]);
+			VectorStore(Diastolic, &DiastolicBP[i]);
+		}
+
+		// --- Respiratory rate ---
+		{
+			const VectorRegister4Float ExertionMod = VectorMultiply(ExertFraction, VectorSetFloat1(30.0f));
+			const VectorRegister4Float SpO2Mod = VectorSelect(VectorCompareLT(PrevSpO2, VectorSetFloat1(95.0f)),
+				VectorMultiply(VectorSubtract(VectorSetFloat1(95.0f), PrevSpO2), VectorSetFloat1(0.5f)), Zero);
+			const VectorRegister4Float BloodLossMod = MOVectorBloodLossClass(LossPercent, 4.0f, 8.0f, 12.0f);
+			const VectorRegister4Float TempMod = VectorSelect(VectorCompareGT(Temp, VectorSetFloat1(38.0f)),
+				VectorMultiply(VectorSubtract(Temp, VectorSetFloat1(38.0f)), VectorSetFloat1(2.0f)), Zero);
+
+			VectorRegister4Float RR = VectorSetFloat1(16.0f);
+			RR = VectorAdd(RR, ExertionMod);
+			RR = VectorAdd(RR, SpO2Mod);
+			RR = VectorAdd(RR, BloodLossMod);
+			RR = VectorAdd(RR, TempMod);
+			RR = MOVectorClamp(RR, VectorSetFloat1(4.0f), VectorSetFloat1(60.0f));
+
+			VectorStore(RR, &RespiratoryRate[i]);
+		}
+
+		// --- Oxygen saturation ---
+		{
+			const VectorRegister4Float VolumeMod = VectorSelect(VectorCompareLT(VolumeRatio, VectorSetFloat1(0.7f)),
+				VectorNegate(VectorMultiply(VectorSubtract(VectorSetFloat1(0.7f), VolumeRatio), VectorSetFloat1(30.0f))), Zero);
+			const VectorRegister4Float TempMod = VectorSelect(VectorCompareLT(Temp, VectorSetFloat1(32.0f)),
+				VectorNegate(VectorMultiply(VectorSubtract(VectorSetFloat1(32.0f), Temp), VectorSetFloat1(3.0f))), Zero);
+
+			VectorRegister4Float SpO2 = VectorSetFloat1(98.0f);
+			SpO2 = VectorAdd(SpO2, VolumeMod);
+			SpO2 = VectorAdd(SpO2, VectorLoad(&LungMod[i]));
+			SpO2 = VectorAdd(SpO2, TempMod);
+			SpO2 = MOVectorClamp(SpO2, Zero, Hundred);
+
+			VectorStore(SpO2, &OutSpO2[i]);
+		}
+	}
+}
@@ -3,12 +3,14 @@
 #include "Engine/DataTable.h"
 #include "MOItemDatabaseSettings.h"
 #include "MOItemDefinitionRow.h"
+#include "MOItemAssetStreamingSubsystem.h"
 
 #include "Components/StaticMeshComponent.h"
 #include "Components/SphereComponent.h"
 #include "MOIdentityComponent.h"
 #include "MOInteractableComponent.h"
 #include "MOItemComponent.h"
+#include "MOWorldItemPoolSubsystem.h"
 
 AMOWorldItem::AMOWorldItem()
 {
@@ -75,7 +77,13 @@ bool AMOWorldItem::OnHandleInteract(AController* InteractorController)
 
 			if (bDestroyAfterPickup)
 			{
-				Destroy();
+				// Pooled drops are parked for the next drop; everything else (and overflow) is destroyed.
+				UWorld* World = GetWorld();
+				UMOWorldItemPoolSubsystem* Pool = (bPooled && World) ? World->GetSubsystem<UMOWorldItemPoolSubsystem>() : nullptr;
+				if (!Pool || !Pool->ReleaseWorldItem(this))
+				{
+					Destroy();
+				}
 			}
 		}
 	}
@@ -111,9 +119,36 @@ void AMOWorldItem::BeginPlay()
 	if (IsValid(ItemComponent))
 	{
 		ItemComponent->OnItemDefinitionIdChanged.AddDynamic(this, &AMOWorldItem::HandleItemDefinitionIdChanged);
+		ItemComponent->OnWorldItemActiveChanged.AddDynamic(this, &AMOWorldItem::HandleWorldItemActiveChanged);
 	}
 
 	ApplyItemDefinitionToWorldMesh();
+	RefreshRenderInstance();
+}
+
+void AMOWorldItem::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UWorld* World = GetWorld())
+	{
+		if (UMOWorldItemPoolSubsystem* Pool = World->GetSubsystem<UMOWorldItemPoolSubsystem>())
+		{
+			Pool->RemoveRenderInstance(this);
+		}
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMOWorldItem::PostNetReceiveLocationAndRotation()
+{
+	Super::PostNetReceiveLocationAndRotation();
+
+	// Clients learn about moves (drop physics, pool reuse) only through replicated movement.
+	if (IsValid(ItemComponent))
+	{
+		ItemComponent->RefreshWorldItemIndex();
+	}
+	RefreshRenderInstance();
 }
 
 void AMOWorldItem::OnConstruction(const FTransform& Transform)
@@ -143,6 +178,95 @@ void AMOWorldItem::HandleItemDefinitionIdChanged(FName NewItemDefinitionId)
 	ApplyItemDefinitionToWorldMesh();
 }
 
+void AMOWorldItem::HandleWorldItemActiveChanged(bool bIsActive)
+{
+	RefreshRenderInstance();
+}
+
+void AMOWorldItem::RefreshRenderInstance()
+{
+	UWorld* World = GetWorld();
+	UMOWorldItemPoolSubsystem* Pool = World ? World->GetSubsystem<UMOWorldItemPoolSubsystem>() : nullptr;
+	if (!Pool || !IsValid(ItemMesh))
+	{
+		return;
+	}
+
+	const bool bResting = HasActorBegunPlay()
+		&& !IsActorBeingDestroyed()
+		&& !bParkedInPool
+		&& !bDropPhysicsActive
+		&& !ItemMesh->IsSimulatingPhysics()
+		&& IsValid(ItemMesh->GetStaticMesh())
+		&& IsValid(ItemComponent) && ItemComponent->IsWorldItemActive()
+		&& UMOWorldItemPoolSubsystem::IsInstancingEnabled();
+
+	if (bResting)
+	{
+		Pool->AddRenderInstance(this);
+		// Hidden only from rendering; collision stays for interaction traces.
+		ItemMesh->SetVisibility(!Pool->IsRenderInstanced(this));
+	}
+	else if (Pool->IsRenderInstanced(this))
+	{
+		Pool->RemoveRenderInstance(this);
+		ItemMesh->SetVisibility(true);
+	}
+}
+
+void AMOWorldItem::ParkInPool()
+{
+	bParkedInPool = true;
+	bDropPhysicsActive = false;
+	bDropPhysicsPending = false;
+	SetActorTickEnabled(false);
+
+	if (IsValid(ItemMesh))
+	{
+		ItemMesh->SetSimulatePhysics(false);
+	}
+
+	if (IsValid(ItemComponent))
+	{
+		ItemComponent->SetWorldItemActive(false);
+		ItemComponent->RemoveFromWorldItemIndex();
+	}
+
+	// The GUID now lives in an inventory; this actor must not resolve or persist as that item.
+	if (IsValid(IdentityComponent))
+	{
+		IdentityComponent->ReleaseGuid();
+	}
+
+	RefreshRenderInstance();
+
+	// Parked actors stop costing replication until reused.
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void AMOWorldItem::ActivateFromPool(const FTransform& SpawnTransform)
+{
+	bParkedInPool = false;
+	SetNetDormancy(DORM_Awake);
+
+	SetActorTransform(SpawnTransform, false, nullptr, ETeleportType::ResetPhysics);
+
+	if (IsValid(ItemMesh))
+	{
+		// SettleOnGround left the mesh query-only; drop physics needs the constructor setup back.
+		ItemMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	}
+
+	if (IsValid(ItemComponent))
+	{
+		ItemComponent->SetWorldItemActive(true);
+		ItemComponent->RefreshWorldItemIndex();
+	}
+
+	RefreshRenderInstance();
+	ForceNetUpdate();
+}
+
 bool AMOWorldItem::ApplyItemDefinitionToWorldMesh()
 {
 	if (!IsValid(ItemComponent) || !IsValid(ItemMesh))
@@ -170,22 +294,48 @@ bool AMOWorldItem::ApplyItemDefinitionToWorldMesh()
 		return false;
 	}
 
+	// ItemMesh is also the collision and physics body, so authority (listen and dedicated servers) loads it
+	// directly. Pure clients stream mesh and material (batched with the rest of this spawn wave) and show the
+	// placeholder until this runs again once they land. Editor construction loads directly.
+	UMOItemAssetStreamingSubsystem* Streaming = HasAuthority() ? nullptr : UMOItemAssetStreamingSubsystem::Get(this);
+	const FSimpleDelegate ReapplyWhenLoaded = FSimpleDelegate::CreateWeakLambda(this, [this]()
+	{
+		// Same as DropItemByGuid: applying the definition must not move the actor (ItemMesh is root).
+		const FVector PreservedLocation = GetActorLocation();
+		const FRotator PreservedRotation = GetActorRotation();
+		ApplyItemDefinitionToWorldMesh();
+		SetActorLocationAndRotation(PreservedLocation, PreservedRotation);
+	});
+
 	if (!ItemDefinitionRow->WorldVisual.StaticMesh.IsNull())
 	{
-		UStaticMesh* LoadedMesh = ItemDefinitionRow->WorldVisual.StaticMesh.LoadSynchronous();
+		UStaticMesh* LoadedMesh = Streaming
+			? Streaming->RequestAsset(ItemDefinitionRow->WorldVisual.StaticMesh, ReapplyWhenLoaded)
+			: ItemDefinitionRow->WorldVisual.StaticMesh.LoadSynchronous();
 		if (IsValid(LoadedMesh))
 		{
 			ItemMesh->SetStaticMesh(LoadedMesh);
 		}
+		else if (Streaming)
+		{
+			ItemMesh->SetStaticMesh(Streaming->GetPlaceholderWorldMesh());
+		}
 	}
 
 	if (!ItemDefinitionRow->WorldVisual.MaterialOverride.IsNull())
 	{
-		UMaterialInterface* LoadedMaterial = ItemDefinitionRow->WorldVisual.MaterialOverride.LoadSynchronous();
+		UMaterialInterface* LoadedMaterial = Streaming
+			? Streaming->RequestAsset(ItemDefinitionRow->WorldVisual.MaterialOverride, ReapplyWhenLoaded)
+			: ItemDefinitionRow->WorldVisual.MaterialOverride.LoadSynchronous();
 		if (IsValid(LoadedMaterial))
 		{
 			ItemMesh->SetMaterial(0, LoadedMaterial);
 		}
+		else if (Streaming)
+		{
+			// Clear any override left from a previous definition (pooled actors) while the new one loads.
+			ItemMesh->SetMaterial(0, nullptr);
+		}
 	}
 
 	// Only apply scale and rotation from definition, NOT location
@@ -205,6 +355,14 @@ bool AMOWorldItem::ApplyItemDefinitionToWorldMesh()
 		IdentityComponent->SetDisplayName(ItemDefinitionRow->DisplayName);
 	}
 
+	// Mesh, material or scale may have changed; move the render instance with them.
+	RefreshRenderInstance();
+
+	if (bDropPhysicsPending && HasDropPhysicsBody())
+	{
+		EnableDropPhysics();
+	}
+
 	return true;
 }
 
@@ -272,6 +430,15 @@ void AMOWorldItem::EnableDropPhysics()
 		IsValid(CurrentMesh) ? *CurrentMesh->GetName() : TEXT("NULL"),
 		ItemMesh->IsSimulatingPhysics() ? TEXT("true") : TEXT("false"));
 
+	// Simulating the placeholder (or no mesh) would drop the item with the wrong body; wait for the real one.
+	if (!HasDropPhysicsBody())
+	{
+		UE_LOG(LogMOFramework, Warning, TEXT("[MOWorldItem] EnableDropPhysics: No definition mesh yet, deferring until it is applied"));
+		bDropPhysicsPending = true;
+		return;
+	}
+	bDropPhysicsPending = false;
+
 	// Enable physics simulation - collision is already set up in constructor
 	ItemMesh->SetSimulatePhysics(true);
 
@@ -282,6 +449,9 @@ void AMOWorldItem::EnableDropPhysics()
 	bDropPhysicsActive = true;
 	DropPhysicsStartTime = World->GetTimeSeconds();
 
+	// A moving item needs its own mesh back.
+	RefreshRenderInstance();
+
 	// Enable tick to monitor physics
 	SetActorTickEnabled(true);
 
@@ -289,6 +459,18 @@ void AMOWorldItem::EnableDropPhysics()
 		bDropPhysicsActive ? TEXT("true") : TEXT("false"), DropPhysicsStartTime);
 }
 
+bool AMOWorldItem::HasDropPhysicsBody() const
+{
+	const UStaticMesh* CurrentMesh = IsValid(ItemMesh) ? ItemMesh->GetStaticMesh() : nullptr;
+	if (!IsValid(CurrentMesh))
+	{
+		return false;
+	}
+
+	const UMOItemDatabaseSettings* Settings = GetDefault<UMOItemDatabaseSettings>();
+	return !Settings || CurrentMesh != Settings->PlaceholderWorldMesh.Get();
+}
+
 void AMOWorldItem::SettleOnGround()
 {
 	UE_LOG(LogMOFramework, Warning, TEXT("[MOWorldItem] SettleOnGround called for %s at %s"),
@@ -345,4 +527,12 @@ void AMOWorldItem::SettleOnGround()
 
 	// Keep collision enabled for interaction traces but disable physics response
 	ItemMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+	// The item has stopped moving; file it under its resting location.
+	if (IsValid(ItemComponent))
+	{
+		ItemComponent->RefreshWorldItemIndex();
+	}
+
+	RefreshRenderInstance();
 }
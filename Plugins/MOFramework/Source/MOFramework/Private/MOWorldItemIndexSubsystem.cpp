@@ -0,0 +1,298 @@
+#include "MOWorldItemIndexSubsystem.h"
+
+#include "MOItemComponent.h"
+#include "GameFramework/Actor.h"
+
+void UMOWorldItemIndexSubsystem::Deinitialize()
+{
+	ItemsByComponent.Empty();
+	Cells.Empty();
+	Layers.Empty();
+
+	Super::Deinitialize();
+}
+
+FIntPoint UMOWorldItemIndexSubsystem::GetCellForLocation(const FVector& Location)
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+}
+
+/*
+ * Registration
+ */
+void UMOWorldItemIndexSubsystem::RegisterItem(UMOItemComponent* ItemComponent)
+{
+	if (!IsValid(ItemComponent) || !IsValid(ItemComponent->GetOwner()))
+	{
+		return;
+	}
+
+	if (ItemsByComponent.Contains(ItemComponent))
+	{
+		UpdateItem(ItemComponent);
+		return;
+	}
+
+	FIndexedItem Item;
+	Item.ItemComponent = ItemComponent;
+	Item.ItemDefinitionId = ItemComponent->ItemDefinitionId;
+	Item.Location = ItemComponent->GetOwner()->GetActorLocation();
+	Item.Cell = GetCellForLocation(Item.Location);
+
+	AddToCells(Item);
+	ItemsByComponent.Add(ItemComponent, Item);
+}
+
+void UMOWorldItemIndexSubsystem::UnregisterItem(UMOItemComponent* ItemComponent)
+{
+	FIndexedItem RemovedItem;
+	if (ItemsByComponent.RemoveAndCopyValue(ItemComponent, RemovedItem))
+	{
+		RemoveFromCells(RemovedItem);
+	}
+}
+
+void UMOWorldItemIndexSubsystem::UpdateItem(UMOItemComponent* ItemComponent)
+{
+	if (!IsValid(ItemComponent) || !IsValid(ItemComponent->GetOwner()))
+	{
+		return;
+	}
+
+	FIndexedItem* Item = ItemsByComponent.Find(ItemComponent);
+	if (!Item)
+	{
+		RegisterItem(ItemComponent);
+		return;
+	}
+
+	const FVector NewLocation = ItemComponent->GetOwner()->GetActorLocation();
+	const FIntPoint NewCell = GetCellForLocation(NewLocation);
+
+	// Same cell and definition: only the stored location moves.
+	if (NewCell == Item->Cell && ItemComponent->ItemDefinitionId == Item->ItemDefinitionId)
+	{
+		Item->Location = NewLocation;
+		for (const FName Layer : { FName(NAME_None), Item->ItemDefinitionId })
+		{
+			if (TArray<FCellItem>* CellItems = Cells.Find(FCellKey{ Layer, Item->Cell }))
+			{
+				for (FCellItem& CellItem : *CellItems)
+				{
+					if (CellItem.ItemComponent == Item->ItemComponent)
+					{
+						CellItem.Location = NewLocation;
+					}
+				}
+			}
+		}
+		return;
+	}
+
+	RemoveFromCells(*Item);
+	Item->ItemDefinitionId = ItemComponent->ItemDefinitionId;
+	Item->Location = NewLocation;
+	Item->Cell = NewCell;
+	AddToCells(*Item);
+}
+
+void UMOWorldItemIndexSubsystem::AddToCells(const FIndexedItem& Item)
+{
+	const FCellItem CellItem{ Item.ItemComponent, Item.Location };
+
+	auto AddToLayer = [this, &Item, &CellItem](FName Layer)
+	{
+		Cells.FindOrAdd(FCellKey{ Layer, Item.Cell }).Add(CellItem);
+
+		FLayerStats& Stats = Layers.FindOrAdd(Layer);
+		Stats.ItemCount++;
+		Stats.MinCell = FIntPoint(FMath::Min(Stats.MinCell.X, Item.Cell.X), FMath::Min(Stats.MinCell.Y, Item.Cell.Y));
+		Stats.MaxCell = FIntPoint(FMath::Max(Stats.MaxCell.X, Item.Cell.X), FMath::Max(Stats.MaxCell.Y, Item.Cell.Y));
+	};
+
+	AddToLayer(NAME_None);
+	if (!Item.ItemDefinitionId.IsNone())
+	{
+		AddToLayer(Item.ItemDefinitionId);
+	}
+}
+
+void UMOWorldItemIndexSubsystem::RemoveFromCells(const FIndexedItem& Item)
+{
+	auto RemoveFromLayer = [this, &Item](FName Layer)
+	{
+		const FCellKey Key{ Layer, Item.Cell };
+		TArray<FCellItem>* CellItems = Cells.Find(Key);
+		if (!CellItems)
+		{
+			return;
+		}
+
+		const int32 NumRemoved = CellItems->RemoveAllSwap([&Item](const FCellItem& CellItem)
+		{
+			return CellItem.ItemComponent == Item.ItemComponent;
+		});
+
+		if (CellItems->Num() == 0)
+		{
+			Cells.Remove(Key);
+		}
+
+		FLayerStats* Stats = Layers.Find(Layer);
+		if (Stats && NumRemoved > 0)
+		{
+			Stats->ItemCount -= NumRemoved;
+			if (Stats->ItemCount <= 0)
+			{
+				Layers.Remove(Layer);
+			}
+		}
+	};
+
+	RemoveFromLayer(NAME_None);
+	if (!Item.ItemDefinitionId.IsNone())
+	{
+		RemoveFromLayer(Item.ItemDefinitionId);
+	}
+}
+
+/*
+ * Queries
+ */
+AActor* UMOWorldItemIndexSubsystem::ResolveActiveItem(const FCellItem& CellItem)
+{
+	const UMOItemComponent* ItemComponent = CellItem.ItemComponent.Get();
+	if (!IsValid(ItemComponent) || !ItemComponent->IsWorldItemActive())
+	{
+		return nullptr;
+	}
+
+	AActor* OwnerActor = ItemComponent->GetOwner();
+	return (IsValid(OwnerActor) && !OwnerActor->IsActorBeingDestroyed()) ? OwnerActor : nullptr;
+}
+
+void UMOWorldItemIndexSubsystem::FindItemsInRadius(const FVector& Center, float Radius, FName ItemDefinitionId, TArray<AActor*>& OutItemActors) const
+{
+	OutItemActors.Reset();
+
+	const FLayerStats* Layer = Layers.Find(ItemDefinitionId);
+	if (Radius < 0.0f || !Layer)
+	{
+		return;
+	}
+
+	// Clamp to the layer's occupied cells so a huge radius costs no more than the layer itself.
+	const FIntPoint MinCell = GetCellForLocation(Center - FVector(Radius));
+	const FIntPoint MaxCell = GetCellForLocation(Center + FVector(Radius));
+	const int32 MinX = FMath::Max(MinCell.X, Layer->MinCell.X);
+	const int32 MinY = FMath::Max(MinCell.Y, Layer->MinCell.Y);
+	const int32 MaxX = FMath::Min(MaxCell.X, Layer->MaxCell.X);
+	const int32 MaxY = FMath::Min(MaxCell.Y, Layer->MaxCell.Y);
+	const double RadiusSq = FMath::Square(static_cast<double>(Radius));
+
+	for (int32 CellY = MinY; CellY <= MaxY; ++CellY)
+	{
+		for (int32 CellX = MinX; CellX <= MaxX; ++CellX)
+		{
+			const TArray<FCellItem>* CellItems = Cells.Find(FCellKey{ ItemDefinitionId, FIntPoint(CellX, CellY) });
+			if (!CellItems)
+			{
+				continue;
+			}
+
+			for (const FCellItem& CellItem : *CellItems)
+			{
+				if (FVector::DistSquared(CellItem.Location, Center) > RadiusSq)
+				{
+					continue;
+				}
+
+				if (AActor* ItemActor = ResolveActiveItem(CellItem))
+				{
+					OutItemActors.Add(ItemActor);
+				}
+			}
+		}
+	}
+}
+
+AActor* UMOWorldItemIndexSubsystem::FindNearestItem(const FVector& Origin, FName ItemDefinitionId, float MaxRadius) const
+{
+	// No items of this definition anywhere: nothing to scan.
+	const FLayerStats* Layer = Layers.Find(ItemDefinitionId);
+	if (!Layer)
+	{
+		return nullptr;
+	}
+
+	// Rings past the layer's occupied bounds are empty, so they cap an unlimited search.
+	const FIntPoint OriginCell = GetCellForLocation(Origin);
+	int32 MaxRing = FMath::Max(
+		FMath::Max(FMath::Abs(OriginCell.X - Layer->MinCell.X), FMath::Abs(Layer->MaxCell.X - OriginCell.X)),
+		FMath::Max(FMath::Abs(OriginCell.Y - Layer->MinCell.Y), FMath::Abs(Layer->MaxCell.Y - OriginCell.Y)));
+	if (MaxRadius > 0.0f)
+	{
+		MaxRing = FMath::Min(MaxRing, FMath::CeilToInt(MaxRadius / CellSize));
+	}
+
+	double BestDistSq = MaxRadius > 0.0f ? FMath::Square(static_cast<double>(MaxRadius)) : TNumericLimits<double>::Max();
+	AActor* BestActor = nullptr;
+
+	auto VisitCell = [&](int32 CellX, int32 CellY)
+	{
+		const TArray<FCellItem>* CellItems = Cells.Find(FCellKey{ ItemDefinitionId, FIntPoint(CellX, CellY) });
+		if (!CellItems)
+		{
+			return;
+		}
+
+		for (const FCellItem& CellItem : *CellItems)
+		{
+			const double DistSq = FVector::DistSquared(CellItem.Location, Origin);
+			if (DistSq > BestDistSq)
+			{
+				continue;
+			}
+
+			if (AActor* ItemActor = ResolveActiveItem(CellItem))
+			{
+				BestDistSq = DistSq;
+				BestActor = ItemActor;
+			}
+		}
+	};
+
+	for (int32 Ring = 0; Ring <= MaxRing; ++Ring)
+	{
+		// Every cell from this ring outwards is at least (Ring - 1) cells away from Origin.
+		if (Ring > 1 && FMath::Square(static_cast<double>(Ring - 1) * CellSize) >= BestDistSq)
+		{
+			break;
+		}
+
+		for (int32 OffsetY = -Ring; OffsetY <= Ring; ++OffsetY)
+		{
+			const bool bEdgeRow = FMath::Abs(OffsetY) == Ring;
+			const int32 StepX = (bEdgeRow || Ring == 0) ? 1 : 2 * Ring;
+			for (int32 OffsetX = -Ring; OffsetX <= Ring; OffsetX += StepX)
+			{
+				VisitCell(OriginCell.X + OffsetX, OriginCell.Y + OffsetY);
+			}
+		}
+	}
+
+	return BestActor;
+}
+
+void UMOWorldItemIndexSubsystem::GetAllItems(TArray<UMOItemComponent*>& OutItemComponents) const
+{
+	OutItemComponents.Reset(ItemsByComponent.Num());
+
+	for (const TPair<TObjectKey<UMOItemComponent>, FIndexedItem>& Pair : ItemsByComponent)
+	{
+		if (UMOItemComponent* ItemComponent = Pair.Value.ItemComponent.Get())
+		{
+			OutItemComponents.Add(ItemComponent);
+		}
+	}
+}
@@ -0,0 +1,265 @@
+#include "MOWorldItemPoolSubsystem.h"
+#include "MOFramework.h"
+
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Materials/MaterialInterface.h"
+
+#include "MOWorldItem.h"
+
+namespace
+{
+	TAutoConsoleVariable<int32> CVarMOWorldItemPoolSize(
+		TEXT("mo.WorldItems.PoolSize"),
+		64,
+		TEXT("Parked AMOWorldItem actors kept per class for reuse by drops. 0 disables pooling."),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int32> CVarMOWorldItemInstancing(
+		TEXT("mo.WorldItems.Instancing"),
+		1,
+		TEXT("Draw resting world items through shared instanced static meshes (1) or their own mesh components (0)."),
+		ECVF_Default);
+}
+
+void UMOWorldItemPoolSubsystem::Deinitialize()
+{
+	PooledByClass.Reset();
+	InstanceByItem.Reset();
+	InstanceBatches.Reset();
+
+	if (IsValid(InstanceHost))
+	{
+		InstanceHost->Destroy();
+	}
+	InstanceHost = nullptr;
+
+	Super::Deinitialize();
+}
+
+/*
+ * Actor pool
+ */
+
+AMOWorldItem* UMOWorldItemPoolSubsystem::AcquireWorldItem(TSubclassOf<AMOWorldItem> ItemClass, const FTransform& SpawnTransform, const FActorSpawnParameters& SpawnParams)
+{
+	UWorld* World = GetWorld();
+	if (!World || !ItemClass)
+	{
+		return nullptr;
+	}
+
+	if (TArray<TWeakObjectPtr<AMOWorldItem>>* Parked = PooledByClass.Find(ItemClass.Get()))
+	{
+		while (Parked->Num() > 0)
+		{
+			AMOWorldItem* Item = Parked->Pop(EAllowShrinking::No).Get();
+			if (!IsValid(Item) || Item->IsActorBeingDestroyed())
+			{
+				continue;
+			}
+
+			Item->SetOwner(SpawnParams.Owner);
+			Item->SetInstigator(SpawnParams.Instigator);
+			Item->ActivateFromPool(SpawnTransform);
+			return Item;
+		}
+	}
+
+	AMOWorldItem* Item = World->SpawnActor<AMOWorldItem>(ItemClass, SpawnTransform, SpawnParams);
+	if (IsValid(Item))
+	{
+		// Pooled actors get moved around after spawn, so clients need movement replication.
+		Item->bPooled = true;
+		Item->SetReplicateMovement(true);
+	}
+
+	return Item;
+}
+
+bool UMOWorldItemPoolSubsystem::ReleaseWorldItem(AMOWorldItem* Item)
+{
+	if (!IsValid(Item) || !Item->HasAuthority() || Item->IsActorBeingDestroyed())
+	{
+		return false;
+	}
+
+	if (Item->bParkedInPool)
+	{
+		return true;
+	}
+
+	TArray<TWeakObjectPtr<AMOWorldItem>>& Parked = PooledByClass.FindOrAdd(Item->GetClass());
+	Parked.RemoveAllSwap([](const TWeakObjectPtr<AMOWorldItem>& ParkedItem) { return !ParkedItem.IsValid(); }, EAllowShrinking::No);
+
+	if (Parked.Num() >= CVarMOWorldItemPoolSize.GetValueOnGameThread())
+	{
+		return false;
+	}
+
+	Item->ParkInPool();
+	Parked.Add(Item);
+	return true;
+}
+
+int32 UMOWorldItemPoolSubsystem::GetPooledItemCount() const
+{
+	int32 Count = 0;
+	for (const TPair<TObjectKey<UClass>, TArray<TWeakObjectPtr<AMOWorldItem>>>& Pair : PooledByClass)
+	{
+		Count += Pair.Value.Num();
+	}
+	return Count;
+}
+
+/*
+ * Instanced rendering
+ */
+
+bool UMOWorldItemPoolSubsystem::IsInstancingEnabled()
+{
+	return CVarMOWorldItemInstancing.GetValueOnGameThread() != 0;
+}
+
+void UMOWorldItemPoolSubsystem::AddRenderInstance(AMOWorldItem* Item)
+{
+	if (!IsValid(Item) || !IsValid(Item->GetItemMesh()))
+	{
+		return;
+	}
+
+	UStaticMeshComponent* ItemMesh = Item->GetItemMesh();
+	UStaticMesh* Mesh = ItemMesh->GetStaticMesh();
+	if (!IsValid(Mesh))
+	{
+		RemoveRenderInstance(Item);
+		return;
+	}
+
+	UMaterialInterface* Material = ItemMesh->GetMaterial(0);
+	const FInstanceBatchKey Key{ Mesh, Material };
+	const FTransform InstanceTransform = ItemMesh->GetComponentTransform();
+
+	if (FItemInstance* Existing = InstanceByItem.Find(Item))
+	{
+		if (Existing->Key == Key)
+		{
+			const FInstanceBatch* Batch = InstanceBatches.Find(Key);
+			if (UInstancedStaticMeshComponent* BatchComponent = Batch ? Batch->Component.Get() : nullptr)
+			{
+				BatchComponent->UpdateInstanceTransform(Existing->InstanceIndex, InstanceTransform, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
+				return;
+			}
+		}
+
+		// Mesh or material changed (or the batch went away): move to the right batch.
+		FreeInstance(*Existing);
+		InstanceByItem.Remove(Item);
+	}
+
+	FInstanceBatch* Batch = FindOrCreateBatch(Key, Mesh, Material);
+	UInstancedStaticMeshComponent* BatchComponent = Batch ? Batch->Component.Get() : nullptr;
+	if (!BatchComponent)
+	{
+		return;
+	}
+
+	int32 InstanceIndex = INDEX_NONE;
+	if (Batch->FreeInstances.Num() > 0)
+	{
+		InstanceIndex = Batch->FreeInstances.Pop(EAllowShrinking::No);
+		BatchComponent->UpdateInstanceTransform(InstanceIndex, InstanceTransform, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
+	}
+	else
+	{
+		InstanceIndex = BatchComponent->AddInstance(InstanceTransform, /*bWorldSpace*/ true);
+	}
+
+	FItemInstance& NewInstance = InstanceByItem.Add(Item);
+	NewInstance.Key = Key;
+	NewInstance.InstanceIndex = InstanceIndex;
+}
+
+void UMOWorldItemPoolSubsystem::RemoveRenderInstance(AMOWorldItem* Item)
+{
+	FItemInstance Instance;
+	if (InstanceByItem.RemoveAndCopyValue(Item, Instance))
+	{
+		FreeInstance(Instance);
+	}
+}
+
+UMOWorldItemPoolSubsystem::FInstanceBatch* UMOWorldItemPoolSubsystem::FindOrCreateBatch(const FInstanceBatchKey& Key, UStaticMesh* Mesh, UMaterialInterface* Material)
+{
+	if (FInstanceBatch* Existing = InstanceBatches.Find(Key))
+	{
+		if (Existing->Component.IsValid())
+		{
+			return Existing;
+		}
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return nullptr;
+	}
+
+	if (!IsValid(InstanceHost))
+	{
+		FActorSpawnParameters HostSpawnParams;
+		HostSpawnParams.Name = MakeUniqueObjectName(World->PersistentLevel, AActor::StaticClass(), TEXT("MOWorldItemInstances"));
+		HostSpawnParams.ObjectFlags |= RF_Transient;
+		HostSpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		InstanceHost = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, HostSpawnParams);
+		if (!IsValid(InstanceHost))
+		{
+			UE_LOG(LogMOFramework, Warning, TEXT("[MOWorldItemPool] Failed to spawn the instanced mesh host"));
+			return nullptr;
+		}
+
+		USceneComponent* HostRoot = NewObject<USceneComponent>(InstanceHost, TEXT("Root"));
+		InstanceHost->SetRootComponent(HostRoot);
+		HostRoot->RegisterComponent();
+	}
+
+	UInstancedStaticMeshComponent* BatchComponent = NewObject<UInstancedStaticMeshComponent>(InstanceHost);
+	BatchComponent->SetStaticMesh(Mesh);
+	if (Material)
+	{
+		BatchComponent->SetMaterial(0, Material);
+	}
+	// Interaction and physics stay on the item actors; the batch only draws.
+	BatchComponent->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	BatchComponent->SetupAttachment(InstanceHost->GetRootComponent());
+	BatchComponent->RegisterComponent();
+	InstanceHost->AddInstanceComponent(BatchComponent);
+
+	FInstanceBatch& Batch = InstanceBatches.FindOrAdd(Key);
+	Batch.Component = BatchComponent;
+	Batch.FreeInstances.Reset();
+
+	UE_LOG(LogMOFramework, Verbose, TEXT("[MOWorldItemPool] New instance batch for Mesh=%s Material=%s"),
+		*GetNameSafe(Mesh), *GetNameSafe(Material));
+
+	return &Batch;
+}
+
+void UMOWorldItemPoolSubsystem::FreeInstance(const FItemInstance& Instance)
+{
+	FInstanceBatch* Batch = InstanceBatches.Find(Instance.Key);
+	UInstancedStaticMeshComponent* BatchComponent = Batch ? Batch->Component.Get() : nullptr;
+	if (!BatchComponent || Instance.InstanceIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Slots are recycled instead of removed so other items' instance indices never shift; zero scale draws nothing.
+	const FTransform HiddenInstanceTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+	BatchComponent->UpdateInstanceTransform(Instance.InstanceIndex, HiddenInstanceTransform, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
+	Batch->FreeInstances.Add(Instance.InstanceIndex);
+}
@@ -3,11 +3,35 @@
 #include "MOKnowledgeComponent.h"
 #include "MOSurvivalStatsComponent.h"
 #include "MOCraftingSubsystem.h"
+#include "MOCraftabilityComponent.h"
+#include "MOCraftingQueueComponent.h"
+#include "MOCraftingSchedulerSubsystem.h"
+#include "MOSimulationClockSubsystem.h"
 #include "MOInventoryComponent.h"
+#include "MOItemComponent.h"
+#include "MOWorldItem.h"
+#include "MOWorldItemIndexSubsystem.h"
+#include "MOWorldItemPoolSubsystem.h"
+#include "MOIdentityComponent.h"
+#include "MOItemAssetStreamingSubsystem.h"
 #include "MOItemDatabaseSettings.h"
 #include "MOSkillDatabaseSettings.h"
 #include "MORecipeDatabaseSettings.h"
 #include "Engine/DataTable.h"
+#include "Engine/GameInstance.h"
+#include "Engine/Texture2D.h"
+#include "Engine/StaticMesh.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "UObject/CoreNet.h"
+#include "UObject/Package.h"
+#include "Tickable.h"
+#include "MOTestWorld.h"
+#include "MOTestInventoryEventRecorder.h"
+#include "MOTestRecipeEventRecorder.h"
+#include "Misc/ScopeExit.h"
+#include "TimerManager.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -73,6 +97,55 @@ namespace MOFrameworkTestData
 		Recipe.SkillXPReward = 10.0f;
 		return Recipe;
 	}
+
+	void AddTestIngredient(FMORecipeDefinitionRow& Recipe, FName ItemId, int32 Quantity)
+	{
+		FMORecipeIngredient& Ingredient = Recipe.Ingredients.AddDefaulted_GetRef();
+		Ingredient.ItemDefinitionId = ItemId;
+		Ingredient.Quantity = Quantity;
+	}
+
+	void AddTestOutput(FMORecipeDefinitionRow& Recipe, FName ItemId, int32 Quantity)
+	{
+		FMORecipeOutput& Output = Recipe.Outputs.AddDefaulted_GetRef();
+		Output.ItemDefinitionId = ItemId;
+		Output.Quantity = Quantity;
+	}
+
+	/**
+	 * Points the recipe database at a table of the given recipes for the current scope.
+	 * The configured table comes back, and the recipe index is rebuilt, when it ends.
+	 */
+	class FScopedTestRecipeTable
+	{
+	public:
+		explicit FScopedTestRecipeTable(std::initializer_list<const FMORecipeDefinitionRow*> Recipes)
+			: Settings(GetMutableDefault<UMORecipeDatabaseSettings>())
+			, PreviousTable(Settings->RecipeDefinitionsDataTable)
+		{
+			UDataTable* Table = NewObject<UDataTable>();
+			Table->RowStruct = FMORecipeDefinitionRow::StaticStruct();
+			for (const FMORecipeDefinitionRow* Recipe : Recipes)
+			{
+				Table->AddRow(Recipe->RecipeId, *Recipe);
+			}
+
+			Settings->RecipeDefinitionsDataTable = Table;
+			UMORecipeDatabaseSettings::ResetRecipeIndex();
+		}
+
+		~FScopedTestRecipeTable()
+		{
+			Settings->RecipeDefinitionsDataTable = PreviousTable;
+			UMORecipeDatabaseSettings::ResetRecipeIndex();
+		}
+
+		UE_NONCOPYABLE(FScopedTestRecipeTable);
+
+	private:
+		UMORecipeDatabaseSettings* Settings;
+		TSoftObjectPtr<UDataTable> PreviousTable;
+	};
 }
 
 //=============================================================================
@@ -333,6 +406,1419 @@ bool FMOSurvivalStats_ApplyNutrition_UpdatesStatus::RunTest(const FString& Param
 	return true;
 }
 
+//=============================================================================
+// Inventory Component Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_GuidIndex_TracksReplicatedEntries,
+	"MOFramework.Inventory.GuidIndex.TracksReplicatedEntries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_GuidIndex_TracksReplicatedEntries::RunTest(const FString& Parameters)
+{
+	// Unowned component behaves like a client: drive the fast array callbacks directly.
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>();
+	Inventory->Inventory.SetOwner(Inventory);
+
+	TArray<FGuid> Guids;
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		FMOInventoryEntry Entry;
+		Entry.ItemGuid = FGuid::NewGuid();
+		Entry.ItemDefinitionId = TEXT("Item_Test");
+		Entry.Quantity = Index + 1;
+		Inventory->Inventory.Entries.Add(Entry);
+		Guids.Add(Entry.ItemGuid);
+	}
+
+	TArray<int32> AddedIndices = { 0, 1, 2 };
+	Inventory->Inventory.PostReplicatedAdd(AddedIndices, 3);
+
+	FMOInventoryEntry Found;
+	TestTrue(TEXT("Finds third entry"), Inventory->TryGetEntryByGuid(Guids[2], Found));
+	TestEqual(TEXT("Third entry quantity"), Found.Quantity, 3);
+	TestFalse(TEXT("Unknown guid not found"), Inventory->TryGetEntryByGuid(FGuid::NewGuid(), Found));
+
+	// Replicated remove: the serializer swap-removes after PreReplicatedRemove.
+	TArray<int32> RemovedIndices = { 0 };
+	Inventory->Inventory.PreReplicatedRemove(RemovedIndices, 2);
+	Inventory->Inventory.Entries.RemoveAtSwap(0);
+
+	TestFalse(TEXT("Removed entry not found"), Inventory->TryGetEntryByGuid(Guids[0], Found));
+	TestTrue(TEXT("Moved entry still found"), Inventory->TryGetEntryByGuid(Guids[2], Found));
+	TestEqual(TEXT("Moved entry quantity"), Found.Quantity, 3);
+	TestTrue(TEXT("Untouched entry still found"), Inventory->TryGetEntryByGuid(Guids[1], Found));
+	TestEqual(TEXT("Untouched entry quantity"), Found.Quantity, 2);
+
+	// Slot reverse index builds from the replicated slot array.
+	Inventory->SlotItemGuids.SetNum(4);
+	Inventory->SlotItemGuids[3] = Guids[1];
+	TestEqual(TEXT("Slotted guid maps to its slot"), Inventory->FindSlotIndexByGuid(Guids[1]), 3);
+	TestEqual(TEXT("Unslotted guid has no slot"), Inventory->FindSlotIndexByGuid(Guids[2]), (int32)INDEX_NONE);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_QuantityTotals_TrackReplicatedEntries,
+	"MOFramework.Inventory.QuantityTotals.TrackReplicatedEntries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_QuantityTotals_TrackReplicatedEntries::RunTest(const FString& Parameters)
+{
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>();
+	const FName Wood = TEXT("Item_Wood");
+	const FName Stone = TEXT("Item_Stone");
+
+	const FName Definitions[] = { Wood, Wood, Stone };
+	const int32 Quantities[] = { 4, 6, 2 };
+	for (int32 Index = 0; Index < 3; ++Index)
+	{
+		FMOInventoryEntry Entry;
+		Entry.ItemGuid = FGuid::NewGuid();
+		Entry.ItemDefinitionId = Definitions[Index];
+		Entry.Quantity = Quantities[Index];
+		Inventory->Inventory.Entries.Add(Entry);
+	}
+
+	TArray<int32> AddedIndices = { 0, 1, 2 };
+	Inventory->Inventory.PostReplicatedAdd(AddedIndices, 3);
+	TestEqual(TEXT("Wood summed across stacks"), Inventory->GetTotalQuantityByDefinition(Wood), 10);
+	TestEqual(TEXT("Stone total"), Inventory->GetTotalQuantityByDefinition(Stone), 2);
+
+	// Quantity change arrives in place
+	Inventory->Inventory.Entries[1].Quantity = 1;
+	TArray<int32> ChangedIndices = { 1 };
+	Inventory->Inventory.PostReplicatedChange(ChangedIndices, 3);
+	TestEqual(TEXT("Wood after change"), Inventory->GetTotalQuantityByDefinition(Wood), 5);
+
+	// Removing the only stone stack drops the definition entirely
+	TArray<int32> RemovedIndices = { 2 };
+	Inventory->Inventory.PreReplicatedRemove(RemovedIndices, 2);
+	Inventory->Inventory.Entries.RemoveAtSwap(2);
+	TestEqual(TEXT("Stone gone"), Inventory->GetTotalQuantityByDefinition(Stone), 0);
+	TestFalse(TEXT("Stone key removed"), Inventory->GetQuantityTotals().Contains(Stone));
+	TestEqual(TEXT("Wood unaffected"), Inventory->GetTotalQuantityByDefinition(Wood), 5);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_QuantityTotals_ReportChangedDefinitions,
+	"MOFramework.Inventory.QuantityTotals.ReportChangedDefinitions",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_QuantityTotals_ReportChangedDefinitions::RunTest(const FString& Parameters)
+{
+	// No owner, so nothing consumes the pending changes but the test.
+	FMOInventoryList List;
+	const FName Wood = TEXT("Item_Wood");
+	const FName Stone = TEXT("Item_Stone");
+
+	const FName Definitions[] = { Wood, Stone };
+	for (const FName Definition : Definitions)
+	{
+		FMOInventoryEntry Entry;
+		Entry.ItemGuid = FGuid::NewGuid();
+		Entry.ItemDefinitionId = Definition;
+		Entry.Quantity = 3;
+		List.Entries.Add(Entry);
+	}
+
+	TArray<int32> AddedIndices = { 0, 1 };
+	List.PostReplicatedAdd(AddedIndices, 2);
+
+	TArray<FName> Changed;
+	List.ConsumeChangedDefinitions(Changed);
+	TestEqual(TEXT("Both added definitions reported"), Changed.Num(), 2);
+
+	List.ConsumeChangedDefinitions(Changed);
+	TestEqual(TEXT("Consuming clears the pending set"), Changed.Num(), 0);
+
+	// A slot move rewrites the entry but not its quantity
+	List.Entries[0].SlotIndex = 5;
+	TArray<int32> ChangedIndices = { 0 };
+	List.PostReplicatedChange(ChangedIndices, 2);
+	List.ConsumeChangedDefinitions(Changed);
+	TestEqual(TEXT("Slot-only change reports nothing"), Changed.Num(), 0);
+
+	List.Entries[1].Quantity = 1;
+	ChangedIndices = { 1 };
+	List.PostReplicatedChange(ChangedIndices, 2);
+	List.ConsumeChangedDefinitions(Changed);
+	TestTrue(TEXT("Quantity change reports only its definition"), Changed.Num() == 1 && Changed[0] == Stone);
+
+	List.ResetEntries();
+	List.ConsumeChangedDefinitions(Changed);
+	TestEqual(TEXT("Reset reports every held definition"), Changed.Num(), 2);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_SlotMap_FollowsReplicatedEntries,
+	"MOFramework.Inventory.SlotMap.FollowsReplicatedEntries",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_SlotMap_FollowsReplicatedEntries::RunTest(const FString& Parameters)
+{
+	// Client view: slots are rebuilt purely from the SlotIndex carried on each replicated entry.
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>();
+	Inventory->Inventory.SetOwner(Inventory);
+
+	FMOInventoryEntry EntryA;
+	EntryA.ItemGuid = FGuid::NewGuid();
+	EntryA.ItemDefinitionId = TEXT("Item_A");
+	EntryA.Quantity = 1;
+	EntryA.SlotIndex = 0;
+
+	FMOInventoryEntry EntryB = EntryA;
+	EntryB.ItemGuid = FGuid::NewGuid();
+	EntryB.SlotIndex = 3;
+
+	Inventory->Inventory.Entries.Add(EntryA);
+	Inventory->Inventory.Entries.Add(EntryB);
+	TArray<int32> AddedIndices = { 0, 1 };
+	Inventory->Inventory.PostReplicatedAdd(AddedIndices, 2);
+
+	FGuid SlotGuid;
+	TestTrue(TEXT("A placed in slot 0"), Inventory->TryGetSlotGuid(0, SlotGuid) && SlotGuid == EntryA.ItemGuid);
+	TestTrue(TEXT("B placed in slot 3"), Inventory->TryGetSlotGuid(3, SlotGuid) && SlotGuid == EntryB.ItemGuid);
+
+	// A swap arrives as two entry changes; apply B first to exercise the ordering guard.
+	Inventory->Inventory.Entries[0].SlotIndex = 3;
+	Inventory->Inventory.Entries[1].SlotIndex = 0;
+	TArray<int32> ChangedIndices = { 1, 0 };
+	Inventory->Inventory.PostReplicatedChange(ChangedIndices, 2);
+
+	TestTrue(TEXT("B swapped into slot 0"), Inventory->TryGetSlotGuid(0, SlotGuid) && SlotGuid == EntryB.ItemGuid);
+	TestTrue(TEXT("A swapped into slot 3"), Inventory->TryGetSlotGuid(3, SlotGuid) && SlotGuid == EntryA.ItemGuid);
+	TestEqual(TEXT("Reverse index follows A"), Inventory->FindSlotIndexByGuid(EntryA.ItemGuid), 3);
+
+	// Removing an entry empties its slot.
+	TArray<int32> RemovedIndices = { 1 };
+	Inventory->Inventory.PreReplicatedRemove(RemovedIndices, 1);
+	Inventory->Inventory.Entries.RemoveAtSwap(1);
+	TestFalse(TEXT("Slot 0 empty after B removed"), Inventory->TryGetSlotGuid(0, SlotGuid));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_SlotContents_OneBroadcastPerUpdate,
+	"MOFramework.Inventory.SlotContents.OneBroadcastPerUpdate",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_SlotContents_OneBroadcastPerUpdate::RunTest(const FString& Parameters)
+{
+	// Client view: drive the fast array callbacks the way one replication update does.
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>();
+	Inventory->Inventory.SetOwner(Inventory);
+
+	UMOTestInventoryEventRecorder* Events = NewObject<UMOTestInventoryEventRecorder>();
+	Inventory->OnSlotContentsChanged.AddDynamic(Events, &UMOTestInventoryEventRecorder::HandleSlotContentsChanged);
+
+	const FFastArraySerializer::FPostReplicatedReceiveParameters ReceiveParameters;
+
+	FMOInventoryEntry EntryA;
+	EntryA.ItemGuid = FGuid::NewGuid();
+	EntryA.ItemDefinitionId = TEXT("Item_A");
+	EntryA.Quantity = 1;
+	EntryA.SlotIndex = 0;
+
+	FMOInventoryEntry EntryB = EntryA;
+	EntryB.ItemGuid = FGuid::NewGuid();
+	EntryB.SlotIndex = 3;
+
+	Inventory->Inventory.Entries.Add(EntryA);
+	Inventory->Inventory.Entries.Add(EntryB);
+	TArray<int32> AddedIndices = { 0, 1 };
+	Inventory->Inventory.PostReplicatedAdd(AddedIndices, 2);
+	TestEqual(TEXT("Nothing broadcast mid-update"), Events->SlotBroadcasts.Num(), 0);
+
+	Inventory->Inventory.PostReplicatedReceive(ReceiveParameters);
+	TestEqual(TEXT("One broadcast for the adds"), Events->SlotBroadcasts.Num(), 1);
+	TestEqual(TEXT("Both added slots reported"), Events->SlotBroadcasts.Last(), TArray<int32>{ 0, 3 });
+
+	// Add, change and remove in one update still broadcast once
+	Events->Reset();
+	FMOInventoryEntry EntryC = EntryA;
+	EntryC.ItemGuid = FGuid::NewGuid();
+	EntryC.SlotIndex = 5;
+	Inventory->Inventory.Entries.Add(EntryC);
+	AddedIndices = { 2 };
+	Inventory->Inventory.PostReplicatedAdd(AddedIndices, 3);
+
+	Inventory->Inventory.Entries[0].Quantity = 4;
+	TArray<int32> ChangedIndices = { 0 };
+	Inventory->Inventory.PostReplicatedChange(ChangedIndices, 3);
+
+	TArray<int32> RemovedIndices = { 1 };
+	Inventory->Inventory.PreReplicatedRemove(RemovedIndices, 2);
+	Inventory->Inventory.Entries.RemoveAtSwap(1);
+	TestEqual(TEXT("Still nothing mid-update"), Events->SlotBroadcasts.Num(), 0);
+
+	Inventory->Inventory.PostReplicatedReceive(ReceiveParameters);
+	TestEqual(TEXT("One broadcast for the mixed update"), Events->SlotBroadcasts.Num(), 1);
+	TestEqual(TEXT("Changed, removed and added slots reported"), Events->SlotBroadcasts.Last(), TArray<int32>{ 0, 3, 5 });
+
+	// An update that touched nothing broadcasts nothing
+	Events->Reset();
+	Inventory->Inventory.PostReplicatedReceive(ReceiveParameters);
+	TestEqual(TEXT("Empty update is silent"), Events->SlotBroadcasts.Num(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_EntryNetSerialize_RoundTrips,
+	"MOFramework.Inventory.EntryNetSerialize.RoundTrips",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_EntryNetSerialize_RoundTrips::RunTest(const FString& Parameters)
+{
+	// The definition is not in any item table, so the receiver must keep the name and no handle.
+	FMOInventoryEntry Source;
+	Source.ItemGuid = FGuid::NewGuid();
+	Source.ItemDefinitionId = TEXT("Test_UnlistedItem");
+	Source.Quantity = 37;
+	Source.SlotIndex = INDEX_NONE;
+
+	bool bSuccess = false;
+	FNetBitWriter Writer(nullptr, 1024);
+	Source.NetSerialize(Writer, nullptr, bSuccess);
+	TestTrue(TEXT("Write succeeded"), bSuccess && !Writer.IsError());
+
+	FNetBitReader Reader(nullptr, Writer.GetData(), Writer.GetNumBits());
+	FMOInventoryEntry Received;
+	Received.NetSerialize(Reader, nullptr, bSuccess);
+	TestTrue(TEXT("Read succeeded"), bSuccess && !Reader.IsError());
+
+	TestEqual(TEXT("Guid"), Received.ItemGuid, Source.ItemGuid);
+	TestEqual(TEXT("Definition"), Received.ItemDefinitionId, Source.ItemDefinitionId);
+	TestEqual(TEXT("Quantity"), Received.Quantity, 37);
+	TestEqual(TEXT("Unslotted stays unslotted"), Received.SlotIndex, (int32)INDEX_NONE);
+	TestFalse(TEXT("Unlisted definition has no handle"), Received.DefinitionHandle.IsValid());
+
+	// Handle lookups reject what the table does not contain.
+	TestFalse(TEXT("No handle for unlisted ID"), UMOItemDatabaseSettings::GetItemDefinitionHandle(Source.ItemDefinitionId).IsValid());
+	TestNull(TEXT("Invalid handle resolves to nothing"), UMOItemDatabaseSettings::GetItemDefinitionByHandle(FMOItemDefinitionHandle()));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_Transaction_RollbackRestoresState,
+	"MOFramework.Inventory.Transaction.RollbackRestoresState",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_Transaction_RollbackRestoresState::RunTest(const FString& Parameters)
+{
+	// Mutations need authority, so host the component on an actor in a throwaway game world.
+	FMOTestWorld World(TEXT("MOInventoryTransactionTest"));
+
+	AActor* Owner = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Owner);
+	Inventory->RegisterComponent();
+
+	const FName Wood = TEXT("Item_Wood");
+	const FGuid First = FGuid::NewGuid();
+	const FGuid Second = FGuid::NewGuid();
+	Inventory->AddItemByGuid(First, Wood, 5);
+	Inventory->AddItemByGuid(Second, Wood, 3);
+
+	TestTrue(TEXT("Transaction opens"), Inventory->BeginTransaction());
+	TestTrue(TEXT("Remove whole first stack"), Inventory->RemoveItemByGuid(First, 5));
+	TestTrue(TEXT("Add during transaction"), Inventory->AddItemByGuid(FGuid::NewGuid(), Wood, 10));
+	TestEqual(TEXT("Changes visible inside transaction"), Inventory->GetTotalQuantityByDefinition(Wood), 13);
+	Inventory->RollbackTransaction();
+
+	TestFalse(TEXT("Transaction closed"), Inventory->IsInTransaction());
+	TestEqual(TEXT("Entry count restored"), Inventory->GetEntryCount(), 2);
+	TestEqual(TEXT("Totals restored"), Inventory->GetTotalQuantityByDefinition(Wood), 8);
+	TestEqual(TEXT("First stack back in its slot"), Inventory->FindSlotIndexByGuid(First), 0);
+	TestEqual(TEXT("Second stack slot unchanged"), Inventory->FindSlotIndexByGuid(Second), 1);
+
+	{
+		FMOInventoryTransactionScope Transaction(Inventory);
+		TestTrue(TEXT("Scope opened"), Transaction.IsOpen());
+		Inventory->RemoveItemByGuid(Second, 3);
+		Inventory->SwapSlots(0, 2);
+	}
+
+	TestFalse(TEXT("Scope committed"), Inventory->IsInTransaction());
+	TestEqual(TEXT("Committed removal"), Inventory->GetEntryCount(), 1);
+	TestEqual(TEXT("Committed swap"), Inventory->FindSlotIndexByGuid(First), 2);
+	TestEqual(TEXT("Removed stack unslotted"), Inventory->FindSlotIndexByGuid(Second), (int32)INDEX_NONE);
+
+	// A rollback in a nested scope ends the whole transaction; the outer scope must not commit on exit.
+	{
+		FMOInventoryTransactionScope Outer(Inventory);
+		Inventory->AddItemByGuid(FGuid::NewGuid(), Wood, 4);
+		{
+			FMOInventoryTransactionScope Inner(Inventory);
+			Inventory->RemoveItemByGuid(First, 5);
+			Inner.Rollback();
+		}
+		TestFalse(TEXT("Outer scope closed by nested rollback"), Outer.IsOpen());
+		TestFalse(TEXT("No transaction left open"), Inventory->IsInTransaction());
+	}
+
+	TestFalse(TEXT("Outer scope exit opened nothing"), Inventory->IsInTransaction());
+	TestEqual(TEXT("Nested rollback restored the outer snapshot"), Inventory->GetEntryCount(), 1);
+	TestEqual(TEXT("Nested rollback restored totals"), Inventory->GetTotalQuantityByDefinition(Wood), 5);
+
+	return true;
+}
+
+//=============================================================================
+// Inventory Stacking Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_Stacking_MergeSplitCompact,
+	"MOFramework.Inventory.Stacking.MergeSplitCompact",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_Stacking_MergeSplitCompact::RunTest(const FString& Parameters)
+{
+	FMOTestWorld World(TEXT("MOInventoryStackingTest"));
+
+	AActor* Owner = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Owner);
+	Inventory->FallbackMaxStackSize = 10;
+	Inventory->RegisterComponent();
+
+	// Unlisted ID, so the component's fallback stack limit applies.
+	const FName Arrow = TEXT("Test_Arrow");
+	const FGuid First = FGuid::NewGuid();
+	const FGuid Second = FGuid::NewGuid();
+	Inventory->AddItemByGuid(First, Arrow, 7);
+	Inventory->AddItemByGuid(Second, Arrow, 8);
+
+	FMOInventoryEntry Entry;
+	TestEqual(TEXT("Overflow opened one new stack"), Inventory->GetEntryCount(), 2);
+	TestTrue(TEXT("First stack topped up"), Inventory->TryGetEntryByGuid(First, Entry) && Entry.Quantity == 10);
+	TestTrue(TEXT("Remainder kept the caller's GUID"), Inventory->TryGetEntryByGuid(Second, Entry) && Entry.Quantity == 5);
+	TestFalse(TEXT("Full target takes nothing"), Inventory->MergeStacks(Second, First));
+
+	FGuid SplitGuid;
+	TestTrue(TEXT("Split succeeds"), Inventory->SplitStack(First, 4, INDEX_NONE, SplitGuid));
+	TestEqual(TEXT("Split placed in next empty slot"), Inventory->FindSlotIndexByGuid(SplitGuid), 2);
+	TestFalse(TEXT("Cannot split a whole stack"), Inventory->SplitStack(Second, 5, INDEX_NONE, SplitGuid));
+
+	// Slots 0/1/2 hold 6/5/4; compaction refills from slot 0 and drops the emptied stack.
+	TestEqual(TEXT("Compaction removes one entry"), Inventory->CompactStacks(), 1);
+	TestEqual(TEXT("Two stacks left"), Inventory->GetEntryCount(), 2);
+	TestTrue(TEXT("Lowest slot filled first"), Inventory->TryGetEntryByGuid(First, Entry) && Entry.Quantity == 10);
+	TestFalse(TEXT("Emptied stack removed"), Inventory->TryGetEntryByGuid(SplitGuid, Entry));
+	TestEqual(TEXT("Total preserved"), Inventory->GetTotalQuantityByDefinition(Arrow), 15);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOInventory_Stacking_StartingItemsSlotEveryStack,
+	"MOFramework.Inventory.Stacking.StartingItemsSlotEveryStack",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOInventory_Stacking_StartingItemsSlotEveryStack::RunTest(const FString& Parameters)
+{
+	FMOTestWorld World(TEXT("MOInventoryStartingItemsTest"));
+
+	// 25 arrows at a limit of 10 need three stacks; the requested slot gets the first.
+	const FName Arrow = TEXT("Test_Arrow");
+	FMOStartingInventoryItem Arrows;
+	Arrows.ItemDefinitionId = Arrow;
+	Arrows.Quantity = 25;
+	Arrows.SlotIndex = 4;
+
+	AActor* Owner = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Owner);
+	Inventory->FallbackMaxStackSize = 10;
+	Inventory->StartingItems.Add(Arrows);
+	Inventory->RegisterComponent();
+
+	TArray<FMOInventoryEntry> Entries;
+	Inventory->GetInventoryEntries(Entries);
+	TestEqual(TEXT("Starting quantity split into full stacks"), Entries.Num(), 3);
+	TestEqual(TEXT("Total preserved"), Inventory->GetTotalQuantityByDefinition(Arrow), 25);
+	for (const FMOInventoryEntry& Entry : Entries)
+	{
+		TestTrue(TEXT("Every stack is slotted"), Entry.SlotIndex != INDEX_NONE);
+		TestTrue(TEXT("Stack within limit"), Entry.Quantity <= 10);
+	}
+	FGuid SlotGuid;
+	TestTrue(TEXT("Requested slot holds a stack"), Inventory->TryGetSlotGuid(4, SlotGuid) && SlotGuid.IsValid());
+
+	// A limit of 1 means the item does not stack: the whole quantity stays in one entry.
+	AActor* UnstackedOwner = World.SpawnHost();
+	UMOInventoryComponent* Unstacked = NewObject<UMOInventoryComponent>(UnstackedOwner);
+	Unstacked->RegisterComponent();
+
+	const FGuid Rope = FGuid::NewGuid();
+	Unstacked->AddItemByGuid(Rope, TEXT("Test_Rope"), 500);
+	FMOInventoryEntry Entry;
+	TestEqual(TEXT("Unstackable add makes one entry"), Unstacked->GetEntryCount(), 1);
+	TestTrue(TEXT("Entry keeps the whole quantity"), Unstacked->TryGetEntryByGuid(Rope, Entry) && Entry.Quantity == 500);
+
+	// Stacks never outnumber the empty slots; the last one keeps the overflow.
+	AActor* SmallOwner = World.SpawnHost();
+	UMOInventoryComponent* Small = NewObject<UMOInventoryComponent>(SmallOwner);
+	Small->SlotCount = 2;
+	Small->FallbackMaxStackSize = 10;
+	Small->RegisterComponent();
+
+	Small->AddItemByGuid(FGuid::NewGuid(), Arrow, 1000);
+	TestEqual(TEXT("One stack per empty slot"), Small->GetEntryCount(), 2);
+	TestEqual(TEXT("Overflow kept"), Small->GetTotalQuantityByDefinition(Arrow), 1000);
+
+	return true;
+}
+
+//=============================================================================
+// World Item Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOWorldItemIndex_Queries_FollowItems,
+	"MOFramework.WorldItems.Index.QueriesFollowItems",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOWorldItemIndex_Queries_FollowItems::RunTest(const FString& Parameters)
+{
+	FMOTestWorld World(TEXT("MOWorldItemIndexTest"));
+
+	auto SpawnItem = [&World](FName ItemDefinitionId, const FVector& Location)
+	{
+		AMOWorldItem* Item = World->SpawnActorDeferred<AMOWorldItem>(AMOWorldItem::StaticClass(), FTransform(Location));
+		Item->GetItemComponent()->ItemDefinitionId = ItemDefinitionId;
+		Item->FinishSpawning(FTransform(Location));
+		return Item;
+	};
+
+	const FName Wood = TEXT("Test_Wood");
+	const FName Stone = TEXT("Test_Stone");
+	AMOWorldItem* NearWood = SpawnItem(Wood, FVector(0.0f, 0.0f, 0.0f));
+	AMOWorldItem* FarWood = SpawnItem(Wood, FVector(5000.0f, 0.0f, 0.0f));
+	AMOWorldItem* NearStone = SpawnItem(Stone, FVector(100.0f, 0.0f, 0.0f));
+
+	UMOWorldItemIndexSubsystem* ItemIndex = World->GetSubsystem<UMOWorldItemIndexSubsystem>();
+	TestNotNull(TEXT("Index exists"), ItemIndex);
+	TestEqual(TEXT("All spawned items indexed"), ItemIndex->GetIndexedItemCount(), 3);
+
+	TArray<AActor*> Found;
+	ItemIndex->FindItemsInRadius(FVector::ZeroVector, 500.0f, NAME_None, Found);
+	TestEqual(TEXT("Any-definition radius query"), Found.Num(), 2);
+
+	ItemIndex->FindItemsInRadius(FVector::ZeroVector, 500.0f, Stone, Found);
+	TestTrue(TEXT("Typed radius query"), Found.Num() == 1 && Found[0] == NearStone);
+
+	TestEqual(TEXT("Nearest wood from the far side"), ItemIndex->FindNearestItem(FVector(4000.0f, 0.0f, 0.0f), Wood), (AActor*)FarWood);
+	TestNull(TEXT("Max radius respected"), ItemIndex->FindNearestItem(FVector(2500.0f, 0.0f, 0.0f), Wood, 1000.0f));
+
+	// Picked-up items drop out of queries; destroyed ones leave the index.
+	NearStone->GetItemComponent()->SetWorldItemActive(false);
+	ItemIndex->FindItemsInRadius(FVector::ZeroVector, 500.0f, NAME_None, Found);
+	TestTrue(TEXT("Inactive item skipped"), Found.Num() == 1 && Found[0] == NearWood);
+
+	FarWood->Destroy();
+	TestEqual(TEXT("Destroyed item unregistered"), ItemIndex->GetIndexedItemCount(), 2);
+	TestEqual(TEXT("Nearest falls back to remaining wood"), ItemIndex->FindNearestItem(FVector(4000.0f, 0.0f, 0.0f), Wood), (AActor*)NearWood);
+
+	// Moving an item re-files it under its new cell.
+	NearWood->SetActorLocation(FVector(20000.0f, 0.0f, 0.0f));
+	NearWood->GetItemComponent()->RefreshWorldItemIndex();
+	TestEqual(TEXT("Moved item found at new location"), ItemIndex->FindNearestItem(FVector(19000.0f, 0.0f, 0.0f), Wood, 2000.0f), (AActor*)NearWood);
+
+	// Definitions with no indexed items miss without scanning; a layer empties when its last item leaves.
+	TestNull(TEXT("Unknown definition misses"), ItemIndex->FindNearestItem(FVector::ZeroVector, TEXT("Test_Missing")));
+	NearStone->Destroy();
+	TestNull(TEXT("Emptied definition misses"), ItemIndex->FindNearestItem(FVector::ZeroVector, Stone));
+	TestEqual(TEXT("Any-definition layer keeps the rest"), ItemIndex->FindNearestItem(FVector::ZeroVector, NAME_None), (AActor*)NearWood);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOWorldItemPool_ReuseAndInstancing,
+	"MOFramework.WorldItems.Pool.ReuseAndInstancing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOWorldItemPool_ReuseAndInstancing::RunTest(const FString& Parameters)
+{
+	FMOTestWorld World(TEXT("MOWorldItemPoolTest"));
+
+	UMOWorldItemPoolSubsystem* Pool = World->GetSubsystem<UMOWorldItemPoolSubsystem>();
+	UMOWorldItemIndexSubsystem* ItemIndex = World->GetSubsystem<UMOWorldItemIndexSubsystem>();
+	TestNotNull(TEXT("Pool exists"), Pool);
+
+	AMOWorldItem* Item = Pool->AcquireWorldItem(AMOWorldItem::StaticClass(), FTransform(FVector(100.0f, 0.0f, 0.0f)), FActorSpawnParameters());
+	TestTrue(TEXT("Acquired item is pooled"), IsValid(Item) && Item->IsPooled());
+	TestEqual(TEXT("Acquired item indexed"), ItemIndex->GetIndexedItemCount(), 1);
+
+	// A resting item with a mesh draws through the shared instanced mesh.
+	UStaticMesh* Cube = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+	if (Cube && UMOWorldItemPoolSubsystem::IsInstancingEnabled())
+	{
+		Item->GetItemMesh()->SetStaticMesh(Cube);
+		Item->RefreshRenderInstance();
+		TestTrue(TEXT("Resting item instanced"), Pool->IsRenderInstanced(Item));
+		TestFalse(TEXT("Instanced item hides its own mesh"), Item->GetItemMesh()->IsVisible());
+
+		Item->EnableDropPhysics();
+		TestFalse(TEXT("Physics item not instanced"), Pool->IsRenderInstanced(Item));
+		TestTrue(TEXT("Physics item draws its own mesh"), Item->GetItemMesh()->IsVisible());
+	}
+
+	Item->GetIdentityComponent()->SetGuid(FGuid::NewGuid());
+	TestTrue(TEXT("Release parks the item"), Pool->ReleaseWorldItem(Item));
+	TestEqual(TEXT("Parked item counted"), Pool->GetPooledItemCount(), 1);
+	TestEqual(TEXT("Parked item left the index"), ItemIndex->GetIndexedItemCount(), 0);
+	TestFalse(TEXT("Parked item gave up its GUID"), Item->GetIdentityComponent()->HasValidGuid());
+	TestFalse(TEXT("Parked item inactive"), Item->GetItemComponent()->IsWorldItemActive());
+	TestFalse(TEXT("Parked item not instanced"), Pool->IsRenderInstanced(Item));
+
+	AMOWorldItem* Reused = Pool->AcquireWorldItem(AMOWorldItem::StaticClass(), FTransform(FVector(5000.0f, 0.0f, 0.0f)), FActorSpawnParameters());
+	TestEqual(TEXT("Acquire reuses the parked actor"), Reused, Item);
+	TestEqual(TEXT("Pool emptied"), Pool->GetPooledItemCount(), 0);
+	TestTrue(TEXT("Reused item active"), Reused->GetItemComponent()->IsWorldItemActive());
+	TestEqual(TEXT("Reused item found at its new location"), ItemIndex->FindNearestItem(FVector(5000.0f, 0.0f, 0.0f), NAME_None, 500.0f), (AActor*)Reused);
+
+	return true;
+}
+
+//=============================================================================
+// Item Asset Streaming Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOItemAssetStreaming_RequestAsset_BatchesPerFrame,
+	"MOFramework.Streaming.RequestAsset.BatchesPerFrame",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOItemAssetStreaming_RequestAsset_BatchesPerFrame::RunTest(const FString& Parameters)
+{
+	UGameInstance* GameInstance = NewObject<UGameInstance>(GEngine);
+	UMOItemAssetStreamingSubsystem* Streaming = NewObject<UMOItemAssetStreamingSubsystem>(GameInstance);
+
+	// Anything already in memory comes straight back without a batch.
+	UTexture2D* ResidentTexture = NewObject<UTexture2D>(GetTransientPackage(), MakeUniqueObjectName(GetTransientPackage(), UTexture2D::StaticClass(), TEXT("MOStreamingResident")));
+	TestEqual(TEXT("Resident asset returned"), Streaming->RequestAsset(FSoftObjectPath(ResidentTexture)), (UObject*)ResidentTexture);
+	TestEqual(TEXT("Resident hit counted"), Streaming->GetStreamingStats().ResidentHits, 1);
+	TestEqual(TEXT("No batch for a resident asset"), Streaming->GetStreamingStats().BatchesIssued, 0);
+
+	// A path whose object does not exist yet; it is created below, standing in for the loader.
+	UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Temp/MOStreamingTest_%s"), *FGuid::NewGuid().ToString()));
+	const FName AssetName = TEXT("StreamedTexture");
+	const FSoftObjectPath StreamedPath(FString::Printf(TEXT("%s.%s"), *Package->GetName(), *AssetName.ToString()));
+
+	// Shared so a batch that outlives a failed test does not write to the stack.
+	TSharedRef<int32> CallbacksRun = MakeShared<int32>(0);
+	TestNull(TEXT("First request waits"), Streaming->RequestAsset(StreamedPath, FSimpleDelegate::CreateLambda([CallbacksRun]() { ++*CallbacksRun; })));
+	TestNull(TEXT("Second request waits"), Streaming->RequestAsset(StreamedPath, FSimpleDelegate::CreateLambda([CallbacksRun]() { ++*CallbacksRun; })));
+
+	Streaming->FlushPendingRequests();
+	TestEqual(TEXT("One batch for the frame"), Streaming->GetStreamingStats().BatchesIssued, 1);
+	TestEqual(TEXT("Same path requested once"), Streaming->GetStreamingStats().AsyncRequestedAssets, 1);
+
+	NewObject<UTexture2D>(Package, AssetName);
+	for (int32 Pump = 0; Pump < 100 && Streaming->GetStreamingStats().BatchesCompleted == 0; ++Pump)
+	{
+		// Streamable completion delegates may be deferred to a tickable, so pump both.
+		FlushAsyncLoading();
+		FTickableGameObject::TickObjects(nullptr, LEVELTICK_All, false, 0.0f);
+	}
+
+	TestEqual(TEXT("Batch completed"), Streaming->GetStreamingStats().BatchesCompleted, 1);
+	TestEqual(TEXT("Both callbacks ran"), *CallbacksRun, 2);
+	TestNotNull(TEXT("Now resident"), Streaming->RequestAsset(StreamedPath));
+
+	return true;
+}
+
+//=============================================================================
+// Recipe Index Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMORecipeIndex_Build_BucketsRecipes,
+	"MOFramework.Crafting.RecipeIndex.BucketsRecipes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMORecipeIndex_Build_BucketsRecipes::RunTest(const FString& Parameters)
+{
+	UDataTable* RecipeTable = NewObject<UDataTable>();
+	RecipeTable->RowStruct = FMORecipeDefinitionRow::StaticStruct();
+
+	FMORecipeDefinitionRow Bandage = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_bandage"), TEXT("Bandage"));
+	FMORecipeDefinitionRow Stew = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_stew"), TEXT("Stew"));
+	Stew.RequiredStation = EMOCraftingStation::Campfire;
+	Stew.RequiredSkillId = TEXT("Cooking");
+	Stew.RequiredKnowledge = { TEXT("Knowledge_Stew") };
+	FMORecipeDefinitionRow Sword = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_sword"), TEXT("Sword"));
+	Sword.RequiredStation = EMOCraftingStation::Forge;
+	FMORecipeDefinitionRow Splint = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_splint"), TEXT("Splint"));
+	Splint.RequiredKnowledge = { TEXT("Knowledge_Stew"), TEXT("Knowledge_Splint") };
+
+	FMORecipeIngredient Cloth;
+	Cloth.ItemDefinitionId = TEXT("Item_Cloth");
+	Cloth.Quantity = 2;
+	Bandage.Ingredients.Add(Cloth);
+	Splint.Ingredients.Add(Cloth);
+	Splint.Ingredients.Add(Cloth);
+
+	RecipeTable->AddRow(Bandage.RecipeId, Bandage);
+	RecipeTable->AddRow(Stew.RecipeId, Stew);
+	RecipeTable->AddRow(Sword.RecipeId, Sword);
+	RecipeTable->AddRow(Splint.RecipeId, Splint);
+
+	FMORecipeIndex Index;
+	Index.Build(*RecipeTable);
+	TestEqual(TEXT("All recipes indexed"), Index.Rows.Num(), 4);
+
+	auto IdsOf = [&Index](const TArray<int32>& Positions)
+	{
+		TArray<FName> Ids;
+		for (const int32 Position : Positions)
+		{
+			Ids.Add(Index.Ids[Position]);
+		}
+		return Ids;
+	};
+
+	TArray<int32> Positions;
+	Index.GetStationPositions(EMOCraftingStation::Campfire, Positions);
+	TestEqual(TEXT("Campfire offers hand recipes plus its own, in table order"), IdsOf(Positions),
+		TArray<FName>{ TEXT("recipe_bandage"), TEXT("recipe_stew"), TEXT("recipe_splint") });
+
+	Index.GetStationPositions(EMOCraftingStation::None, Positions);
+	TestEqual(TEXT("Hand crafting offers only hand recipes"), Positions.Num(), 2);
+
+	const TArray<int32>* CookingRecipes = Index.BySkill.Find(TEXT("Cooking"));
+	TestTrue(TEXT("Skill bucket"), CookingRecipes && IdsOf(*CookingRecipes) == TArray<FName>{ TEXT("recipe_stew") });
+
+	const TArray<int32>* StewUnlocks = Index.ByKnowledge.Find(TEXT("Knowledge_Stew"));
+	TestTrue(TEXT("Knowledge unlock bucket"), StewUnlocks && StewUnlocks->Num() == 2);
+
+	const TArray<int32>* ClothConsumers = Index.ByIngredient.Find(TEXT("Item_Cloth"));
+	TestTrue(TEXT("Ingredient bucket lists each consuming recipe once"), ClothConsumers
+		&& IdsOf(*ClothConsumers) == TArray<FName>{ TEXT("recipe_bandage"), TEXT("recipe_splint") });
+
+	const int32* SwordPosition = Index.PositionById.Find(TEXT("recipe_sword"));
+	TestTrue(TEXT("Row pointer lookup"), SwordPosition && Index.Rows[*SwordPosition]->RequiredStation == EMOCraftingStation::Forge);
+
+	return true;
+}
+
+//=============================================================================
+// Craftability Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftability_Deltas_FlipOnlyAffectedRecipes,
+	"MOFramework.Crafting.Craftability.DeltasFlipAffectedRecipes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftability_Deltas_FlipOnlyAffectedRecipes::RunTest(const FString& Parameters)
+{
+	const FName Cloth = TEXT("Item_Cloth");
+	const FName Meat = TEXT("Item_Meat");
+	const FName Cooking = TEXT("Cooking");
+	const FName BandageId = TEXT("recipe_bandage");
+	const FName StewId = TEXT("recipe_stew");
+	const FName SplintId = TEXT("recipe_splint");
+
+	auto AddIngredient = [](FMORecipeDefinitionRow& Recipe, FName ItemId, int32 Quantity)
+	{
+		FMORecipeIngredient& Ingredient = Recipe.Ingredients.AddDefaulted_GetRef();
+		Ingredient.ItemDefinitionId = ItemId;
+		Ingredient.Quantity = Quantity;
+	};
+
+	FMORecipeDefinitionRow Bandage = MOFrameworkTestData::MakeTestRecipe(BandageId, TEXT("Bandage"));
+	AddIngredient(Bandage, Cloth, 2);
+	FMORecipeDefinitionRow Stew = MOFrameworkTestData::MakeTestRecipe(StewId, TEXT("Stew"));
+	Stew.RequiredStation = EMOCraftingStation::Campfire;
+	Stew.RequiredSkillId = Cooking;
+	Stew.RequiredSkillLevel = 3;
+	AddIngredient(Stew, Meat, 1);
+	FMORecipeDefinitionRow Splint = MOFrameworkTestData::MakeTestRecipe(SplintId, TEXT("Splint"));
+	Splint.RequiredKnowledge = { TEXT("Knowledge_Splint") };
+	AddIngredient(Splint, Cloth, 1);
+
+	UDataTable* RecipeTable = NewObject<UDataTable>();
+	RecipeTable->RowStruct = FMORecipeDefinitionRow::StaticStruct();
+	RecipeTable->AddRow(BandageId, Bandage);
+	RecipeTable->AddRow(StewId, Stew);
+	RecipeTable->AddRow(SplintId, Splint);
+
+	// Point the shared recipe index at the test table; the scope exit drops it again after the guard restores the setting.
+	ON_SCOPE_EXIT { UMORecipeDatabaseSettings::ResetRecipeIndex(); };
+	UMORecipeDatabaseSettings* Settings = GetMutableDefault<UMORecipeDatabaseSettings>();
+	TGuardValue<TSoftObjectPtr<UDataTable>> UseTestTable(Settings->RecipeDefinitionsDataTable, TSoftObjectPtr<UDataTable>(RecipeTable));
+	UMORecipeDatabaseSettings::ResetRecipeIndex();
+
+	FMOTestWorld World(TEXT("MOCraftabilityTest"));
+
+	AActor* Crafter = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Crafter);
+	Inventory->RegisterComponent();
+	UMOSkillsComponent* Skills = NewObject<UMOSkillsComponent>(Crafter);
+	Skills->RegisterComponent();
+	UMOKnowledgeComponent* Knowledge = NewObject<UMOKnowledgeComponent>(Crafter);
+	Knowledge->RegisterComponent();
+
+	// Registered last so BeginPlay finds the owner's other components.
+	UMOCraftabilityComponent* Craftability = NewObject<UMOCraftabilityComponent>(Crafter);
+	Craftability->RegisterComponent();
+
+	UMOTestRecipeEventRecorder* Events = NewObject<UMOTestRecipeEventRecorder>();
+	Craftability->OnRecipeBecameCraftable.AddDynamic(Events, &UMOTestRecipeEventRecorder::HandleBecameCraftable);
+	Craftability->OnRecipeNoLongerCraftable.AddDynamic(Events, &UMOTestRecipeEventRecorder::HandleNoLongerCraftable);
+
+	TestEqual(TEXT("Nothing craftable with empty hands"), Craftability->GetCraftableRecipeCount(), 0);
+
+	// Inventory delta
+	const FGuid ClothGuid = FGuid::NewGuid();
+	Inventory->AddItemByGuid(ClothGuid, Cloth, 2);
+	TestTrue(TEXT("Cloth makes bandage craftable"), Craftability->IsRecipeCraftable(BandageId));
+	TestEqual(TEXT("Bandage gained"), Events->Gained, TArray<FName>{ BandageId });
+	TestFalse(TEXT("Splint still needs knowledge"), Craftability->IsRecipeCraftable(SplintId));
+
+	Events->Reset();
+	Inventory->RemoveItemByGuid(ClothGuid, 1);
+	TestFalse(TEXT("One cloth is short"), Craftability->IsRecipeCraftable(BandageId));
+	TestEqual(TEXT("Bandage lost"), Events->Lost, TArray<FName>{ BandageId });
+	TestEqual(TEXT("No gain on removal"), Events->Gained.Num(), 0);
+
+	Events->Reset();
+	Inventory->AddItemByGuid(FGuid::NewGuid(), Cloth, 1);
+	TestEqual(TEXT("Bandage regained"), Events->Gained, TArray<FName>{ BandageId });
+
+	// GrantKnowledge
+	Events->Reset();
+	Knowledge->GrantKnowledge(TEXT("Knowledge_Splint"));
+	TestTrue(TEXT("Knowledge unlocks splint"), Craftability->IsRecipeCraftable(SplintId));
+	TestEqual(TEXT("Splint gained"), Events->Gained, TArray<FName>{ SplintId });
+
+	// Off-station recipes stay untracked whatever their inputs do
+	Events->Reset();
+	Inventory->AddItemByGuid(FGuid::NewGuid(), Meat, 1);
+	Skills->SetSkillLevel(Cooking, 3);
+	TestFalse(TEXT("Stew needs the campfire"), Craftability->IsRecipeCraftable(StewId));
+	TestEqual(TEXT("No events for off-station recipes"), Events->Gained.Num() + Events->Lost.Num(), 0);
+
+	// SetStation
+	Craftability->SetStation(EMOCraftingStation::Campfire);
+	TestTrue(TEXT("Stew craftable at the campfire"), Craftability->IsRecipeCraftable(StewId));
+	TestEqual(TEXT("Stew gained"), Events->Gained, TArray<FName>{ StewId });
+	TestEqual(TEXT("Hand recipes unchanged"), Events->Lost.Num(), 0);
+
+	Events->Reset();
+	Craftability->SetStation(EMOCraftingStation::None);
+	TestEqual(TEXT("Stew lost away from the campfire"), Events->Lost, TArray<FName>{ StewId });
+	Craftability->SetStation(EMOCraftingStation::Campfire);
+
+	// SetSkillLevel
+	Events->Reset();
+	Skills->SetSkillLevel(Cooking, 1);
+	TestFalse(TEXT("Stew needs cooking 3"), Craftability->IsRecipeCraftable(StewId));
+	TestEqual(TEXT("Stew lost to skill"), Events->Lost, TArray<FName>{ StewId });
+
+	Events->Reset();
+	Skills->SetSkillLevel(Cooking, 3);
+	TestEqual(TEXT("Stew regained with skill"), Events->Gained, TArray<FName>{ StewId });
+	TestEqual(TEXT("All three craftable"), Craftability->GetCraftableRecipeCount(), 3);
+
+	// Recipe index reset: bits drop at once, the rebuild next tick reports only real changes
+	Events->Reset();
+	Bandage.Ingredients[0].Quantity = 3;
+	RecipeTable->RemoveRow(BandageId);
+	RecipeTable->AddRow(BandageId, Bandage);
+	UMORecipeDatabaseSettings::ResetRecipeIndex();
+
+	TestEqual(TEXT("Bits cleared with the index"), Craftability->GetCraftableRecipeCount(), 0);
+	TestEqual(TEXT("No events before the rebuild"), Events->Gained.Num() + Events->Lost.Num(), 0);
+
+	World->GetTimerManager().Tick(0.1f);
+	TestFalse(TEXT("Bandage now needs three cloth"), Craftability->IsRecipeCraftable(BandageId));
+	TestEqual(TEXT("Only bandage lost"), Events->Lost, TArray<FName>{ BandageId });
+	TestEqual(TEXT("Nothing re-announced"), Events->Gained.Num(), 0);
+	TestEqual(TEXT("Stew and splint still craftable"), Craftability->GetCraftableRecipeCount(), 2);
+
+	return true;
+}
+
+//=============================================================================
+// Crafting Planner Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingPlanner_BuildPlan_ExpandsSubRecipes,
+	"MOFramework.Crafting.Planner.ExpandsSubRecipes",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingPlanner_BuildPlan_ExpandsSubRecipes::RunTest(const FString& Parameters)
+{
+	auto AddIngredient = [](FMORecipeDefinitionRow& Recipe, const TCHAR* ItemId, int32 Quantity)
+	{
+		FMORecipeIngredient& Ingredient = Recipe.Ingredients.AddDefaulted_GetRef();
+		Ingredient.ItemDefinitionId = ItemId;
+		Ingredient.Quantity = Quantity;
+	};
+	auto AddOutput = [](FMORecipeDefinitionRow& Recipe, const TCHAR* ItemId, int32 Quantity)
+	{
+		FMORecipeOutput& Output = Recipe.Outputs.AddDefaulted_GetRef();
+		Output.ItemDefinitionId = ItemId;
+		Output.Quantity = Quantity;
+	};
+
+	FMORecipeDefinitionRow Ingot = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_ingot"), TEXT("Ingot"));
+	AddIngredient(Ingot, TEXT("Item_Ore"), 2);
+	AddOutput(Ingot, TEXT("Item_Ingot"), 1);
+	// Listed first, so it makes handles once the crafter knows it
+	FMORecipeDefinitionRow CarvedHandle = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_handle_carved"), TEXT("Carved Handle"));
+	CarvedHandle.RequiredKnowledge.Add(TEXT("Knowledge_Carving"));
+	AddIngredient(CarvedHandle, TEXT("Item_Wood"), 1);
+	AddOutput(CarvedHandle, TEXT("Item_Handle"), 4);
+	FMORecipeDefinitionRow Handle = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_handle"), TEXT("Handle"));
+	AddIngredient(Handle, TEXT("Item_Wood"), 1);
+	AddOutput(Handle, TEXT("Item_Handle"), 2);
+	FMORecipeDefinitionRow Tool = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_tool"), TEXT("Tool"));
+	AddIngredient(Tool, TEXT("Item_Ingot"), 1);
+	AddIngredient(Tool, TEXT("Item_Handle"), 1);
+	AddOutput(Tool, TEXT("Item_Tool"), 1);
+
+	// A -> B -> A loop
+	FMORecipeDefinitionRow LoopA = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_loop_a"), TEXT("Loop A"));
+	AddIngredient(LoopA, TEXT("Item_B"), 1);
+	AddOutput(LoopA, TEXT("Item_A"), 1);
+	FMORecipeDefinitionRow LoopB = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_loop_b"), TEXT("Loop B"));
+	AddIngredient(LoopB, TEXT("Item_A"), 1);
+	AddOutput(LoopB, TEXT("Item_B"), 1);
+
+	UDataTable* RecipeTable = NewObject<UDataTable>();
+	RecipeTable->RowStruct = FMORecipeDefinitionRow::StaticStruct();
+	for (const FMORecipeDefinitionRow* Recipe : { &Ingot, &CarvedHandle, &Handle, &Tool, &LoopA, &LoopB })
+	{
+		RecipeTable->AddRow(Recipe->RecipeId, *Recipe);
+	}
+
+	FMORecipeIndex Index;
+	Index.Build(*RecipeTable);
+
+	TMap<FName, int32> Held;
+	Held.Add(TEXT("Item_Ore"), 6);
+	Held.Add(TEXT("Item_Ingot"), 1);
+	Held.Add(TEXT("Item_Wood"), 5);
+	auto GetHeld = [&Held](FName ItemId) { return Held.FindRef(ItemId); };
+
+	TSet<FName> Known;
+	auto CanUse = [&Known](const FMORecipeDefinitionRow& Recipe)
+	{
+		for (const FName& KnowledgeId : Recipe.RequiredKnowledge)
+		{
+			if (!Known.Contains(KnowledgeId))
+			{
+				return false;
+			}
+		}
+		return true;
+	};
+	auto CountCrafts = [](const FMOCraftingPlan& InPlan, const TCHAR* RecipeId)
+	{
+		int32 Count = 0;
+		for (const FMOCraftingPlanStep& Step : InPlan.Steps)
+		{
+			Count += Step.RecipeId == RecipeId ? Step.Count : 0;
+		}
+		return Count;
+	};
+
+	FMOCraftingPlanner Planner;
+	FMOCraftingPlan Plan;
+	Planner.BuildPlan(Index, TEXT("Item_Tool"), 4, EMOCraftingStation::None, CanUse, GetHeld, Plan);
+
+	TestTrue(TEXT("Plan complete"), Plan.bSuccess);
+	TestEqual(TEXT("One batch per recipe"), Plan.Steps.Num(), 3);
+	if (Plan.Steps.Num() == 3)
+	{
+		TestEqual(TEXT("Finished tool is crafted last"), Plan.Steps.Last().RecipeId, FName(TEXT("recipe_tool")));
+		TestEqual(TEXT("Tool batch"), Plan.Steps.Last().Count, 4);
+	}
+
+	int32 IngotCrafts = 0;
+	int32 HandleCrafts = 0;
+	for (const FMOCraftingPlanStep& Step : Plan.Steps)
+	{
+		IngotCrafts += Step.RecipeId == TEXT("recipe_ingot") ? Step.Count : 0;
+		HandleCrafts += Step.RecipeId == TEXT("recipe_handle") ? Step.Count : 0;
+	}
+	TestEqual(TEXT("Held ingot netted out"), IngotCrafts, 3);
+	TestEqual(TEXT("Handles come two per craft"), HandleCrafts, 2);
+	TestEqual(TEXT("Ore drawn from inventory"), Plan.ConsumedFromInventory.FindRef(TEXT("Item_Ore")), 6);
+	TestEqual(TEXT("Held ingot drawn from inventory"), Plan.ConsumedFromInventory.FindRef(TEXT("Item_Ingot")), 1);
+
+	// Same target again hits the memoized expansion; only the quantities change
+	Held.Add(TEXT("Item_Ore"), 4);
+	Planner.BuildPlan(Index, TEXT("Item_Tool"), 4, EMOCraftingStation::None, CanUse, GetHeld, Plan);
+	TestFalse(TEXT("Short plan fails"), Plan.bSuccess);
+	TestEqual(TEXT("Missing ore reported"), Plan.MissingMaterials.FindRef(TEXT("Item_Ore")), 2);
+
+	// Learning the carving recipe changes the handle producer; the memoized expansion notices
+	Held.Add(TEXT("Item_Ore"), 6);
+	Known.Add(TEXT("Knowledge_Carving"));
+	Planner.BuildPlan(Index, TEXT("Item_Tool"), 4, EMOCraftingStation::None, CanUse, GetHeld, Plan);
+	TestEqual(TEXT("Known recipe preferred"), CountCrafts(Plan, TEXT("recipe_handle_carved")), 1);
+	TestEqual(TEXT("Plain handle not planned"), CountCrafts(Plan, TEXT("recipe_handle")), 0);
+
+	Known.Reset();
+	Planner.BuildPlan(Index, TEXT("Item_Tool"), 4, EMOCraftingStation::None, CanUse, GetHeld, Plan);
+	TestEqual(TEXT("Unknown recipe skipped"), CountCrafts(Plan, TEXT("recipe_handle_carved")), 0);
+	TestEqual(TEXT("Plain handle again"), CountCrafts(Plan, TEXT("recipe_handle")), 2);
+
+	// Two ore per ingot: MAX_int32 tools need more ore than an int32 holds
+	Planner.BuildPlan(Index, TEXT("Item_Tool"), MAX_int32, EMOCraftingStation::None, CanUse, GetHeld, Plan);
+	TestFalse(TEXT("Oversized plan rejected"), Plan.bSuccess);
+	TestEqual(TEXT("Rejected plan has no steps"), Plan.Steps.Num(), 0);
+
+	Planner.BuildPlan(Index, TEXT("Item_A"), 1, EMOCraftingStation::None, CanUse, GetHeld, Plan);
+	TestTrue(TEXT("Cycle detected"), Plan.CyclicItems.Contains(TEXT("Item_A")));
+	TestFalse(TEXT("Loop cannot bootstrap itself"), Plan.bSuccess);
+	TestEqual(TEXT("Loop closure needs A from inventory"), Plan.MissingMaterials.FindRef(TEXT("Item_A")), 1);
+
+	return true;
+}
+
+//=============================================================================
+// Crafting Scheduler Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingScheduler_Wakes_KeepOneBookingPerQueue,
+	"MOFramework.Crafting.Scheduler.KeepOneBookingPerQueue",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingScheduler_Wakes_KeepOneBookingPerQueue::RunTest(const FString& Parameters)
+{
+	FMOTestWorld World(TEXT("MOCraftingSchedulerTest"));
+
+	UMOCraftingSchedulerSubsystem* Scheduler = UMOCraftingSchedulerSubsystem::Get(World);
+	TestNotNull(TEXT("Scheduler exists in game worlds"), Scheduler);
+
+	AActor* Crafter = World.SpawnHost();
+	UMOCraftingQueueComponent* Queue = NewObject<UMOCraftingQueueComponent>(Crafter);
+	Queue->RegisterComponent();
+
+	TestFalse(TEXT("Empty queue does not start"), Queue->StartCrafting());
+	TestEqual(TEXT("Nothing booked"), Scheduler->GetActiveQueueCount(), 0);
+
+	// Rebooking supersedes the earlier wake instead of adding a second live one
+	const double Now = UMOSimulationClockSubsystem::GetSimTime(World);
+	Scheduler->ScheduleQueue(Queue, Now + 5.0);
+	Scheduler->ScheduleQueue(Queue, Now + 2.0);
+	TestEqual(TEXT("One live booking"), Scheduler->GetActiveQueueCount(), 1);
+	TestEqual(TEXT("Superseded booking still in the heap"), Scheduler->GetPendingWakeCount(), 2);
+
+	Scheduler->UnscheduleQueue(Queue);
+	TestEqual(TEXT("Unscheduled"), Scheduler->GetActiveQueueCount(), 0);
+
+	Scheduler->RunDueWakes();
+	TestEqual(TEXT("Stale bookings dropped"), Scheduler->GetPendingWakeCount(), 0);
+
+	TestFalse(TEXT("Station job needs a material inventory"), Scheduler->SubmitStationJob(EMOCraftingStation::None, TEXT("Recipe_Any"), 1, nullptr).IsValid());
+	TestTrue(TEXT("Worker registers"), Scheduler->RegisterWorker(Queue, EMOCraftingStation::None));
+	TestEqual(TEXT("No jobs waiting"), Scheduler->GetPendingStationJobCount(EMOCraftingStation::None), 0);
+
+	return true;
+}
+
+//=============================================================================
+// Crafting Queue Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingQueue_PlanStepFailure_CancelsRestOfPlan,
+	"MOFramework.Crafting.Queue.PlanStepFailureCancelsRestOfPlan",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingQueue_PlanStepFailure_CancelsRestOfPlan::RunTest(const FString& Parameters)
+{
+	const FName Ore = TEXT("Item_Ore");
+	const FName Wood = TEXT("Item_Wood");
+	const FName Cloth = TEXT("Item_Cloth");
+
+	FMORecipeDefinitionRow Ingot = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_ingot"), TEXT("Ingot"));
+	MOFrameworkTestData::AddTestIngredient(Ingot, Ore, 2);
+	MOFrameworkTestData::AddTestOutput(Ingot, TEXT("Item_Ingot"), 1);
+	FMORecipeDefinitionRow Handle = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_handle"), TEXT("Handle"));
+	MOFrameworkTestData::AddTestIngredient(Handle, Wood, 1);
+	MOFrameworkTestData::AddTestOutput(Handle, TEXT("Item_Handle"), 1);
+	FMORecipeDefinitionRow Tool = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_tool"), TEXT("Tool"));
+	MOFrameworkTestData::AddTestIngredient(Tool, TEXT("Item_Ingot"), 1);
+	MOFrameworkTestData::AddTestIngredient(Tool, TEXT("Item_Handle"), 1);
+	MOFrameworkTestData::AddTestOutput(Tool, TEXT("Item_Tool"), 1);
+	FMORecipeDefinitionRow Bandage = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_bandage"), TEXT("Bandage"));
+	MOFrameworkTestData::AddTestIngredient(Bandage, Cloth, 2);
+	MOFrameworkTestData::AddTestOutput(Bandage, TEXT("Item_Bandage"), 1);
+
+	MOFrameworkTestData::FScopedTestRecipeTable Recipes({ &Ingot, &Handle, &Tool, &Bandage });
+	FMOTestWorld World(TEXT("MOCraftingQueuePlanFailureTest"));
+
+	AActor* Crafter = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Crafter);
+	Inventory->RegisterComponent();
+	UMOCraftingQueueComponent* Queue = NewObject<UMOCraftingQueueComponent>(Crafter);
+	Queue->RegisterComponent();
+
+	UMOTestRecipeEventRecorder* Events = NewObject<UMOTestRecipeEventRecorder>();
+	Queue->OnCraftFailed.AddDynamic(Events, &UMOTestRecipeEventRecorder::HandleCraftFailed);
+
+	const FGuid WoodGuid = FGuid::NewGuid();
+	Inventory->AddItemByGuid(FGuid::NewGuid(), Ore, 2);
+	Inventory->AddItemByGuid(WoodGuid, Wood, 1);
+	Inventory->AddItemByGuid(FGuid::NewGuid(), Cloth, 2);
+
+	FMOCraftingPlan Plan;
+	if (!TestTrue(TEXT("Plan enqueued"), Queue->EnqueueCraftPlan(TEXT("Item_Tool"), 1, EMOCraftingStation::None, Plan)))
+	{
+		return false;
+	}
+	TestTrue(TEXT("Plan steps share an id"), Plan.PlanId.IsValid());
+	TestTrue(TEXT("Unrelated craft enqueued behind the plan"), Queue->EnqueueCraft(Bandage.RecipeId, 1));
+	TestEqual(TEXT("Bandage cloth taken upfront"), Inventory->GetTotalQuantityByDefinition(Cloth), 0);
+
+	// The wood the plan counted on is used elsewhere before the handle step comes due
+	Inventory->RemoveItemByGuid(WoodGuid, 1);
+
+	World->TimeSeconds += 10.0f;
+	UMOCraftingSchedulerSubsystem::Get(World)->RunDueWakes();
+
+	// Only the handle fails: the tool step is cancelled with it instead of failing in turn
+	TestEqual(TEXT("Handle step failed"), Events->FailedRecipes, TArray<FName>{ Handle.RecipeId });
+	TestEqual(TEXT("Failure names the plan"), Events->FailedPlans, TArray<FGuid>{ Plan.PlanId });
+	TestEqual(TEXT("No tool from a broken plan"), Inventory->GetTotalQuantityByDefinition(TEXT("Item_Tool")), 0);
+	TestEqual(TEXT("Failed step produced nothing"), Inventory->GetTotalQuantityByDefinition(TEXT("Item_Handle")), 0);
+
+	// Entries outside the plan carry on, and prepaid ingredients are not taken again
+	TestEqual(TEXT("Bandage still crafted"), Inventory->GetTotalQuantityByDefinition(TEXT("Item_Bandage")), 1);
+	TestTrue(TEXT("Queue drained"), Queue->IsQueueEmpty());
+	TestFalse(TEXT("Queue idle"), Queue->IsCraftingActive());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingQueue_PlanIds_SurviveSaveLoad,
+	"MOFramework.Crafting.Queue.PlanIdsSurviveSaveLoad",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingQueue_PlanIds_SurviveSaveLoad::RunTest(const FString& Parameters)
+{
+	const FName Ore = TEXT("Item_Ore");
+	const FName Wood = TEXT("Item_Wood");
+
+	FMORecipeDefinitionRow Ingot = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_ingot"), TEXT("Ingot"));
+	MOFrameworkTestData::AddTestIngredient(Ingot, Ore, 2);
+	MOFrameworkTestData::AddTestOutput(Ingot, TEXT("Item_Ingot"), 1);
+	FMORecipeDefinitionRow Handle = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_handle"), TEXT("Handle"));
+	MOFrameworkTestData::AddTestIngredient(Handle, Wood, 1);
+	MOFrameworkTestData::AddTestOutput(Handle, TEXT("Item_Handle"), 1);
+	FMORecipeDefinitionRow Tool = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_tool"), TEXT("Tool"));
+	MOFrameworkTestData::AddTestIngredient(Tool, TEXT("Item_Ingot"), 1);
+	MOFrameworkTestData::AddTestIngredient(Tool, TEXT("Item_Handle"), 1);
+	MOFrameworkTestData::AddTestOutput(Tool, TEXT("Item_Tool"), 1);
+
+	MOFrameworkTestData::FScopedTestRecipeTable Recipes({ &Ingot, &Handle, &Tool });
+	FMOTestWorld World(TEXT("MOCraftingQueuePlanSaveTest"));
+
+	AActor* Crafter = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Crafter);
+	Inventory->RegisterComponent();
+	UMOCraftingQueueComponent* Queue = NewObject<UMOCraftingQueueComponent>(Crafter);
+	Queue->RegisterComponent();
+
+	UMOTestRecipeEventRecorder* Events = NewObject<UMOTestRecipeEventRecorder>();
+	Queue->OnCraftFailed.AddDynamic(Events, &UMOTestRecipeEventRecorder::HandleCraftFailed);
+
+	const FGuid WoodGuid = FGuid::NewGuid();
+	Inventory->AddItemByGuid(FGuid::NewGuid(), Ore, 2);
+	Inventory->AddItemByGuid(WoodGuid, Wood, 1);
+
+	FMOCraftingPlan Plan;
+	if (!TestTrue(TEXT("Plan enqueued"), Queue->EnqueueCraftPlan(TEXT("Item_Tool"), 1, EMOCraftingStation::None, Plan)))
+	{
+		return false;
+	}
+
+	FMOCraftingQueueSaveData Save;
+	FMOCraftingQueuePlanSaveData PlanSave;
+	Queue->BuildSaveData(Save);
+	Queue->BuildPlanSaveData(PlanSave);
+	TestEqual(TEXT("Every plan step saved"), PlanSave.PlanEntries.Num(), 3);
+	Queue->ClearQueue();
+
+	Queue->ApplyPlanSaveData(PlanSave);
+	Queue->ApplySaveData(Save, false);
+	TestEqual(TEXT("Plan steps reloaded"), Queue->GetQueueLength(), 3);
+
+	// After the load a failed step still takes the rest of its plan with it
+	Inventory->RemoveItemByGuid(WoodGuid, 1);
+	Queue->StartCrafting();
+	World->TimeSeconds += 10.0f;
+	UMOCraftingSchedulerSubsystem::Get(World)->RunDueWakes();
+
+	TestEqual(TEXT("Handle step failed"), Events->FailedRecipes, TArray<FName>{ Handle.RecipeId });
+	TestEqual(TEXT("Failure names the saved plan"), Events->FailedPlans, TArray<FGuid>{ Plan.PlanId });
+	TestEqual(TEXT("Tool step cancelled, not attempted"), Events->FailedRecipes.Num(), 1);
+	TestTrue(TEXT("Queue drained"), Queue->IsQueueEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingQueue_SchedulerWake_CompletesWithoutTick,
+	"MOFramework.Crafting.Queue.SchedulerWakeCompletesWithoutTick",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingQueue_SchedulerWake_CompletesWithoutTick::RunTest(const FString& Parameters)
+{
+	FMORecipeDefinitionRow Plank = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_plank"), TEXT("Plank"));
+	MOFrameworkTestData::AddTestIngredient(Plank, TEXT("Item_Wood"), 1);
+	MOFrameworkTestData::AddTestOutput(Plank, TEXT("Item_Plank"), 1);
+
+	MOFrameworkTestData::FScopedTestRecipeTable Recipes({ &Plank });
+	FMOTestWorld World(TEXT("MOCraftingQueueWakeTest"));
+	UMOCraftingSchedulerSubsystem* Scheduler = UMOCraftingSchedulerSubsystem::Get(World);
+
+	AActor* Crafter = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Crafter);
+	Inventory->RegisterComponent();
+	UMOCraftingQueueComponent* Queue = NewObject<UMOCraftingQueueComponent>(Crafter);
+	Queue->RegisterComponent();
+
+	Inventory->AddItemByGuid(FGuid::NewGuid(), TEXT("Item_Wood"), 1);
+	if (!TestTrue(TEXT("Craft enqueued"), Queue->EnqueueCraft(Plank.RecipeId, 1)))
+	{
+		return false;
+	}
+
+	// The scheduler owns the wake; the component never ticks
+	TestFalse(TEXT("Queue does not tick"), Queue->IsComponentTickEnabled());
+	TestEqual(TEXT("Queue booked with the scheduler"), Scheduler->GetActiveQueueCount(), 1);
+
+	World->TimeSeconds += 0.5f;
+	Scheduler->RunDueWakes();
+	TestEqual(TEXT("Not done halfway"), Inventory->GetTotalQuantityByDefinition(TEXT("Item_Plank")), 0);
+
+	World->TimeSeconds += 0.6f;
+	Scheduler->RunDueWakes();
+	TestEqual(TEXT("Completed on the wake"), Inventory->GetTotalQuantityByDefinition(TEXT("Item_Plank")), 1);
+	TestTrue(TEXT("Queue drained"), Queue->IsQueueEmpty());
+	TestEqual(TEXT("Booking released"), Scheduler->GetActiveQueueCount(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingQueue_StationJobs_SurviveSaveLoad,
+	"MOFramework.Crafting.Queue.StationJobsSurviveSaveLoad",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingQueue_StationJobs_SurviveSaveLoad::RunTest(const FString& Parameters)
+{
+	FMORecipeDefinitionRow Plank = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_plank"), TEXT("Plank"));
+	Plank.RequiredStation = EMOCraftingStation::Workbench;
+	MOFrameworkTestData::AddTestIngredient(Plank, TEXT("Item_Wood"), 1);
+	MOFrameworkTestData::AddTestOutput(Plank, TEXT("Item_Plank"), 1);
+
+	MOFrameworkTestData::FScopedTestRecipeTable Recipes({ &Plank });
+	FMOTestWorld World(TEXT("MOCraftingStationSaveTest"));
+	UMOCraftingSchedulerSubsystem* Scheduler = UMOCraftingSchedulerSubsystem::Get(World);
+
+	// Materials sit in a crate with an identity, so the save can name it
+	AMOWorldItem* Crate = World->SpawnActor<AMOWorldItem>(AMOWorldItem::StaticClass(), FTransform::Identity);
+	UMOInventoryComponent* Materials = NewObject<UMOInventoryComponent>(Crate);
+	Materials->RegisterComponent();
+	Materials->AddItemByGuid(FGuid::NewGuid(), TEXT("Item_Wood"), 2);
+
+	const FGuid JobId = Scheduler->SubmitStationJob(EMOCraftingStation::Workbench, Plank.RecipeId, 1, Materials);
+	TestTrue(TEXT("Job submitted"), JobId.IsValid());
+
+	// A job nobody has taken yet comes back with the save
+	FMOCraftingSchedulerSaveData PendingSave;
+	Scheduler->BuildSaveData(PendingSave);
+	TestEqual(TEXT("Pending job saved"), PendingSave.PendingJobs.Num(), 1);
+	Scheduler->CancelStationJob(JobId);
+	Scheduler->ApplySaveData(PendingSave);
+	TestEqual(TEXT("Pending job restored"), Scheduler->GetPendingStationJobCount(EMOCraftingStation::Workbench), 1);
+
+	AActor* WorkerPawn = World.SpawnHost();
+	UMOCraftingQueueComponent* Worker = NewObject<UMOCraftingQueueComponent>(WorkerPawn);
+	Worker->RegisterComponent();
+	TestTrue(TEXT("Worker registers"), Scheduler->RegisterWorker(Worker, EMOCraftingStation::Workbench));
+	TestEqual(TEXT("Worker took the job"), Worker->GetQueueLength(), 1);
+	TestEqual(TEXT("Nothing left waiting"), Scheduler->GetPendingStationJobCount(EMOCraftingStation::Workbench), 0);
+
+	// A taken job keeps crafting from the crate after a reload
+	FMOCraftingSchedulerSaveData SchedulerSave;
+	Scheduler->BuildSaveData(SchedulerSave);
+	FMOCraftingQueueSaveData WorkerSave;
+	Worker->BuildSaveData(WorkerSave);
+	TestEqual(TEXT("Entry inventory saved"), SchedulerSave.AssignedEntries.Num(), 1);
+
+	Worker->ClearQueue();
+	Scheduler->ApplySaveData(SchedulerSave);
+	Worker->ApplySaveData(WorkerSave);
+	TestTrue(TEXT("Worker resumed"), Worker->IsCraftingActive());
+
+	World->TimeSeconds += 2.0f;
+	Scheduler->RunDueWakes();
+	TestEqual(TEXT("Plank delivered to the crate"), Materials->GetTotalQuantityByDefinition(TEXT("Item_Plank")), 1);
+	TestEqual(TEXT("Wood taken from the crate"), Materials->GetTotalQuantityByDefinition(TEXT("Item_Wood")), 1);
+	TestTrue(TEXT("Worker drained"), Worker->IsQueueEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingQueue_FastForward_CompletesDueCrafts,
+	"MOFramework.Crafting.Queue.FastForwardCompletesDueCrafts",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingQueue_FastForward_CompletesDueCrafts::RunTest(const FString& Parameters)
+{
+	FMORecipeDefinitionRow Plank = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_plank"), TEXT("Plank"));
+	MOFrameworkTestData::AddTestIngredient(Plank, TEXT("Item_Wood"), 1);
+	MOFrameworkTestData::AddTestOutput(Plank, TEXT("Item_Plank"), 1);
+
+	MOFrameworkTestData::FScopedTestRecipeTable Recipes({ &Plank });
+	FMOTestWorld World(TEXT("MOCraftingQueueFastForwardTest"));
+
+	AActor* Crafter = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Crafter);
+	Inventory->RegisterComponent();
+	UMOCraftingQueueComponent* Queue = NewObject<UMOCraftingQueueComponent>(Crafter);
+	Queue->RegisterComponent();
+
+	Inventory->AddItemByGuid(FGuid::NewGuid(), TEXT("Item_Wood"), 2);
+	if (!TestTrue(TEXT("Crafts enqueued"), Queue->EnqueueCraft(Plank.RecipeId, 2)))
+	{
+		return false;
+	}
+
+	// No world time passes: the jump alone makes both crafts due, and they complete right away
+	UMOSimulationClockSubsystem::Get(World)->FastForward(5.0f);
+	TestEqual(TEXT("Both crafts completed"), Inventory->GetTotalQuantityByDefinition(TEXT("Item_Plank")), 2);
+	TestTrue(TEXT("Queue drained"), Queue->IsQueueEmpty());
+	TestEqual(TEXT("Booking released"), UMOCraftingSchedulerSubsystem::Get(World)->GetActiveQueueCount(), 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingQueue_TimeScaleChange_RearmsWake,
+	"MOFramework.Crafting.Queue.TimeScaleChangeRearmsWake",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingQueue_TimeScaleChange_RearmsWake::RunTest(const FString& Parameters)
+{
+	FMORecipeDefinitionRow Plank = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_plank"), TEXT("Plank"));
+	MOFrameworkTestData::AddTestIngredient(Plank, TEXT("Item_Wood"), 1);
+	MOFrameworkTestData::AddTestOutput(Plank, TEXT("Item_Plank"), 1);
+
+	MOFrameworkTestData::FScopedTestRecipeTable Recipes({ &Plank });
+	FMOTestWorld World(TEXT("MOCraftingQueueTimeScaleTest"));
+
+	AActor* Crafter = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Crafter);
+	Inventory->RegisterComponent();
+	UMOCraftingQueueComponent* Queue = NewObject<UMOCraftingQueueComponent>(Crafter);
+	Queue->RegisterComponent();
+
+	Inventory->AddItemByGuid(FGuid::NewGuid(), TEXT("Item_Wood"), 1);
+	if (!TestTrue(TEXT("Craft enqueued"), Queue->EnqueueCraft(Plank.RecipeId, 1)))
+	{
+		return false;
+	}
+
+	// The craft was due one world second out; at 4x it is due after a quarter of that.
+	// Only the timer drives the wake here, so this fails if the scale change left it armed late.
+	UMOSimulationClockSubsystem::Get(World)->SetTimeScale(4.0f);
+	World->TimeSeconds += 0.3f;
+	World->GetTimerManager().Tick(0.3f);
+
+	TestEqual(TEXT("Completed on the re-armed timer"), Inventory->GetTotalQuantityByDefinition(TEXT("Item_Plank")), 1);
+	TestTrue(TEXT("Queue drained"), Queue->IsQueueEmpty());
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOCraftingQueue_OfflineProgress_CatchesUpOnLoad,
+	"MOFramework.Crafting.Queue.OfflineProgressCatchesUpOnLoad",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOCraftingQueue_OfflineProgress_CatchesUpOnLoad::RunTest(const FString& Parameters)
+{
+	FMORecipeDefinitionRow Plank = MOFrameworkTestData::MakeTestRecipe(TEXT("recipe_plank"), TEXT("Plank"));
+	MOFrameworkTestData::AddTestIngredient(Plank, TEXT("Item_Wood"), 1);
+	MOFrameworkTestData::AddTestOutput(Plank, TEXT("Item_Plank"), 1);
+
+	MOFrameworkTestData::FScopedTestRecipeTable Recipes({ &Plank });
+	FMOTestWorld World(TEXT("MOCraftingQueueOfflineTest"));
+
+	AActor* Crafter = World.SpawnHost();
+	UMOInventoryComponent* Inventory = NewObject<UMOInventoryComponent>(Crafter);
+	Inventory->RegisterComponent();
+	UMOCraftingQueueComponent* Queue = NewObject<UMOCraftingQueueComponent>(Crafter);
+	Queue->RegisterComponent();
+
+	Inventory->AddItemByGuid(FGuid::NewGuid(), TEXT("Item_Wood"), 3);
+	if (!TestTrue(TEXT("Crafts enqueued"), Queue->EnqueueCraft(Plank.RecipeId, 3)))
+	{
+		return false;
+	}
+
+	FMOCraftingQueueSaveData Save;
+	Queue->BuildSaveData(Save);
+	TestTrue(TEXT("Saved while active"), Save.bWasActive);
+	Queue->ClearQueue();
+
+	// 1.25s offline at 2x is 2.5s of crafting: two crafts done, the third halfway
+	UMOSimulationClockSubsystem::Get(World)->SetTimeScale(2.0f);
+	Save.PausedAt = FDateTime::UtcNow() - FTimespan::FromSeconds(1.25);
+	Queue->ApplySaveData(Save, true);
+
+	TestEqual(TEXT("Offline crafts delivered on load"), Inventory->GetTotalQuantityByDefinition(TEXT("Item_Plank")), 2);
+	TestEqual(TEXT("Last craft still queued"), Queue->GetQueueLength(), 1);
+	TestTrue(TEXT("Crafting resumed"), Queue->IsCraftingActive());
+	TestTrue(TEXT("Partial progress kept"), Queue->GetCurrentCraftProgress() > 0.4f);
+
+	return true;
+}
+
+//=============================================================================
+// Simulation Clock Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOSimulationClock_ScaleAndFastForward_StayMonotonic,
+	"MOFramework.Simulation.Clock.ScaleAndFastForward",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOSimulationClock_ScaleAndFastForward_StayMonotonic::RunTest(const FString& Parameters)
+{
+	FMOTestWorld World(TEXT("MOSimulationClockTest"));
+
+	UMOSimulationClockSubsystem* Clock = UMOSimulationClockSubsystem::Get(World);
+	TestNotNull(TEXT("Clock exists in game worlds"), Clock);
+
+	const double Start = Clock->GetTime();
+	TestEqual(TEXT("Clock starts at world time"), Start, static_cast<double>(World->GetTimeSeconds()));
+
+	int32 ChangeCount = 0;
+	Clock->OnClockChanged.AddLambda([&ChangeCount]() { ++ChangeCount; });
+
+	// Changing the scale never moves the current time, only how fast it runs from here
+	Clock->SetTimeScale(4.0f);
+	TestEqual(TEXT("Scale change keeps the time"), Clock->GetTime(), Start);
+	TestEqual(TEXT("Deadline maps through the scale"), Clock->GetWorldDelayUntil(Start + 20.0), 5.0);
+
+	Clock->FastForward(3600.0f);
+	TestEqual(TEXT("Fast-forward skips ahead"), Clock->GetTime(), Start + 3600.0);
+	TestEqual(TEXT("Passed deadline is due now"), Clock->GetWorldDelayUntil(Start + 20.0), 0.0);
+
+	Clock->FastForward(-10.0f);
+	TestEqual(TEXT("Clock never runs backwards"), Clock->GetTime(), Start + 3600.0);
+
+	Clock->SetTimeScale(0.0f);
+	TestTrue(TEXT("Frozen clock never reaches a future deadline"), Clock->GetWorldDelayUntil(Start + 7200.0) >= TNumericLimits<float>::Max());
+	TestEqual(TEXT("Each change broadcast once"), ChangeCount, 3);
+
+	TestEqual(TEXT("Static lookup reads the clock"), UMOSimulationClockSubsystem::GetSimTime(World), Start + 3600.0);
+
+	return true;
+}
+
 //=============================================================================
 // Integration Tests
 //=============================================================================
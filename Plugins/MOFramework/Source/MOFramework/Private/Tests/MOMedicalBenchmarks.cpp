@@ -0,0 +1,329 @@
+#include "Misc/AutomationTest.h"
+#include "MOAnatomyComponent.h"
+#include "MOVitalsComponent.h"
+#include "MOMetabolismComponent.h"
+#include "MOMentalStateComponent.h"
+#include "MOSurvivalStatsComponent.h"
+#include "MOMedicalSchedulerSubsystem.h"
+#include "MOMedicalDatabaseSettings.h"
+#include "MOItemDefinitionRow.h"
+#include "MOTestWorld.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+//=============================================================================
+// Medical Simulation Benchmarks
+//
+// Spawns N synthetic pawns with wounds, conditions and food in a headless game
+// world and drives the medical scheduler for a fixed simulated duration.
+// Run with e.g.:
+//   UnrealEditor-Cmd <Project> -nullrhi -unattended
+//     -ExecCmds="Automation RunTests MOFramework.Medical.Benchmark; Quit"
+// Results are written to Saved/Benchmarks/MOMedicalBenchmark.csv and the test log.
+// Pass -MOMedicalBenchMaxNsPerPawnTick=<ns> to fail the run above a budget.
+//=============================================================================
+
+namespace MOMedicalBenchmark
+{
+	/** Simulated time each scenario is driven for (seconds). */
+	constexpr float SimulatedSeconds = 300.0f;
+
+	/** Passes between memory samples; timing excludes the sampling. */
+	constexpr int32 PassesPerSample = 60;
+
+	/** Extra untimed passes whose allocator calls are counted. */
+	constexpr int32 AllocationSamplePasses = 20;
+
+	/** Fixed seed for the synthetic load so runs are comparable. */
+	constexpr int32 LoadSeed = 1337;
+
+	/**
+	 * Allocator calls (Malloc and Realloc) made so far, from FMalloc's own counters. They are
+	 * process-wide, so samples include whatever other threads allocate meanwhile, and stay at
+	 * zero under an allocator that does not count.
+	 */
+	uint64 GetAllocationCallCount()
+	{
+#if !UE_BUILD_SHIPPING
+		return static_cast<uint64>(FMalloc::TotalMallocCalls) + static_cast<uint64>(FMalloc::TotalReallocCalls);
+#else
+		return 0;
+#endif
+	}
+
+	/** One scenario's results. */
+	struct FResult
+	{
+		int32 NumPawns = 0;
+		int32 NumPasses = 0;
+		double TotalSeconds = 0.0;
+		double NsPerPawnTick = 0.0;
+		double AllocationsPerTick = 0.0;
+		int32 PendingEvents = 0;
+
+		/** Peak average bytes per pawn, per component class. */
+		TMap<FString, SIZE_T> PeakBytesPerPawn;
+	};
+
+	FMOItemNutrition MakeMeal(FRandomStream& Stream)
+	{
+		FMOItemNutrition Nutrition;
+		Nutrition.Calories = Stream.FRandRange(150.0f, 700.0f);
+		Nutrition.Protein = Stream.FRandRange(5.0f, 40.0f);
+		Nutrition.Carbohydrates = Stream.FRandRange(10.0f, 80.0f);
+		Nutrition.Fat = Stream.FRandRange(2.0f, 30.0f);
+		Nutrition.WaterContent = Stream.FRandRange(20.0f, 300.0f);
+		Nutrition.Fiber = Stream.FRandRange(0.0f, 8.0f);
+		Nutrition.VitaminA = 10.0f;
+		Nutrition.VitaminB = 10.0f;
+		Nutrition.VitaminC = 10.0f;
+		Nutrition.VitaminD = 5.0f;
+		Nutrition.Iron = 8.0f;
+		Nutrition.Calcium = 10.0f;
+		Nutrition.Potassium = 10.0f;
+		Nutrition.Sodium = 5.0f;
+		return Nutrition;
+	}
+
+	/** Spawn one pawn with the full medical stack and a realistic injury/digestion load. */
+	AActor* SpawnSyntheticPawn(UWorld* World, FRandomStream& Stream)
+	{
+		const FVector Location(Stream.FRandRange(-50000.0f, 50000.0f), Stream.FRandRange(-50000.0f, 50000.0f), 0.0f);
+		AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location));
+		if (!Actor)
+		{
+			return nullptr;
+		}
+
+		// Create all siblings before registering so each BeginPlay can cache the others
+		UMOAnatomyComponent* Anatomy = NewObject<UMOAnatomyComponent>(Actor);
+		UMOVitalsComponent* Vitals = NewObject<UMOVitalsComponent>(Actor);
+		UMOMetabolismComponent* Metabolism = NewObject<UMOMetabolismComponent>(Actor);
+		UMOMentalStateComponent* Mental = NewObject<UMOMentalStateComponent>(Actor);
+		UMOSurvivalStatsComponent* Survival = NewObject<UMOSurvivalStatsComponent>(Actor);
+
+		Anatomy->RegisterComponent();
+		Vitals->RegisterComponent();
+		Metabolism->RegisterComponent();
+		Mental->RegisterComponent();
+		Survival->RegisterComponent();
+
+		static const EMOWoundType WoundTypes[] =
+		{
+			EMOWoundType::Laceration,
+			EMOWoundType::Puncture,
+			EMOWoundType::Blunt,
+			EMOWoundType::BurnFirst,
+			EMOWoundType::Fracture
+		};
+
+		const int32 NumWounds = Stream.RandRange(0, 4);
+		for (int32 i = 0; i < NumWounds; ++i)
+		{
+			const EMOBodyPartType Part = static_cast<EMOBodyPartType>(Stream.RandRange(1, static_cast<int32>(EMOBodyPartType::MAX) - 1));
+			const EMOWoundType Type = WoundTypes[Stream.RandRange(0, UE_ARRAY_COUNT(WoundTypes) - 1)];
+			Anatomy->InflictDamage(Part, Stream.FRandRange(5.0f, 40.0f), Type);
+		}
+
+		if (Stream.FRand() < 0.25f)
+		{
+			Anatomy->AddCondition(EMOConditionType::Infection, EMOBodyPartType::None, Stream.FRandRange(5.0f, 50.0f));
+		}
+
+		const int32 NumMeals = Stream.RandRange(1, 3);
+		for (int32 i = 0; i < NumMeals; ++i)
+		{
+			Metabolism->ConsumeFood(MakeMeal(Stream), FName(TEXT("BenchmarkMeal")));
+		}
+
+		return Actor;
+	}
+
+	/** Record average bytes per pawn for each medical component class, keeping the peak. */
+	void SampleMemory(const TArray<AActor*>& Pawns, TMap<FString, SIZE_T>& PeakBytesPerPawn)
+	{
+		if (Pawns.Num() == 0)
+		{
+			return;
+		}
+
+		TMap<FString, SIZE_T> Totals;
+		for (AActor* Pawn : Pawns)
+		{
+			for (UActorComponent* Component : Pawn->GetComponents())
+			{
+				const SIZE_T Bytes = Component->GetClass()->GetStructureSize() + Component->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+				Totals.FindOrAdd(Component->GetClass()->GetName()) += Bytes;
+			}
+		}
+
+		for (const TPair<FString, SIZE_T>& Pair : Totals)
+		{
+			SIZE_T& Peak = PeakBytesPerPawn.FindOrAdd(Pair.Key);
+			Peak = FMath::Max(Peak, Pair.Value / Pawns.Num());
+		}
+	}
+
+	/** Build a scenario with NumPawns pawns and drive the scheduler for SimulatedSeconds. */
+	bool RunScenario(int32 NumPawns, FResult& OutResult, FString& OutError)
+	{
+		FMOTestWorld World(TEXT("MOMedicalBenchmark"));
+		UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(World);
+		if (!Scheduler)
+		{
+			OutError = TEXT("No medical scheduler in the benchmark world; nothing to benchmark");
+			return false;
+		}
+
+		FRandomStream Stream(LoadSeed);
+		TArray<AActor*> Pawns;
+		Pawns.Reserve(NumPawns);
+		for (int32 i = 0; i < NumPawns; ++i)
+		{
+			if (AActor* Pawn = SpawnSyntheticPawn(World, Stream))
+			{
+				Pawns.Add(Pawn);
+			}
+		}
+
+		const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+		const float PassInterval = Settings ? Settings->SchedulerPassInterval : 0.5f;
+		const int32 NumPasses = FMath::CeilToInt(SimulatedSeconds / PassInterval);
+
+		OutResult.NumPawns = Pawns.Num();
+		OutResult.NumPasses = NumPasses;
+		SampleMemory(Pawns, OutResult.PeakBytesPerPawn);
+
+		// The scheduler's own timer never fires here (the world is not ticked); drive
+		// passes directly and advance world time so scheduled wound events come due.
+		Scheduler->ResetStats();
+		double TimedSeconds = 0.0;
+		for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+		{
+			const double Start = FPlatformTime::Seconds();
+			World->TimeSeconds += PassInterval;
+			Scheduler->RunPass();
+			TimedSeconds += FPlatformTime::Seconds() - Start;
+
+			if ((Pass + 1) % PassesPerSample == 0)
+			{
+				SampleMemory(Pawns, OutResult.PeakBytesPerPawn);
+			}
+		}
+		SampleMemory(Pawns, OutResult.PeakBytesPerPawn);
+
+		// Count allocations on a separate short run so reading the counters does not skew timing
+		const uint64 AllocationsBefore = GetAllocationCallCount();
+		for (int32 Pass = 0; Pass < AllocationSamplePasses; ++Pass)
+		{
+			World->TimeSeconds += PassInterval;
+			Scheduler->RunPass();
+		}
+		const uint64 AllocationCount = GetAllocationCallCount() - AllocationsBefore;
+
+		OutResult.TotalSeconds = TimedSeconds;
+		OutResult.NsPerPawnTick = (OutResult.NumPawns > 0) ? TimedSeconds * 1.0e9 / (static_cast<double>(OutResult.NumPawns) * NumPasses) : 0.0;
+		OutResult.AllocationsPerTick = static_cast<double>(AllocationCount) / AllocationSamplePasses;
+		OutResult.PendingEvents = Scheduler->GetPendingEventCount();
+
+		return true;
+	}
+
+	/** Append one result row to Saved/Benchmarks/MOMedicalBenchmark.csv. */
+	void WriteCsvRow(const FResult& Result)
+	{
+		const FString Path = FPaths::ProjectSavedDir() / TEXT("Benchmarks") / TEXT("MOMedicalBenchmark.csv");
+
+		TArray<FString> ComponentNames;
+		Result.PeakBytesPerPawn.GetKeys(ComponentNames);
+		ComponentNames.Sort();
+
+		const UMOMedicalDatabaseSettings* Settings = UMOMedicalDatabaseSettings::Get();
+		FString Row;
+		if (!IFileManager::Get().FileExists(*Path))
+		{
+			Row += TEXT("Timestamp,Pawns,Passes,TotalMs,NsPerPawnTick,AllocationsPerTick,PendingEvents,LOD,BatchKernels,WoundEvents");
+			for (const FString& Name : ComponentNames)
+			{
+				Row += FString::Printf(TEXT(",PeakBytes_%s"), *Name);
+			}
+			Row += LINE_TERMINATOR;
+		}
+
+		Row += FString::Printf(TEXT("%s,%d,%d,%.3f,%.1f,%.1f,%d,%d,%d,%d"),
+			*FDateTime::UtcNow().ToIso8601(), Result.NumPawns, Result.NumPasses, Result.TotalSeconds * 1000.0,
+			Result.NsPerPawnTick, Result.AllocationsPerTick, Result.PendingEvents,
+			Settings && Settings->bEnableSimulationLOD, Settings && Settings->bUseVitalsBatchKernels,
+			Settings && Settings->bUseWoundEventScheduling);
+		for (const FString& Name : ComponentNames)
+		{
+			Row += FString::Printf(TEXT(",%llu"), static_cast<uint64>(Result.PeakBytesPerPawn[Name]));
+		}
+		Row += LINE_TERMINATOR;
+
+		FFileHelper::SaveStringToFile(Row, *Path, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+	}
+}
+
+IMPLEMENT_COMPLEX_AUTOMATION_TEST(FMOMedicalBenchmark_Scaling,
+	"MOFramework.Medical.Benchmark.Scaling",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+void FMOMedicalBenchmark_Scaling::GetTests(TArray<FString>& OutBeautifiedNames, TArray<FString>& OutTestCommands) const
+{
+	for (const int32 NumPawns : {10, 100, 1000, 5000})
+	{
+		OutBeautifiedNames.Add(FString::Printf(TEXT("%d Pawns"), NumPawns));
+		OutTestCommands.Add(FString::FromInt(NumPawns));
+	}
+}
+
+bool FMOMedicalBenchmark_Scaling::RunTest(const FString& Parameters)
+{
+	using namespace MOMedicalBenchmark;
+
+	const int32 NumPawns = FCString::Atoi(*Parameters);
+
+	// The benchmark measures the scheduler, so it runs whatever bUseMedicalScheduler is set to
+	UMOMedicalDatabaseSettings* Settings = GetMutableDefault<UMOMedicalDatabaseSettings>();
+	TGuardValue<bool> UseScheduler(Settings->bUseMedicalScheduler, true);
+
+	FResult Result;
+	FString Error;
+	if (!RunScenario(NumPawns, Result, Error))
+	{
+		AddError(Error);
+		return false;
+	}
+
+	AddInfo(FString::Printf(TEXT("%d pawns, %d passes (%.0fs simulated): %.3fms total, %.1f ns/pawn/tick, %.1f allocations/tick, %d pending events"),
+		Result.NumPawns, Result.NumPasses, SimulatedSeconds, Result.TotalSeconds * 1000.0,
+		Result.NsPerPawnTick, Result.AllocationsPerTick, Result.PendingEvents));
+
+	for (const TPair<FString, SIZE_T>& Pair : Result.PeakBytesPerPawn)
+	{
+		AddInfo(FString::Printf(TEXT("  %s: peak %llu bytes/pawn"), *Pair.Key, static_cast<uint64>(Pair.Value)));
+	}
+
+	WriteCsvRow(Result);
+
+	// Optional regression gate for CI
+	float MaxNsPerPawnTick = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("MOMedicalBenchMaxNsPerPawnTick="), MaxNsPerPawnTick) && MaxNsPerPawnTick > 0.0f)
+	{
+		TestTrue(FString::Printf(TEXT("%.1f ns/pawn/tick within budget of %.1f"), Result.NsPerPawnTick, MaxNsPerPawnTick),
+			Result.NsPerPawnTick <= MaxNsPerPawnTick);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -3,10 +3,17 @@
 #include "MOVitalsComponent.h"
 #include "MOAnatomyComponent.h"
 #include "MOMentalStateComponent.h"
+#include "MOIdentityComponent.h"
 #include "MOMedicalTypes.h"
+#include "MOVitalsKernels.h"
 #include "MOItemDefinitionRow.h"
+#include "MOMedicalSchedulerSubsystem.h"
+#include "MOMedicalDatabaseSettings.h"
+#include "MOTestWorld.h"
 #include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "Serialization/BitReader.h"
+#include "Serialization/BitWriter.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -471,6 +478,169 @@ bool FMOMetabolism_IsStarving_DetectsLowCalories::RunTest(const FString& Paramet
 	return true;
 }
 
+//=============================================================================
+// Metabolism Component Tests - Fast Forward
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOMetabolism_FastForward_MatchesSmallSteps,
+	"MOFramework.Medical.Metabolism.FastForward.MatchesSmallSteps",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOMetabolism_FastForward_MatchesSmallSteps::RunTest(const FString& Parameters)
+{
+	// The reference runs through the scheduler's live per-tick path, so keep every pass at full detail.
+	UMOMedicalDatabaseSettings* Settings = GetMutableDefault<UMOMedicalDatabaseSettings>();
+	TGuardValue<bool> UseScheduler(Settings->bUseMedicalScheduler, true);
+	TGuardValue<bool> DisableLOD(Settings->bEnableSimulationLOD, false);
+
+	// Mutations need authority, so host both components on actors in a throwaway game world.
+	FMOTestWorld World(TEXT("MOMetabolismFastForwardTest"));
+	UMOMedicalSchedulerSubsystem* Scheduler = UMOMedicalSchedulerSubsystem::Get(World);
+	if (!TestNotNull(TEXT("Medical scheduler exists"), Scheduler))
+	{
+		return false;
+	}
+
+	// Left unregistered so nothing but FastForward advances it.
+	UMOMetabolismComponent* OneShot = NewObject<UMOMetabolismComponent>(World.SpawnHost());
+	UMOMetabolismComponent* Stepped = NewObject<UMOMetabolismComponent>(World.SpawnHost());
+	Stepped->RegisterComponent();
+
+	const FMOItemNutrition Meal = MOMedicalTestData::MakeBalancedMeal();
+	if (!TestTrue(TEXT("One-shot meal accepted"), OneShot->ConsumeFood(Meal, FName("TestMeal")))
+		|| !TestTrue(TEXT("Stepped meal accepted"), Stepped->ConsumeFood(Meal, FName("TestMeal"))))
+	{
+		return false;
+	}
+
+	// Twelve hours in one call vs. the scheduler ticking the component at its own TickInterval
+	const float TotalSeconds = 12.0f * 3600.0f;
+	if (!TestTrue(TEXT("FastForward runs on authority"), OneShot->FastForward(TotalSeconds)))
+	{
+		return false;
+	}
+
+	const float PassInterval = FMath::Max(Settings->SchedulerPassInterval, 0.05f);
+	const int32 NumPasses = FMath::CeilToInt(TotalSeconds / PassInterval);
+	for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+	{
+		World->TimeSeconds += PassInterval;
+		Scheduler->RunPass();
+	}
+
+	const FMONutrientLevels& A = OneShot->GetNutrientLevels();
+	const FMONutrientLevels& B = Stepped->GetNutrientLevels();
+	TestEqual(TEXT("Meal fully digested"), OneShot->GetDigestingFoodCount(), 0);
+	TestEqual(TEXT("Both paths digest the meal"), OneShot->GetDigestingFoodCount(), Stepped->GetDigestingFoodCount());
+	TestTrue(TEXT("Glycogen matches"), FMath::IsNearlyEqual(A.GlycogenStores, B.GlycogenStores, 1.0f));
+	TestTrue(TEXT("Hydration matches"), FMath::IsNearlyEqual(A.HydrationLevel, B.HydrationLevel, 0.1f));
+	TestTrue(TEXT("Protein balance matches"), FMath::IsNearlyEqual(A.ProteinBalance, B.ProteinBalance, 0.5f));
+	TestTrue(TEXT("Vitamin C matches"), FMath::IsNearlyEqual(A.VitaminC, B.VitaminC, 0.1f));
+	TestTrue(TEXT("Body fat matches"), FMath::IsNearlyEqual(
+		OneShot->GetBodyComposition().BodyFatPercent, Stepped->GetBodyComposition().BodyFatPercent, 0.01f));
+
+	return true;
+}
+
+//=============================================================================
+// Medical Delta Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOMedicalDelta_CheckField_AccumulatesDrift,
+	"MOFramework.Medical.Delta.CheckFieldAccumulatesDrift",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOMedicalDelta_CheckField_AccumulatesDrift::RunTest(const FString& Parameters)
+{
+	float LastHeartRate = 72.0f;
+
+	// Small steps below epsilon are not reported individually...
+	FMOMedicalDelta First;
+	First.CheckField(EMOMedicalDeltaField::HeartRate, LastHeartRate, 72.6f, 1.0f);
+	TestTrue(TEXT("Sub-epsilon change is not reported"), First.IsEmpty());
+	TestEqual(TEXT("Last value not latched"), LastHeartRate, 72.0f);
+
+	// ...but are once they add up
+	FMOMedicalDelta Second;
+	Second.CheckField(EMOMedicalDeltaField::HeartRate, LastHeartRate, 73.2f, 1.0f);
+	TestTrue(TEXT("Accumulated drift is reported"), Second.HasField(EMOMedicalDeltaField::HeartRate));
+	TestEqual(TEXT("Last value latched"), LastHeartRate, 73.2f);
+	TestFalse(TEXT("Other fields untouched"), Second.HasField(EMOMedicalDeltaField::SpO2));
+
+	// Field groups partition the mask
+	TestTrue(TEXT("Heart rate is a vitals field"), Second.HasAnyField(FMOMedicalDelta::VitalsFields));
+	TestFalse(TEXT("Heart rate is not a metabolism field"), Second.HasAnyField(FMOMedicalDelta::MetabolismFields));
+	TestEqual(TEXT("Groups do not overlap"), (FMOMedicalDelta::VitalsFields & FMOMedicalDelta::MetabolismFields)
+		| (FMOMedicalDelta::VitalsFields & FMOMedicalDelta::MentalFields)
+		| (FMOMedicalDelta::MetabolismFields & FMOMedicalDelta::MentalFields), 0);
+	TestTrue(TEXT("Shock is a mental field"), (FMOMedicalDelta::MentalFields & FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::Shock)) != 0);
+	TestTrue(TEXT("Digestion is a metabolism field"), (FMOMedicalDelta::MetabolismFields & FMOMedicalDelta::FieldBit(EMOMedicalDeltaField::Digestion)) != 0);
+
+	return true;
+}
+
+//=============================================================================
+// Net Serialization Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOVitals_NetSerialize_QuantizedRoundTrip,
+	"MOFramework.Medical.Vitals.NetSerializeQuantizedRoundTrip",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOVitals_NetSerialize_QuantizedRoundTrip::RunTest(const FString& Parameters)
+{
+	FMOVitalSigns Source;
+	Source.BloodVolume = 3712.4f;
+	Source.HeartRate = 131.7f;
+	Source.SystolicBP = 87.3f;
+	Source.DiastolicBP = 52.9f;
+	Source.RespiratoryRate = 27.4f;
+	Source.SpO2 = 91.26f;
+	Source.BodyTemperature = 38.63f;
+	Source.BloodGlucose = 64.2f;
+
+	bool bSuccess = false;
+	FBitWriter Writer(0, true);
+	Source.NetSerialize(Writer, nullptr, bSuccess);
+	TestTrue(TEXT("Write succeeded"), bSuccess);
+	TestTrue(TEXT("Packed well below ten full floats"), Writer.GetNumBits() < 10 * 32 / 2);
+
+	FMOVitalSigns Result;
+	FBitReader Reader(Writer.GetData(), Writer.GetNumBits());
+	Result.NetSerialize(Reader, nullptr, bSuccess);
+	TestTrue(TEXT("Read succeeded"), bSuccess && !Reader.IsError());
+
+	TestTrue(TEXT("Blood volume within quantum"), FMath::IsNearlyEqual(Result.BloodVolume, Source.BloodVolume, 2.5f));
+	TestTrue(TEXT("Heart rate within quantum"), FMath::IsNearlyEqual(Result.HeartRate, Source.HeartRate, 0.3f));
+	TestTrue(TEXT("Systolic within quantum"), FMath::IsNearlyEqual(Result.SystolicBP, Source.SystolicBP, 0.3f));
+	TestTrue(TEXT("Diastolic within quantum"), FMath::IsNearlyEqual(Result.DiastolicBP, Source.DiastolicBP, 0.2f));
+	TestTrue(TEXT("Respiratory rate within quantum"), FMath::IsNearlyEqual(Result.RespiratoryRate, Source.RespiratoryRate, 0.25f));
+	TestTrue(TEXT("SpO2 within quantum"), FMath::IsNearlyEqual(Result.SpO2, Source.SpO2, 0.1f));
+	TestTrue(TEXT("Temperature within quantum"), FMath::IsNearlyEqual(Result.BodyTemperature, Source.BodyTemperature, 0.025f));
+	TestTrue(TEXT("Glucose within quantum"), FMath::IsNearlyEqual(Result.BloodGlucose, Source.BloodGlucose, 0.6f));
+
+	// Body part: enums exact, HP relative to MaxHP
+	FMOBodyPartState Part;
+	Part.PartType = EMOBodyPartType::Head;
+	Part.Status = EMOBodyPartStatus::Injured;
+	Part.MaxHP = 40.0f;
+	Part.CurrentHP = 13.3f;
+
+	FBitWriter PartWriter(0, true);
+	Part.NetSerialize(PartWriter, nullptr, bSuccess);
+
+	FMOBodyPartState PartResult;
+	FBitReader PartReader(PartWriter.GetData(), PartWriter.GetNumBits());
+	PartResult.NetSerialize(PartReader, nullptr, bSuccess);
+
+	TestTrue(TEXT("Part type exact"), PartResult.PartType == Part.PartType);
+	TestTrue(TEXT("Status exact"), PartResult.Status == Part.Status);
+	TestTrue(TEXT("Max HP within quantum"), FMath::IsNearlyEqual(PartResult.MaxHP, Part.MaxHP, 0.25f));
+	TestTrue(TEXT("HP percent within quantum"), FMath::IsNearlyEqual(PartResult.GetHPPercent(), Part.GetHPPercent(), 0.002f));
+
+	return true;
+}
+
 //=============================================================================
 // Vitals Component Tests - Blood Volume
 //=============================================================================
@@ -935,6 +1105,236 @@ bool FMOAnatomy_GetTotalPainLevel_SumsWounds::RunTest(const FString& Parameters)
 	return true;
 }
 
+//=============================================================================
+// Anatomy Component Tests - Aggregates
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOAnatomy_Aggregates_TrackReplicatedWounds,
+	"MOFramework.Medical.Anatomy.Aggregates.TrackReplicatedWounds",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOAnatomy_Aggregates_TrackReplicatedWounds::RunTest(const FString& Parameters)
+{
+	// Drive the client-side FastArray callbacks directly (no authority needed)
+	UMOAnatomyComponent* Anatomy = NewObject<UMOAnatomyComponent>();
+	TArray<FMOWound>& Items = Anatomy->Wounds.Wounds;
+
+	FMOWound Cut;
+	Cut.BodyPart = EMOBodyPartType::ThighLeft;
+	Cut.WoundType = EMOWoundType::Laceration;
+	Cut.Severity = 40.0f;
+	Cut.BleedRate = 2.0f;
+
+	FMOWound Stab;
+	Stab.BodyPart = EMOBodyPartType::ThighLeft;
+	Stab.WoundType = EMOWoundType::Puncture;
+	Stab.Severity = 20.0f;
+	Stab.BleedRate = 1.5f;
+
+	Items.Add(Cut);
+	Items.Add(Stab);
+	TArray<int32> Indices = {0, 1};
+	Anatomy->Wounds.PostReplicatedAdd(Indices, Items.Num());
+
+	TestEqual(TEXT("Bleed sums both wounds"), Anatomy->GetTotalBleedRate(), 3.5f, 0.001f);
+	TestEqual(TEXT("Pain sums both wounds"), Anatomy->GetTotalPainLevel(), (40.0f + 20.0f) * 0.3f, 0.001f);
+	TestEqual(TEXT("Two wounds on left thigh"), Anatomy->GetWoundCountOnPart(EMOBodyPartType::ThighLeft), 2);
+	TestEqual(TEXT("No wounds elsewhere"), Anatomy->GetWoundCountOnPart(EMOBodyPartType::Head), 0);
+	TestEqual(TEXT("Nothing infected"), Anatomy->GetInfectedWoundCount(), 0);
+
+	// Change: the stab gets infected and is bandaged down
+	Items[1].bIsInfected = true;
+	Items[1].InfectionSeverity = 50.0f;
+	Items[1].BleedRate = 0.5f;
+	TArray<int32> Changed = {1};
+	Anatomy->Wounds.PostReplicatedChange(Changed, Items.Num());
+
+	TestEqual(TEXT("Bleed reflects change"), Anatomy->GetTotalBleedRate(), 2.5f, 0.001f);
+	TestEqual(TEXT("Pain includes infection"), Anatomy->GetTotalPainLevel(), (40.0f + 20.0f) * 0.3f + 50.0f * 0.2f, 0.001f);
+	TestEqual(TEXT("One infected wound"), Anatomy->GetInfectedWoundCount(), 1);
+
+	// Remove the cut
+	TArray<int32> Removed = {0};
+	Anatomy->Wounds.PreReplicatedRemove(Removed, 1);
+	Items.RemoveAt(0);
+
+	TestEqual(TEXT("Bleed drops removed wound"), Anatomy->GetTotalBleedRate(), 0.5f, 0.001f);
+	TestEqual(TEXT("One wound left on thigh"), Anatomy->GetWoundCountOnPart(EMOBodyPartType::ThighLeft), 1);
+
+	// Remove the last one
+	Removed = {0};
+	Anatomy->Wounds.PreReplicatedRemove(Removed, 0);
+	Items.RemoveAt(0);
+
+	TestEqual(TEXT("Bleed back to zero"), Anatomy->GetTotalBleedRate(), 0.0f);
+	TestEqual(TEXT("Pain back to zero"), Anatomy->GetTotalPainLevel(), 0.0f);
+	TestEqual(TEXT("Infected count back to zero"), Anatomy->GetInfectedWoundCount(), 0);
+
+	return true;
+}
+
+//=============================================================================
+// Anatomy Component Tests - Event Scheduling
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOAnatomy_EventScheduling_SamplingAndStages,
+	"MOFramework.Medical.Anatomy.EventScheduling.SamplingAndStages",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOAnatomy_EventScheduling_SamplingAndStages::RunTest(const FString& Parameters)
+{
+	// Exponential inverse CDF
+	TestEqual(TEXT("U=0 fires immediately"), UMOAnatomyComponent::SampleTimeToEvent(0.5f, 0.0f), 0.0f);
+	TestEqual(TEXT("U=1-1/e gives the mean"), UMOAnatomyComponent::SampleTimeToEvent(0.5f, 1.0f - 1.0f / UE_EULERS_NUMBER), 2.0f, 0.001f);
+	TestTrue(TEXT("Zero rate never fires"), UMOAnatomyComponent::SampleTimeToEvent(0.0f, 0.5f) >= TNumericLimits<float>::Max());
+
+	// Sample mean should match 1/rate (same hazard as the per-tick roll)
+	const float Rate = 0.05f;
+	FRandomStream Stream(4242);
+	double Sum = 0.0;
+	const int32 NumSamples = 20000;
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		Sum += UMOAnatomyComponent::SampleTimeToEvent(Rate, Stream.FRand());
+	}
+	const double Mean = Sum / NumSamples;
+	AddInfo(FString::Printf(TEXT("Mean time to infection at rate %.3f/s: %.2fs (expected %.2fs)"), Rate, Mean, 1.0 / Rate));
+	TestEqual(TEXT("Sample mean ~ 1/rate"), static_cast<float>(Mean), 1.0f / Rate, 0.05f / Rate);
+
+	// Stage boundaries
+	TestEqual(TEXT("Ascending mid-stage"), UMOAnatomyComponent::GetNextStageBoundary(25.0f, 10.0f, false), 30.0f);
+	TestEqual(TEXT("Ascending on boundary moves on"), UMOAnatomyComponent::GetNextStageBoundary(30.0f, 10.0f, false), 40.0f);
+	TestEqual(TEXT("Ascending just below boundary moves on"), UMOAnatomyComponent::GetNextStageBoundary(29.9999f, 10.0f, false), 40.0f);
+	TestEqual(TEXT("Ascending clamps to 100"), UMOAnatomyComponent::GetNextStageBoundary(95.0f, 30.0f, false), 100.0f);
+	TestEqual(TEXT("Descending mid-stage"), UMOAnatomyComponent::GetNextStageBoundary(25.0f, 10.0f, true), 20.0f);
+	TestEqual(TEXT("Descending on boundary moves on"), UMOAnatomyComponent::GetNextStageBoundary(20.0f, 10.0f, true), 10.0f);
+	TestEqual(TEXT("Descending clamps to 0"), UMOAnatomyComponent::GetNextStageBoundary(5.0f, 10.0f, true), 0.0f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOAnatomy_EventScheduling_SerialSurvivesSaveLoad,
+	"MOFramework.Medical.Anatomy.EventScheduling.SerialSurvivesSaveLoad",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOAnatomy_EventScheduling_SerialSurvivesSaveLoad::RunTest(const FString& Parameters)
+{
+	UMOMedicalDatabaseSettings* Settings = GetMutableDefault<UMOMedicalDatabaseSettings>();
+	TGuardValue<bool> UseScheduler(Settings->bUseMedicalScheduler, true);
+	TGuardValue<bool> UseEvents(Settings->bUseWoundEventScheduling, true);
+
+	FMOTestWorld World(TEXT("MOAnatomyEventSerialTest"));
+	UMOAnatomyComponent* Anatomy = NewObject<UMOAnatomyComponent>(World.SpawnHost());
+	Anatomy->RegisterComponent();
+	if (!TestTrue(TEXT("Event scheduling active"), Anatomy->IsUsingEventScheduling()))
+	{
+		return false;
+	}
+
+	FMOWound Wound;
+	Wound.BodyPart = EMOBodyPartType::UpperArmLeft;
+	Wound.WoundType = EMOWoundType::Laceration;
+	Wound.Severity = 40.0f;
+	Wound.BleedRate = 2.0f;
+	Wound.InfectionRisk = 20.0f;
+	Anatomy->InflictWound(Wound);
+	Anatomy->AddCondition(EMOConditionType::Infection, EMOBodyPartType::UpperArmLeft, 30.0f);
+
+	const uint32 WoundSerial = Anatomy->Wounds.Wounds[0].EventSerial;
+	const uint32 ConditionSerial = Anatomy->Conditions.Conditions[0].EventSerial;
+
+	FMOAnatomySaveData Save;
+	Anatomy->BuildSaveData(Save);
+	TestTrue(TEXT("Wound serial saved"), Save.Wounds[0].EventSerial == WoundSerial);
+	TestTrue(TEXT("Condition serial saved"), Save.Conditions[0].EventSerial == ConditionSerial);
+
+	// Events queued before the load still carry the old serials; the reloaded entries must move past them
+	Anatomy->ApplySaveDataAuthority(Save);
+	TestTrue(TEXT("Wound serial continues after load"), Anatomy->Wounds.Wounds[0].EventSerial > WoundSerial);
+	TestTrue(TEXT("Condition serial continues after load"), Anatomy->Conditions.Conditions[0].EventSerial > ConditionSerial);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOMedicalRandom_SeedIsDeterministic,
+	"MOFramework.Medical.Random.SeedIsDeterministic",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOMedicalRandom_SeedIsDeterministic::RunTest(const FString& Parameters)
+{
+	const FGuid PawnA(0x11111111, 0x22222222, 0x33333333, 0x44444444);
+	const FGuid PawnB(0x11111111, 0x22222222, 0x33333333, 0x44444445);
+
+	const int32 Seed = FMOMedicalRandom::MakeSeed(PawnA, 7, 1);
+	TestEqual(TEXT("Same inputs give the same seed"), FMOMedicalRandom::MakeSeed(PawnA, 7, 1), Seed);
+	TestNotEqual(TEXT("Different pawn gives a different seed"), FMOMedicalRandom::MakeSeed(PawnB, 7, 1), Seed);
+	TestNotEqual(TEXT("Different world seed gives a different seed"), FMOMedicalRandom::MakeSeed(PawnA, 8, 1), Seed);
+	TestNotEqual(TEXT("Different component salt gives a different seed"), FMOMedicalRandom::MakeSeed(PawnA, 7, 2), Seed);
+
+	// Two streams from the same seed replay the same rolls
+	FRandomStream First(Seed);
+	FRandomStream Second(Seed);
+	bool bIdentical = true;
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		bIdentical &= (First.FRand() == Second.FRand());
+	}
+	TestTrue(TEXT("Streams with the same seed are identical"), bIdentical);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOMedicalRandom_ComponentRolls_FollowIdentityGuid,
+	"MOFramework.Medical.Random.ComponentRollsFollowIdentityGuid",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOMedicalRandom_ComponentRolls_FollowIdentityGuid::RunTest(const FString& Parameters)
+{
+	// Identity GUIDs can only be set on authority, so host the pawns in a throwaway game world.
+	FMOTestWorld World(TEXT("MOMedicalRandomTest"));
+
+	auto SpawnPawn = [&World]()
+	{
+		AActor* Pawn = World.SpawnHost();
+		UMOIdentityComponent* Identity = NewObject<UMOIdentityComponent>(Pawn);
+		UMOMentalStateComponent* Mental = NewObject<UMOMentalStateComponent>(Pawn);
+		Identity->RegisterComponent();
+		Mental->RegisterComponent();
+		Mental->MentalState.StumblingChance = 0.5f;
+		return Mental;
+	};
+
+	auto Roll = [](UMOMentalStateComponent* Mental)
+	{
+		TArray<bool> Rolls;
+		for (int32 i = 0; i < 64; ++i)
+		{
+			Rolls.Add(Mental->RollForStumble());
+		}
+		return Rolls;
+	};
+
+	UMOMentalStateComponent* First = SpawnPawn();
+	UMOMentalStateComponent* Second = SpawnPawn();
+	UMOMentalStateComponent* Other = SpawnPawn();
+
+	// Each pawn got its own GUID at BeginPlay; assigning one afterwards (as loading does) must reseed
+	const FGuid Shared(0x11111111, 0x22222222, 0x33333333, 0x44444444);
+	First->GetOwner()->FindComponentByClass<UMOIdentityComponent>()->SetGuid(Shared);
+	Second->GetOwner()->FindComponentByClass<UMOIdentityComponent>()->SetGuid(Shared);
+	Other->GetOwner()->FindComponentByClass<UMOIdentityComponent>()->SetGuid(FGuid(0x11111111, 0x22222222, 0x33333333, 0x44444445));
+
+	const TArray<bool> FirstRolls = Roll(First);
+	TestEqual(TEXT("Same GUID rolls the same"), Roll(Second), FirstRolls);
+	TestNotEqual(TEXT("Different GUID rolls differently"), Roll(Other), FirstRolls);
+
+	// Reseeding with an unchanged GUID replays the stream from the start
+	First->ReseedRandomStream();
+	TestEqual(TEXT("Reseed restarts the stream"), Roll(First), FirstRolls);
+
+	return true;
+}
+
 //=============================================================================
 // Anatomy Component Tests - Conditions
 //=============================================================================
@@ -2043,4 +2443,90 @@ bool FMOMedical_Boundary_ExtremeGlucose::RunTest(const FString& Parameters)
 	return true;
 }
 
+//=============================================================================
+// Vitals Batch Kernel Tests
+//=============================================================================
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOVitals_BatchKernels_MatchScalar,
+	"MOFramework.Medical.Vitals.BatchKernelsMatchScalar",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOVitals_BatchKernels_MatchScalar::RunTest(const FString& Parameters)
+{
+	// Odd count exercises the padded tail lane
+	const int32 PawnCount = 1023;
+	FRandomStream Stream(12345);
+
+	FMOVitalsBatch Batch;
+	TArray<FMOVitalsDerivationInput> Inputs;
+	for (int32 i = 0; i < PawnCount; ++i)
+	{
+		FMOVitalsDerivationInput In;
+		In.MaxBloodVolume = 5000.0f;
+		In.BloodVolume = Stream.FRandRange(0.0f, 5000.0f);
+		In.BodyTemperature = Stream.FRandRange(26.0f, 43.0f);
+		In.BloodGlucose = Stream.FRandRange(20.0f, 300.0f);
+		In.SpO2 = Stream.FRandRange(40.0f, 100.0f);
+		In.CurrentExertion = Stream.FRandRange(0.0f, 100.0f);
+		In.StressLevel = Stream.FRandRange(0.0f, 100.0f);
+		In.PainLevel = Stream.FRandRange(0.0f, 100.0f);
+		In.Fitness = Stream.FRandRange(0.0f, 100.0f);
+		In.bHasFitness = Stream.FRand() > 0.2f;
+		In.LungMod = (i % 7 == 0) ? -50.0f : ((i % 5 == 0) ? -15.0f : 0.0f);
+
+		Inputs.Add(In);
+		Batch.Add(In);
+	}
+
+	Batch.DeriveAll();
+
+	int32 Mismatches = 0;
+	for (int32 i = 0; i < PawnCount; ++i)
+	{
+		const FMOVitalsDerivationOutput Expected = FMOVitalsKernels::Derive(Inputs[i]);
+		const FMOVitalsDerivationOutput Actual = Batch.GetOutput(i);
+
+		if (Expected.HeartRate != Actual.HeartRate
+			|| Expected.SystolicBP != Actual.SystolicBP
+			|| Expected.DiastolicBP != Actual.DiastolicBP
+			|| Expected.RespiratoryRate != Actual.RespiratoryRate
+			|| Expected.SpO2 != Actual.SpO2)
+		{
+			Mismatches++;
+		}
+	}
+
+	TestEqual(TEXT("Batch results identical to scalar kernels"), Mismatches, 0);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMOVitals_Kernels_BloodPressureFallsWithLoss,
+	"MOFramework.Medical.Vitals.BloodPressureFallsWithLoss",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMOVitals_Kernels_BloodPressureFallsWithLoss::RunTest(const FString& Parameters)
+{
+	FMOVitalsDerivationInput In;
+	In.MaxBloodVolume = 5000.0f;
+
+	// One reading per blood loss class: none, class 1 (20%), class 2 (35%) and class 3 (50%)
+	TArray<float> Systolic;
+	for (const float LossFraction : { 0.0f, 0.2f, 0.35f, 0.5f })
+	{
+		In.BloodVolume = In.MaxBloodVolume * (1.0f - LossFraction);
+		float OutSystolic = 0.0f;
+		float OutDiastolic = 0.0f;
+		FMOVitalsKernels::DeriveBloodPressure(In, OutSystolic, OutDiastolic);
+		Systolic.Add(OutSystolic);
+	}
+
+	TestEqual(TEXT("Full volume keeps baseline systolic"), Systolic[0], 120.0f);
+	TestTrue(TEXT("Class 1 loss lowers systolic"), Systolic[1] < Systolic[0]);
+	TestTrue(TEXT("Class 2 loss lowers it further"), Systolic[2] < Systolic[1]);
+	TestTrue(TEXT("Class 3 loss lowers it further"), Systolic[3] < Systolic[2]);
+
+	return true;
+}
+
 #endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "MOTestInventoryEventRecorder.generated.h"
+
+/**
+ * Records inventory events for tests. Dynamic delegates only bind UFUNCTIONs,
+ * so tests bind these handlers and read the lists back.
+ */
+UCLASS(Transient)
+class UMOTestInventoryEventRecorder : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void HandleSlotContentsChanged(const TArray<int32>& SlotIndices) { SlotBroadcasts.Add(SlotIndices); }
+
+	void Reset() { SlotBroadcasts.Reset(); }
+
+	/** Slot indices of each OnSlotContentsChanged broadcast, in order. */
+	TArray<TArray<int32>> SlotBroadcasts;
+};
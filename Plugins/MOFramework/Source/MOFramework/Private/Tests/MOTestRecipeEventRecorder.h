@@ -0,0 +1,42 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "MOTestRecipeEventRecorder.generated.h"
+
+/**
+ * Records craftability and crafting queue events for tests. Dynamic delegates only bind UFUNCTIONs,
+ * so tests bind these handlers and read the lists back.
+ */
+UCLASS(Transient)
+class UMOTestRecipeEventRecorder : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void HandleBecameCraftable(FName RecipeId) { Gained.Add(RecipeId); }
+
+	UFUNCTION()
+	void HandleNoLongerCraftable(FName RecipeId) { Lost.Add(RecipeId); }
+
+	UFUNCTION()
+	void HandleCraftFailed(FGuid EntryId, FName RecipeId, FGuid PlanId)
+	{
+		FailedRecipes.Add(RecipeId);
+		FailedPlans.Add(PlanId);
+	}
+
+	void Reset()
+	{
+		Gained.Reset();
+		Lost.Reset();
+		FailedRecipes.Reset();
+		FailedPlans.Reset();
+	}
+
+	TArray<FName> Gained;
+	TArray<FName> Lost;
+	TArray<FName> FailedRecipes;
+	TArray<FGuid> FailedPlans;
+};
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Headless game world for tests that need authority, world subsystems or spawned actors.
+ *
+ * The world gets its own context and has begun play when the constructor returns. Both are
+ * torn down when the fixture goes out of scope, so tests can return early on a failed check.
+ * The world is never ticked; tests advance time themselves (e.g. World->TimeSeconds).
+ */
+class FMOTestWorld
+{
+public:
+	explicit FMOTestWorld(const TCHAR* Name)
+	{
+		World = UWorld::CreateWorld(EWorldType::Game, false, Name);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+	}
+
+	~FMOTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+
+	UE_NONCOPYABLE(FMOTestWorld);
+
+	UWorld* Get() const { return World; }
+	UWorld* operator->() const { return World; }
+	operator UWorld*() const { return World; }
+
+	/** Spawn a bare actor to host components under test. */
+	AActor* SpawnHost(const FVector& Location = FVector::ZeroVector) const
+	{
+		return World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Location));
+	}
+
+private:
+	UWorld* World = nullptr;
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
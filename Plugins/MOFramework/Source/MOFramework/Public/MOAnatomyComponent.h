@@ -88,6 +88,10 @@ struct MOFRAMEWORK_API FMOWoundSaveEntry
 
 	UPROPERTY()
 	float TimeSinceInflicted = 0.0f;
+
+	/** Last event serial, so events queued before a load cannot match the reloaded wound. */
+	UPROPERTY()
+	uint32 EventSerial = 0;
 };
 
 USTRUCT(BlueprintType)
@@ -112,6 +116,10 @@ struct MOFRAMEWORK_API FMOConditionSaveEntry
 
 	UPROPERTY()
 	bool bIsTreated = false;
+
+	/** Last event serial, so events queued before a load cannot match the reloaded condition. */
+	UPROPERTY()
+	uint32 EventSerial = 0;
 };
 
 USTRUCT(BlueprintType)
@@ -142,6 +150,8 @@ class MOFRAMEWORK_API UMOAnatomyComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend class UMOMedicalSchedulerSubsystem;
+
 public:
 	UMOAnatomyComponent();
 
@@ -301,6 +311,18 @@ public:
 	UFUNCTION(BlueprintPure, Category="MO|Anatomy|Query")
 	float GetTotalPainLevel() const;
 
+	/**
+	 * Get the number of wounds on a body part.
+	 */
+	UFUNCTION(BlueprintPure, Category="MO|Anatomy|Query")
+	int32 GetWoundCountOnPart(EMOBodyPartType Part) const;
+
+	/**
+	 * Get the number of infected wounds.
+	 */
+	UFUNCTION(BlueprintPure, Category="MO|Anatomy|Query")
+	int32 GetInfectedWoundCount() const { return Aggregates.InfectedWoundCount; }
+
 	/**
 	 * Check if a body part is functional.
 	 */
@@ -371,6 +393,27 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Anatomy|Save")
 	bool ApplySaveDataAuthority(const FMOAnatomySaveData& InSaveData);
 
+	// ============================================================================
+	// EVENT SCHEDULING
+	// ============================================================================
+
+	/** Whether wounds and conditions advance by scheduled events rather than every tick. */
+	UFUNCTION(BlueprintPure, Category="MO|Anatomy|Query")
+	bool IsUsingEventScheduling() const { return bUseEventScheduling; }
+
+	/**
+	 * Reseed this pawn's random stream from its identity GUID and MedicalRandomSeed.
+	 * Done at BeginPlay and whenever the owner's identity GUID is assigned afterwards.
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Anatomy")
+	void ReseedRandomStream();
+
+	/** Seconds until a constant-hazard event fires, from a uniform sample in [0, 1). */
+	static float SampleTimeToEvent(float RatePerSecond, float UniformSample);
+
+	/** Next multiple of StageSize above Value (below if bDescending), clamped to [0, 100]. */
+	static float GetNextStageBoundary(float Value, float StageSize, bool bDescending);
+
 	// ============================================================================
 	// REPLICATION CALLBACKS (called by FastArray)
 	// ============================================================================
@@ -387,6 +430,7 @@ protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 
 private:
 	// ============================================================================
@@ -417,6 +461,49 @@ private:
 	/** Remaining time on death timer. */
 	float DeathTimerRemaining = 0.0f;
 
+	/** True when registered with the scheduler and bUseWoundEventScheduling is set. */
+	bool bUseEventScheduling = false;
+
+	/** Per-pawn stream for infection rolls (see FMOMedicalRandom). */
+	FRandomStream RandomStream;
+
+	/** Reseed when the owner's identity GUID is set after BeginPlay (e.g. loading). */
+	UFUNCTION()
+	void HandleIdentityGuidAvailable(const FGuid& StableGuid);
+
+	/** Stage size for event scheduling, captured at BeginPlay. */
+	float EventStageSize = 10.0f;
+
+	/** What one wound currently contributes to Aggregates, so it can be taken back out. */
+	struct FWoundContribution
+	{
+		float BleedRate = 0.0f;
+		float Pain = 0.0f;
+		EMOBodyPartType BodyPart = EMOBodyPartType::None;
+		bool bIsInfected = false;
+	};
+
+	/**
+	 * Running totals behind the query API, kept up to date on every wound/condition
+	 * add, change and remove (authority paths and FastArray callbacks alike).
+	 */
+	struct FAggregates
+	{
+		float TotalBleedRate = 0.0f;
+
+		/** Unclamped; GetTotalPainLevel clamps to 0-100. */
+		float TotalPain = 0.0f;
+
+		int32 InfectedWoundCount = 0;
+		int32 WoundCountByPart[static_cast<int32>(EMOBodyPartType::MAX)] = {};
+		int32 ConditionCountByType[static_cast<int32>(EMOConditionType::MAX)] = {};
+	};
+
+	FAggregates Aggregates;
+
+	/** Contribution currently applied for each wound, by WoundId. */
+	TMap<FGuid, FWoundContribution> WoundContributions;
+
 	/** Cached reference to vitals component. */
 	UPROPERTY(Transient)
 	TObjectPtr<UMOVitalsComponent> CachedVitalsComp;
@@ -438,12 +525,91 @@ private:
 	/** Periodic tick for wound healing, infection, etc. */
 	void TickAnatomy();
 
+	/** Advance wounds and conditions by DeltaSeconds of unscaled time (used by the scheduler for LOD steps). */
+	void AdvanceSimulation(float DeltaSeconds);
+
 	/** Process wound healing and infection. */
 	void ProcessWound(FMOWound& Wound, float DeltaTime);
 
 	/** Process condition progression. */
 	void ProcessCondition(FMOCondition& Condition, float DeltaTime);
 
+	/** Healing progress per scaled second for a wound's current treatment state. */
+	float GetWoundHealRate(const FMOWound& Wound) const;
+
+	/** Infection severity growth per scaled second. */
+	static float GetWoundInfectionGrowthRate(const FMOWound& Wound);
+
+	/** Signed severity change per scaled second for a condition. */
+	static float GetConditionSeverityRate(const FMOCondition& Condition);
+
+	/** Pain one wound contributes before clamping. */
+	float GetWoundPain(const FMOWound& Wound) const;
+
+	/** Add a wound to Aggregates, replacing any contribution already recorded for it. */
+	void AddWoundContribution(const FMOWound& Wound);
+
+	/** Take a wound's recorded contribution back out of Aggregates. */
+	void RemoveWoundContribution(const FGuid& WoundId);
+
+	void AddConditionContribution(const FMOCondition& Condition);
+	void RemoveConditionContribution(const FMOCondition& Condition);
+
+	/** Clear Aggregates and all recorded contributions. */
+	void ResetAggregates();
+
+	/** Bookkeeping for a wound just appended to Wounds. */
+	void TrackWoundAdded(FMOWound& Wound);
+
+	/** Bookkeeping for a wound about to be removed from Wounds. */
+	void TrackWoundRemoved(const FMOWound& Wound);
+
+	/** Bring a wound up to date before its bleed/infection/treatment state is edited. */
+	void BeginWoundChange(FMOWound& Wound);
+
+	/** Re-account and reschedule a wound after editing, and mark it dirty. */
+	void EndWoundChange(FMOWound& Wound);
+
+	/** Bookkeeping for a condition just appended to Conditions. */
+	void TrackConditionAdded(FMOCondition& Condition);
+
+	/** Bookkeeping for a condition about to be removed from Conditions. */
+	void TrackConditionRemoving(const FMOCondition& Condition);
+
+	/** Bookkeeping after a condition was removed. */
+	void TrackConditionRemoved(EMOConditionType RemovedType);
+
+	// ============================================================================
+	// EVENT SCHEDULING INTERNALS
+	// ============================================================================
+
+	/** Called by the scheduler when a queued wound/condition transition comes due. */
+	void HandleScheduledEvent(const FGuid& TargetId, bool bIsCondition, uint32 Serial);
+
+	/** Clock used for scheduled events (world time, seconds). */
+	double GetEventTime() const;
+
+	/** Advance a wound's time-dependent fields from its EventSyncTime to Now. */
+	void SyncWoundState(FMOWound& Wound, double Now) const;
+
+	/** Advance a condition's time-dependent fields from its EventSyncTime to Now. */
+	void SyncConditionState(FMOCondition& Condition, double Now) const;
+
+	/** Compute and queue a wound's next transition. */
+	void ScheduleWoundEvent(FMOWound& Wound, double Now);
+
+	/** Compute and queue a condition's next transition. */
+	void ScheduleConditionEvent(FMOCondition& Condition, double Now);
+
+	/** Bring every wound and condition up to date and reschedule it. */
+	void ScheduleAllEvents();
+
+	/** Apply the transitions a wound has reached by Now. */
+	void ProcessWoundEvent(FMOWound& Wound, double Now);
+
+	/** Apply the transitions a condition has reached by Now. */
+	void ProcessConditionEvent(FMOCondition& Condition, double Now);
+
 	/** Check for instant death conditions. */
 	void CheckDeathConditions(EMOBodyPartType DestroyedPart);
 
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "MORecipeDefinitionRow.h"
+#include "MOCraftabilityComponent.generated.h"
+
+class UMOCraftingSubsystem;
+class UMOInventoryComponent;
+class UMOKnowledgeComponent;
+class UMOSkillsComponent;
+struct FMOInspectionResult;
+struct FMORecipeIndex;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMOOnRecipeCraftabilityChanged, FName, RecipeId);
+
+/**
+ * Per-crafter cache of which recipes can be crafted right now at one station.
+ *
+ * Holds one craftable bit per recipe and keeps it current from deltas instead of recomputing
+ * GetCraftableRecipes: an inventory total change re-checks only the recipes consuming that item, a skill
+ * level change only the recipes governed by that skill, learned knowledge only the recipes requiring it.
+ * Queries are bit lookups, so recipe UI can poll them every frame.
+ *
+ * Finds the owner's inventory, skills and knowledge components on BeginPlay unless BindComponents was
+ * called first. Skill and knowledge arrays replicate without notifies, so on clients call RefreshAll after
+ * they change (inventory deltas are tracked on every net mode).
+ */
+UCLASS(ClassGroup=(MO), meta=(BlueprintSpawnableComponent))
+class MOFRAMEWORK_API UMOCraftabilityComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UMOCraftabilityComponent();
+
+	/** A recipe became craftable (ingredients arrived, skill reached, knowledge learned). */
+	UPROPERTY(BlueprintAssignable, Category="MO|Crafting|Events")
+	FMOOnRecipeCraftabilityChanged OnRecipeBecameCraftable;
+
+	/** A recipe stopped being craftable. */
+	UPROPERTY(BlueprintAssignable, Category="MO|Crafting|Events")
+	FMOOnRecipeCraftabilityChanged OnRecipeNoLongerCraftable;
+
+	/** Station whose recipes are tracked (hand recipes are always included). */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting")
+	void SetStation(EMOCraftingStation NewStation);
+
+	UFUNCTION(BlueprintPure, Category="MO|Crafting")
+	EMOCraftingStation GetStation() const { return Station; }
+
+	/** Track these components instead of the owner's. Any may be null. Re-evaluates everything. */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting")
+	void BindComponents(UMOInventoryComponent* InInventory, UMOSkillsComponent* InSkills, UMOKnowledgeComponent* InKnowledge);
+
+	UFUNCTION(BlueprintPure, Category="MO|Crafting")
+	bool IsRecipeCraftable(FName RecipeId) const;
+
+	/** Craftable recipes in DataTable order, as UMOCraftingSubsystem::GetCraftableRecipes would return them. */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting")
+	void GetCraftableRecipes(TArray<FName>& OutRecipeIds) const;
+
+	UFUNCTION(BlueprintPure, Category="MO|Crafting")
+	int32 GetCraftableRecipeCount() const { return CraftableCount; }
+
+	/** Re-evaluate every tracked recipe and broadcast what changed. */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting")
+	void RefreshAll();
+
+protected:
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Station whose recipes are tracked. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="MO|Crafting")
+	EMOCraftingStation Station = EMOCraftingStation::None;
+
+private:
+	UFUNCTION()
+	void HandleItemTotalsChanged(const TArray<FName>& ItemDefinitionIds);
+
+	UFUNCTION()
+	void HandleSkillLevelUp(FName SkillId, int32 OldLevel, int32 NewLevel);
+
+	UFUNCTION()
+	void HandleKnowledgeLearned(FName KnowledgeId, FName FromItemId);
+
+	UFUNCTION()
+	void HandleItemInspected(FName ItemDefinitionId, const FMOInspectionResult& Result);
+
+	void HandleRecipeIndexReset(const FMORecipeIndex& OldIndex);
+
+	void UnbindComponents();
+
+	/** Re-check the given recipe positions (any order, duplicates allowed) and broadcast the flips. */
+	void ReevaluatePositions(TArray<int32>& Positions);
+
+	/** Current craftability of one recipe, per UMOCraftingSubsystem. */
+	bool EvaluatePosition(const FMORecipeIndex& Index, int32 Position) const;
+
+	/** True when the bits line up with the current recipe index. */
+	bool IsTracking(const FMORecipeIndex& Index) const { return Craftable.Num() > 0 && Craftable.Num() == Index.Rows.Num(); }
+
+	void BroadcastChanges(const TArray<FName>& Gained, const TArray<FName>& Lost);
+
+	TWeakObjectPtr<UMOInventoryComponent> Inventory;
+	TWeakObjectPtr<UMOSkillsComponent> Skills;
+	TWeakObjectPtr<UMOKnowledgeComponent> Knowledge;
+	TWeakObjectPtr<UMOCraftingSubsystem> CraftingSubsystem;
+
+	/** Per recipe position: usable at Station / craftable right now. */
+	TBitArray<> InStation;
+	TBitArray<> Craftable;
+	int32 CraftableCount = 0;
+
+	/** What was craftable when the recipe index was dropped, so the rebuild reports only real changes. */
+	TArray<FName> CraftableBeforeIndexReset;
+	bool bIndexWasReset = false;
+
+	FDelegateHandle RecipeIndexResetHandle;
+};
@@ -3,12 +3,39 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "MOCraftingTypes.h"
+#include "MOCraftingSubsystem.h"
 #include "MOCraftingQueueComponent.generated.h"
 
-class UMOCraftingSubsystem;
+class UMOCraftingSchedulerSubsystem;
 class UMOInventoryComponent;
 class UMORecipeDiscoveryComponent;
 
+/** Plan membership of one queued entry, as saved. */
+USTRUCT(BlueprintType)
+struct FMOCraftingPlanEntrySaveData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	FGuid EntryId;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	FGuid PlanId;
+};
+
+/** Which queued entries belong to which EnqueueCraftPlan plan; saved beside FMOCraftingQueueSaveData. */
+USTRUCT(BlueprintType)
+struct FMOCraftingQueuePlanSaveData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	TArray<FMOCraftingPlanEntrySaveData> PlanEntries;
+};
+
+/** A craft could not be carried out when it came due (its ingredients were gone). PlanId is invalid outside a plan. */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FMOOnCraftFailedSignature, FGuid, EntryId, FName, RecipeId, FGuid, PlanId);
+
 /**
  * Component that manages a per-pawn crafting queue with timed progression.
  *
@@ -17,6 +44,13 @@ class UMORecipeDiscoveryComponent;
  * - Offline progress calculation when loading a save
  * - Background crafting (continues when UI is closed)
  * - Queue management with cancel/refund support
+ *
+ * Craft time is simulation time (UMOSimulationClockSubsystem): it stops while the game is paused, follows
+ * time dilation and the clock's time scale, and jumps with sleep fast-forwards. Live wakes, pausing and
+ * offline catch-up on load all advance the queue through AdvanceQueueByTime.
+ *
+ * In game worlds an active queue does not tick: UMOCraftingSchedulerSubsystem wakes it when its current
+ * craft completes or its next progress update is due. Elsewhere it falls back to component tick.
  */
 UCLASS(ClassGroup=(MO), meta=(BlueprintSpawnableComponent))
 class MOFRAMEWORK_API UMOCraftingQueueComponent : public UActorComponent
@@ -40,6 +74,13 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="MO|Crafting|Queue")
 	FMOOnCraftCancelledSignature OnCraftCancelled;
 
+	/**
+	 * Broadcast when a craft fails on completion. The failed entry is dropped, and so are the later steps
+	 * of its plan (each is also reported through OnCraftCancelled, without refund).
+	 */
+	UPROPERTY(BlueprintAssignable, Category="MO|Crafting|Queue")
+	FMOOnCraftFailedSignature OnCraftFailed;
+
 	/** Broadcast when the queue changes (add, remove, reorder). */
 	UPROPERTY(BlueprintAssignable, Category="MO|Crafting|Queue")
 	FMOOnCraftQueueChangedSignature OnQueueChanged;
@@ -56,6 +97,31 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Queue")
 	bool EnqueueCraft(FName RecipeId, int32 Count = 1, EMOCraftingStation Station = EMOCraftingStation::None);
 
+	/**
+	 * Plan everything needed to make Quantity more of an item (see UMOCraftingSubsystem::PlanCraft), using
+	 * only recipes the owner's knowledge and skills allow, and enqueue the steps in dependency order.
+	 * Intermediates do not exist yet at enqueue time, so plan steps consume their ingredients when each craft
+	 * completes instead of upfront. The steps share OutPlan.PlanId; if one fails on completion (materials used
+	 * elsewhere meanwhile), the rest of the plan is cancelled.
+	 * @param ItemDefinitionId Item to produce
+	 * @param Quantity How many more to produce
+	 * @param Station Station type being used
+	 * @param OutPlan The plan that was (or could not be) enqueued
+	 * @return True if the plan was complete and every step was enqueued
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Queue")
+	bool EnqueueCraftPlan(FName ItemDefinitionId, int32 Quantity, EMOCraftingStation Station, FMOCraftingPlan& OutPlan);
+
+	/**
+	 * Enqueue a job handed out by a shared station queue (see UMOCraftingSchedulerSubsystem::SubmitStationJob).
+	 * Each craft consumes its ingredients from MaterialInventory when it completes and delivers its outputs
+	 * there. The inventory binding is saved by the scheduler and restored when this queue's save data loads.
+	 */
+	bool EnqueueStationJob(FName RecipeId, int32 Count, EMOCraftingStation Station, UMOInventoryComponent* MaterialInventory);
+
+	/** Material inventory of each entry taken from a station queue, by entry id (server only). */
+	const TMap<FGuid, TWeakObjectPtr<UMOInventoryComponent>>& GetStationEntryInventories() const { return EntryInventories; }
+
 	/**
 	 * Cancel a specific craft in the queue.
 	 * @param EntryId The queue entry to cancel
@@ -147,10 +213,24 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Queue")
 	bool ApplySaveData(const FMOCraftingQueueSaveData& InSaveData, bool bCalculateOfflineProgress = true);
 
+	/** Save which queued entries belong to a plan, so a failed step still cancels the rest of its plan after a load. */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Queue")
+	void BuildPlanSaveData(FMOCraftingQueuePlanSaveData& OutSaveData) const;
+
+	/**
+	 * Hold saved plan membership until ApplySaveData loads the entries. Apply before ApplySaveData, so a plan
+	 * step that fails during offline progress cancels the rest of its plan.
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Queue")
+	void ApplyPlanSaveData(const FMOCraftingQueuePlanSaveData& InSaveData);
+
 	/** Clear the entire queue without refunds. */
 	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Queue")
 	void ClearQueue();
 
+	/** Scheduler callback: advance to simulation time Now, publish progress, book the next wake. */
+	void HandleSchedulerWake(double Now);
+
 	// --- Configuration ---
 
 	/** How often to update progress (in seconds). Lower = smoother progress bars but more overhead. */
@@ -165,6 +245,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Crafting|Queue")
 	bool bAllowBackgroundCrafting = true;
 
+	/** Time scale multiplier (1.0 = simulation time). Applied on top of the simulation clock's scale. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Crafting|Queue", meta=(ClampMin="0.01"))
+	float TimeScaleMultiplier = 1.0f;
+
 protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -174,26 +258,52 @@ protected:
 private:
 	// --- Internal Methods ---
 
-	/** Process crafting progress. Called by tick or timer. */
-	void ProcessCraftingTick(float DeltaTime);
+	/** Append an entry and mark the queue dirty. Callers broadcast and start crafting. */
+	FMOCraftingQueueEntry& AddQueueEntry(FName RecipeId, int32 Count, EMOCraftingStation Station, bool bIngredientsConsumed);
 
 	/** Complete the current craft and start the next one. */
 	void CompletCurrentCraft();
 
+	/** Drop the current entry after a failed craft, along with the rest of its plan. */
+	void FailCurrentCraft();
+
+	/** Advance the queue by the simulation time since the last advance. */
+	void AdvanceToTime(double Now);
+
+	/** Replicate and broadcast the current craft's progress. */
+	void PublishProgress(double Now);
+
+	/** Duration of the front entry's craft, resolved once per entry. */
+	float GetCurrentCraftDuration() const;
+
+	/** Book the next wake with the scheduler (or enable the tick fallback), or drop it when idle. */
+	void ScheduleNextWake();
+
+	/** Inventory an entry crafts from and into. */
+	UMOInventoryComponent* GetInventoryForEntry(const FMOCraftingQueueEntry& Entry) const;
+
+	double GetSimTime() const;
+
+	/** Simulation seconds per world second (1 without a clock). */
+	float GetClockTimeScale() const;
+
 	/** Consume ingredients for a craft. Returns true if successful. */
 	bool ConsumeIngredientsForCraft(FName RecipeId, int32 Count);
 
 	/** Refund ingredients for a cancelled craft. */
 	void RefundIngredientsForCraft(FName RecipeId, int32 Count);
 
-	/** Calculate progress based on real time elapsed. */
-	float CalculateProgressFromTime(const FMOCraftingQueueEntry& Entry, float CraftDuration) const;
+	/** Progress of the current craft at simulation time Now. */
+	float CalculateProgressFromTime(double Now) const;
 
 	/** Get the craft duration for a recipe (with tool quality modifiers). */
 	float GetEffectiveCraftDuration(FName RecipeId) const;
 
-	/** Advance queue by elapsed time (for offline progress). */
-	void AdvanceQueueByTime(float ElapsedSeconds);
+	/**
+	 * Advance the queue by elapsed simulation time, completing crafts as they finish (live wakes and
+	 * offline progress alike). TimeScaleMultiplier is applied.
+	 */
+	void AdvanceQueueByTime(double ElapsedSeconds);
 
 	/** Cache component references. */
 	void CacheComponents();
@@ -207,12 +317,30 @@ private:
 	UPROPERTY(Replicated)
 	bool bIsCraftingActive = false;
 
-	/** Real-world timestamp when current craft started (for accurate time tracking). */
-	UPROPERTY()
-	FDateTime CurrentCraftStartTime;
+	/** Simulation time the front entry's Progress is accounted up to. */
+	double LastAdvanceTime = 0.0;
+
+	/** Simulation time of the last replicated progress update. */
+	double LastProgressUpdateTime = 0.0;
+
+	/** Simulation time of the next booked wake (completion or progress update). */
+	double NextWakeTime = 0.0;
 
-	/** Accumulated time since last progress update. */
-	float AccumulatedDeltaTime = 0.0f;
+	/** True while this instance advances the queue over time (a replicated bIsCraftingActive alone is not enough). */
+	bool bAdvancingTime = false;
+
+	/** Entry CachedCraftDuration was resolved for; repeats of one entry share it. */
+	mutable FGuid CachedDurationEntryId;
+	mutable float CachedCraftDuration = 0.0f;
+
+	/** Material inventory of entries taken from a station queue (server only, saved by the scheduler). */
+	TMap<FGuid, TWeakObjectPtr<UMOInventoryComponent>> EntryInventories;
+
+	/** Plan of entries enqueued by EnqueueCraftPlan, by entry id (server only). */
+	TMap<FGuid, FGuid> EntryPlanIds;
+
+	/** Plan ids from ApplyPlanSaveData, waiting for ApplySaveData to load their entries. */
+	TMap<FGuid, FGuid> RestoredEntryPlanIds;
 
 	// Cached component references
 	UPROPERTY()
@@ -223,4 +351,7 @@ private:
 
 	UPROPERTY()
 	TWeakObjectPtr<UMORecipeDiscoveryComponent> CachedDiscovery;
+
+	UPROPERTY()
+	TWeakObjectPtr<UMOCraftingSchedulerSubsystem> CachedScheduler;
 };
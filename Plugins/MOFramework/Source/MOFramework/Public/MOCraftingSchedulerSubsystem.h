@@ -0,0 +1,241 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MORecipeDefinitionRow.h"
+#include "MOCraftingSchedulerSubsystem.generated.h"
+
+class UMOCraftingQueueComponent;
+class UMOInventoryComponent;
+class UMOSimulationClockSubsystem;
+
+/** A station job waiting for a worker, as saved. */
+USTRUCT(BlueprintType)
+struct FMOStationJobSaveData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	FGuid JobId;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	FName RecipeId;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	int32 Count = 1;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	EMOCraftingStation Station = EMOCraftingStation::None;
+
+	/** Identity GUID of the actor owning the material inventory. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	FGuid MaterialOwnerGuid;
+};
+
+/** Material inventory of a worker's queue entry that came from a station job, as saved. */
+USTRUCT(BlueprintType)
+struct FMOStationEntrySaveData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	FGuid EntryId;
+
+	/** Identity GUID of the actor owning the material inventory. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	FGuid MaterialOwnerGuid;
+};
+
+USTRUCT(BlueprintType)
+struct FMOCraftingSchedulerSaveData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	TArray<FMOStationJobSaveData> PendingJobs;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Save")
+	TArray<FMOStationEntrySaveData> AssignedEntries;
+};
+
+/**
+ * World subsystem that drives every active crafting queue from one timer.
+ *
+ * Active queues book their next wake here (the earlier of their current craft's completion and their next
+ * progress replication) and stop ticking. Wakes sit in a min-heap keyed by simulation time (see
+ * UMOSimulationClockSubsystem), and a single timer is armed for the earliest one, so a world with hundreds of
+ * running crafts does no per-frame work; a frame only pays for the queues that actually complete or publish
+ * progress in it. A time scale change re-arms the timer; a fast-forward runs everything it made due at once.
+ *
+ * Also owns shared station queues: jobs submitted for a station go to worker pawns registered at that
+ * station, one job per worker, as each worker's own queue runs dry. Pending jobs and the material
+ * inventories of taken ones are saved here (see BuildSaveData).
+ *
+ * Outside Game/PIE worlds there is no subsystem; queue components fall back to ticking.
+ */
+UCLASS()
+class MOFRAMEWORK_API UMOCraftingSchedulerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/** Scheduler for WorldContextObject's world, or nullptr (editor and preview worlds). */
+	static UMOCraftingSchedulerSubsystem* Get(const UObject* WorldContextObject);
+
+	/*
+	 * Active queues
+	 */
+
+	/** Wake Queue at simulation time WakeTime, replacing any wake it already had. */
+	void ScheduleQueue(UMOCraftingQueueComponent* Queue, double WakeTime);
+
+	/** Drop Queue's pending wake (paused, emptied or ending play). */
+	void UnscheduleQueue(UMOCraftingQueueComponent* Queue);
+
+	/** Queues with a pending wake, i.e. actively crafting. */
+	UFUNCTION(BlueprintPure, Category="MO|Crafting|Scheduler")
+	int32 GetActiveQueueCount() const { return LiveSerials.Num(); }
+
+	/** Wakes in the heap, including superseded entries not yet popped. */
+	UFUNCTION(BlueprintPure, Category="MO|Crafting|Scheduler")
+	int32 GetPendingWakeCount() const { return WakeQueue.Num(); }
+
+	/** Dispatch every wake due at or before the current simulation time (also used by the timer). */
+	void RunDueWakes();
+
+	/*
+	 * Station queues
+	 */
+
+	/**
+	 * Let Worker take jobs from Station's shared queue. A worker only receives a job while its own
+	 * queue is empty. Re-registering moves the worker to another station.
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Scheduler")
+	bool RegisterWorker(UMOCraftingQueueComponent* Worker, EMOCraftingStation Station);
+
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Scheduler")
+	void UnregisterWorker(UMOCraftingQueueComponent* Worker);
+
+	/**
+	 * Queue Count crafts of a recipe at a station, to be done by the next idle worker there.
+	 * Ingredients come from MaterialInventory and outputs go back to it as each craft completes.
+	 * @return Id of the job, or an invalid GUID if the recipe or inventory is invalid
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Scheduler")
+	FGuid SubmitStationJob(EMOCraftingStation Station, FName RecipeId, int32 Count, UMOInventoryComponent* MaterialInventory);
+
+	/** Remove a job that no worker has picked up yet. */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Scheduler")
+	bool CancelStationJob(const FGuid& JobId);
+
+	/** Jobs waiting for a worker at Station. */
+	UFUNCTION(BlueprintPure, Category="MO|Crafting|Scheduler")
+	int32 GetPendingStationJobCount(EMOCraftingStation Station) const;
+
+	/** Called by a queue when it runs dry; hands it the next job if it is a registered worker. */
+	void NotifyWorkerIdle(UMOCraftingQueueComponent* Worker);
+
+	/*
+	 * Save/Load
+	 */
+
+	/**
+	 * Save pending station jobs, and the material inventory of every station job in a registered worker's
+	 * queue. Inventories are saved by their owner's identity GUID; ones without an identity are skipped.
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Scheduler")
+	void BuildSaveData(FMOCraftingSchedulerSaveData& OutSaveData) const;
+
+	/**
+	 * Replace pending station jobs with the saved ones and hold the saved entry inventories until the
+	 * worker queues load. Apply before the queues' own save data so their offline progress crafts from
+	 * the right inventory. Jobs whose inventory cannot be resolved are dropped.
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting|Scheduler")
+	void ApplySaveData(const FMOCraftingSchedulerSaveData& InSaveData);
+
+	/** Called by a loading queue: the saved material inventory of one of its entries, if any (once). */
+	UMOInventoryComponent* TakeRestoredEntryInventory(const FGuid& EntryId);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** One booked wake in WakeQueue. */
+	struct FQueueWake
+	{
+		double Time = 0.0;
+		TWeakObjectPtr<UMOCraftingQueueComponent> Queue;
+		uint32 Serial = 0;
+
+		bool operator<(const FQueueWake& Other) const { return Time < Other.Time; }
+	};
+
+	/** One job waiting on a shared station queue. */
+	struct FStationJob
+	{
+		FGuid JobId;
+		FName RecipeId;
+		int32 Count = 1;
+		EMOCraftingStation Station = EMOCraftingStation::None;
+		TWeakObjectPtr<UMOInventoryComponent> MaterialInventory;
+	};
+
+	struct FStationWorker
+	{
+		TWeakObjectPtr<UMOCraftingQueueComponent> Queue;
+		EMOCraftingStation Station = EMOCraftingStation::None;
+	};
+
+	/** True if Wake is still its queue's current booking. */
+	bool IsLiveWake(const FQueueWake& Wake) const;
+
+	/** (Re)arm the timer for the earliest live wake, or clear it when there is none. */
+	void ArmTimer();
+
+	/** The clock's pace or position moved: run what is now due and re-arm against the new mapping. */
+	void HandleClockChanged();
+
+	double GetNow() const;
+
+	/** Give each idle worker at Station the oldest job waiting there. */
+	void AssignStationJobs(EMOCraftingStation Station);
+
+	/** Inventory of the actor with identity OwnerGuid, or nullptr. */
+	UMOInventoryComponent* ResolveMaterialInventory(const FGuid& OwnerGuid) const;
+
+	/** Min-heap of wakes ordered by simulation time. */
+	TArray<FQueueWake> WakeQueue;
+
+	/** Scratch for wakes popped this run (dispatch books new ones). */
+	TArray<FQueueWake> DueWakes;
+
+	/** Serial of each scheduled queue's current wake; older heap entries for it are stale. */
+	TMap<TObjectKey<UMOCraftingQueueComponent>, uint32> LiveSerials;
+
+	uint32 NextSerial = 0;
+
+	FTimerHandle WakeTimerHandle;
+
+	/** Simulation time the timer is armed for. */
+	double ArmedWakeTime = 0.0;
+
+	TWeakObjectPtr<UMOSimulationClockSubsystem> SimulationClock;
+
+	FDelegateHandle ClockChangedHandle;
+
+	/** True while RunDueWakes is dispatching; re-arming waits until it finishes. */
+	bool bIsRunningWakes = false;
+
+	/** Jobs waiting for workers, oldest first (all stations). */
+	TArray<FStationJob> StationJobs;
+
+	TArray<FStationWorker> Workers;
+
+	/** Loaded entry inventories waiting for their queue to load (see TakeRestoredEntryInventory). */
+	TMap<FGuid, TWeakObjectPtr<UMOInventoryComponent>> RestoredEntryInventories;
+};
@@ -9,6 +9,7 @@
 class UMOKnowledgeComponent;
 class UMOSkillsComponent;
 class UMOInventoryComponent;
+struct FMORecipeIndex;
 
 /**
  * Result of checking if a recipe can be crafted.
@@ -68,6 +69,118 @@ struct MOFRAMEWORK_API FMOCraftResult
 	TMap<FName, float> XPGranted;
 };
 
+/**
+ * One batch in a crafting plan: craft a recipe Count times.
+ */
+USTRUCT(BlueprintType)
+struct MOFRAMEWORK_API FMOCraftingPlanStep
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category="MO|Crafting")
+	FName RecipeId;
+
+	UPROPERTY(BlueprintReadOnly, Category="MO|Crafting")
+	int32 Count = 0;
+};
+
+/**
+ * Everything needed to craft a quantity of an item, sub-recipes included.
+ */
+USTRUCT(BlueprintType)
+struct MOFRAMEWORK_API FMOCraftingPlan
+{
+	GENERATED_BODY()
+
+	/** True if a plan was found and every raw material it needs is held. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Crafting")
+	bool bSuccess = false;
+
+	/** Recipe batches in execution order: every step's crafted ingredients come from earlier steps or the inventory. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Crafting")
+	TArray<FMOCraftingPlanStep> Steps;
+
+	/** Materials taken from the inventory (raw materials and held intermediates), ItemDefId -> quantity. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Crafting")
+	TMap<FName, int32> ConsumedFromInventory;
+
+	/** Raw materials the inventory is short of, ItemDefId -> quantity. Empty when bSuccess. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Crafting")
+	TMap<FName, int32> MissingMaterials;
+
+	/** Items whose recipe chain loops back on itself; demand that would close the loop is treated as raw. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Crafting")
+	TArray<FName> CyclicItems;
+
+	/** Set by UMOCraftingQueueComponent::EnqueueCraftPlan to the id its queued steps share. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Crafting")
+	FGuid PlanId;
+};
+
+/**
+ * Expands a target item into the recipe batches that produce it.
+ *
+ * Each item is made by its first recipe (in DataTable order) that is usable at the station, passes the
+ * crafter's recipe gate and outputs it with certainty; items without one are raw materials. The dependency
+ * order under a target is expanded once and memoized per (item, station), together with the gate results
+ * the producer choices depended on. Replanning the same target for a crafter whose gate still agrees is a
+ * single linear pass. Call Reset when the recipe index changes.
+ */
+struct MOFRAMEWORK_API FMOCraftingPlanner
+{
+	/**
+	 * Plan Quantity more of ItemDefinitionId. Only recipes CanUseRecipe accepts are planned with.
+	 * Held intermediates and raw materials are netted out via GetHeldQuantity; held units of the target itself
+	 * are not (the caller asked for that many more). A plan whose quantities would not fit an int32 is rejected.
+	 */
+	void BuildPlan(
+		const FMORecipeIndex& Index,
+		FName ItemDefinitionId,
+		int32 Quantity,
+		EMOCraftingStation Station,
+		TFunctionRef<bool(const FMORecipeDefinitionRow&)> CanUseRecipe,
+		TFunctionRef<int32(FName)> GetHeldQuantity,
+		FMOCraftingPlan& OutPlan);
+
+	void Reset();
+
+private:
+	struct FPlanKey
+	{
+		FName ItemDefinitionId;
+		EMOCraftingStation Station = EMOCraftingStation::None;
+
+		bool operator==(const FPlanKey& Other) const { return ItemDefinitionId == Other.ItemDefinitionId && Station == Other.Station; }
+		friend uint32 GetTypeHash(const FPlanKey& Key) { return HashCombine(GetTypeHash(Key.ItemDefinitionId), ::GetTypeHash(static_cast<uint8>(Key.Station))); }
+	};
+
+	struct FProducer
+	{
+		int32 RecipePosition = INDEX_NONE;
+		int32 OutputQuantity = 0;
+	};
+
+	/** The crafted items under a target, target first, each before everything it depends on. */
+	struct FExpansion
+	{
+		TArray<FName> Items;
+		TArray<FProducer> Producers;
+		TMap<FName, int32> OrderByItem;
+		TArray<FName> CyclicItems;
+
+		/** Gate result of every recipe the producer choices looked at, by recipe position. */
+		TArray<TPair<int32, bool>> RecipeGates;
+	};
+
+	/** Every recipe that makes the item with certainty at the station, in DataTable order, before any gate. */
+	const TArray<FProducer>& FindProducers(const FMORecipeIndex& Index, FName ItemDefinitionId, EMOCraftingStation Station);
+	const FExpansion& Expand(const FMORecipeIndex& Index, FName ItemDefinitionId, EMOCraftingStation Station,
+		TFunctionRef<bool(const FMORecipeDefinitionRow&)> CanUseRecipe);
+
+	TMap<FPlanKey, TArray<FProducer>> ProducerMemo;
+	TMap<FPlanKey, FExpansion> ExpansionMemo;
+};
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMOOnCraftCompleted, FName, RecipeId, const FMOCraftResult&, Result);
 
 /**
@@ -79,6 +192,10 @@ class MOFRAMEWORK_API UMOCraftingSubsystem : public UWorldSubsystem
 	GENERATED_BODY()
 
 public:
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
 	// Delegates
 	UPROPERTY(BlueprintAssignable, Category="MO|Crafting|Events")
 	FMOOnCraftCompleted OnCraftCompleted;
@@ -156,7 +273,52 @@ public:
 	UFUNCTION(BlueprintPure, Category="MO|Crafting")
 	float GetRecipeCraftTime(FName RecipeId) const;
 
+	/**
+	 * Work out every recipe batch needed to make Quantity more of an item, including intermediates,
+	 * netting out what the inventory already holds. Only recipes the crafter could make by knowledge and
+	 * skill (as GetAvailableRecipes) are used.
+	 * @param ItemDefinitionId The item to produce
+	 * @param Quantity How many more to produce
+	 * @param KnowledgeComponent Crafter's knowledge (for recipe visibility)
+	 * @param SkillsComponent Crafter's skills (for level requirements)
+	 * @param InventoryComponent Inventory to net against (null plans from nothing)
+	 * @param Station The crafting station being used
+	 * @param OutPlan Ordered steps plus consumed/missing materials
+	 * @return True if the plan is complete (bSuccess)
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Crafting")
+	bool PlanCraft(
+		FName ItemDefinitionId,
+		int32 Quantity,
+		UMOKnowledgeComponent* KnowledgeComponent,
+		UMOSkillsComponent* SkillsComponent,
+		UMOInventoryComponent* InventoryComponent,
+		EMOCraftingStation Station,
+		FMOCraftingPlan& OutPlan
+	);
+
+	/**
+	 * The GetCraftableRecipes test for one recipe row (knowledge, skill, ingredients; not the station).
+	 * Shared with UMOCraftabilityComponent so both always agree.
+	 */
+	bool IsRecipeRowCraftable(
+		const FMORecipeDefinitionRow* Recipe,
+		UMOKnowledgeComponent* KnowledgeComponent,
+		UMOSkillsComponent* SkillsComponent,
+		UMOInventoryComponent* InventoryComponent
+	) const;
+
 private:
+	/**
+	 * GetAvailableRecipes as positions into UMORecipeDatabaseSettings::GetRecipeIndex().
+	 */
+	void GetAvailableRecipePositions(
+		UMOKnowledgeComponent* KnowledgeComponent,
+		UMOSkillsComponent* SkillsComponent,
+		EMOCraftingStation Station,
+		TArray<int32>& OutPositions
+	) const;
+
 	/**
 	 * Check if player has required knowledge for a recipe.
 	 */
@@ -185,4 +347,11 @@ private:
 		UMOKnowledgeComponent* KnowledgeComponent,
 		TMap<FName, int32>* OutMissingIngredients = nullptr
 	) const;
+
+	void HandleRecipeIndexReset(const FMORecipeIndex& OldIndex);
+
+	/** Memoized recipe-graph expansion for PlanCraft. */
+	FMOCraftingPlanner Planner;
+
+	FDelegateHandle RecipeIndexResetHandle;
 };
@@ -48,6 +48,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Identity")
 	FGuid GetOrCreateGuid();
 
+	/**
+	 * Give up the current GUID while the owner stays alive (e.g. a world item parked in the pool).
+	 * Listeners see the same OnOwnerDestroyedWithGuid as for a real destroy. Authority only.
+	 */
+	void ReleaseGuid();
+
 	UFUNCTION(CallInEditor, BlueprintCallable, Category="MO|Identity")
 	void RegenerateGuid();
 
@@ -34,6 +34,9 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Identity")
 	int32 GetRegisteredCount() const;
 
+	/** Drop the GUID mapping of an actor that stays alive, keeping it tracked for a later GUID. */
+	void ReleaseGuidForActor(AActor* Actor);
+
 	UPROPERTY(BlueprintAssignable, Category="MO|Identity")
 	FMOIdentityRegisteredSignature OnIdentityRegistered;
 
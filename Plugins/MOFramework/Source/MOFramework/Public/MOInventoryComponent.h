@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "Net/Serialization/FastArraySerializer.h"
 #include "MOworldSaveGame.h"
+#include "MOItemDefinitionRow.h"
 #include "MOInventoryComponent.generated.h"
 
 USTRUCT(BlueprintType)
@@ -19,6 +20,38 @@ struct FMOInventoryEntry : public FFastArraySerializerItem
 
 	UPROPERTY(BlueprintReadOnly, Category="MO|Inventory")
 	int32 Quantity = 0;
+
+	/** Slot this entry occupies, or -1 if unslotted. Replicates with the entry, so a slot move or swap is an item delta. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Inventory")
+	int32 SlotIndex = INDEX_NONE;
+
+	// Slot this entry was last placed into locally; clients use it to clear the old slot on a move. Never replicated.
+	int32 AppliedSlotIndex = INDEX_NONE;
+
+	// What this entry currently contributes to FMOInventoryList's totals. Local bookkeeping, never replicated.
+	FName CountedDefinitionId;
+	int32 CountedQuantity = 0;
+
+	// Interned handle for ItemDefinitionId, kept current by FMOInventoryList. Invalid for IDs outside the item table.
+	FMOItemDefinitionHandle DefinitionHandle;
+
+	/** Definition row for this entry: an array index through the cached handle, falling back to a name lookup. */
+	const FMOItemDefinitionRow* GetDefinition() const;
+
+	/**
+	 * Compact wire format: the definition goes as its FName (handles are local to each process's table),
+	 * quantity and slot as packed ints.
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMOInventoryEntry> : public TStructOpsTypeTraitsBase2<FMOInventoryEntry>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
 };
 
 USTRUCT(BlueprintType)
@@ -35,15 +68,70 @@ public:
 
 	void SetOwner(UMOInventoryComponent* InOwner) { OwnerComponent = InOwner; }
 
+	/** Array index of the entry holding ItemGuid, or INDEX_NONE. Rebuilds the GUID index first if it is stale. */
+	int32 FindIndexByGuid(const FGuid& ItemGuid) const;
+
+	/** Append an entry and index it. Returns its array index. Caller marks it dirty. */
+	int32 AddEntry(const FMOInventoryEntry& NewEntry);
+
+	/** Swap-remove the entry at EntryIndex, patching the index of the entry moved into its place. Caller marks the array dirty. */
+	void RemoveEntryAt(int32 EntryIndex);
+
+	/** Remove all entries. Caller marks the array dirty. */
+	void ResetEntries();
+
+	/** Force the GUID index to rebuild on next lookup. Call after editing Entries directly. */
+	void InvalidateIndex() { bIndexDirty = true; }
+
+	/** Re-fold an entry into the per-definition totals after its quantity or definition changed. */
+	void RecountEntry(FMOInventoryEntry& Entry);
+
+	/** Recompute all totals from scratch (after Entries was replaced wholesale). */
+	void RebuildTotals();
+
+	/** Total quantity held across all entries of one item definition. */
+	int32 GetTotalQuantity(FName ItemDefinitionId) const;
+
+	/** ItemDefinitionId -> total quantity. Only definitions with a non-zero total are present. */
+	const TMap<FName, int32>& GetQuantityTotals() const { return QuantityTotals; }
+
+	/** Move out the definitions whose total changed since the last call, in no particular order. */
+	void ConsumeChangedDefinitions(TArray<FName>& OutItemDefinitionIds);
+
+	/** Forget pending total changes (the totals were restored to what listeners last saw). */
+	void DiscardChangedDefinitions() { ChangedDefinitions.Reset(); }
+
 	// Replication callbacks
 	void PostReplicatedAdd(const TArrayView<int32>& AddedIndices, int32 FinalSize);
 	void PostReplicatedChange(const TArrayView<int32>& ChangedIndices, int32 FinalSize);
-	void PostReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize);
+	void PreReplicatedRemove(const TArrayView<int32>& RemovedIndices, int32 FinalSize);
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
 
 	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParams)
 	{
 		return FFastArraySerializer::FastArrayDeltaSerialize<FMOInventoryEntry, FMOInventoryList>(Entries, DeltaParams, *this);
 	}
+
+private:
+	void RebuildIndex() const;
+	void UncountEntry(FMOInventoryEntry& Entry);
+	void AdjustTotal(FName ItemDefinitionId, int32 Delta);
+
+	/** ItemGuid -> index into Entries. Not replicated; each side maintains its own. */
+	mutable TMap<FGuid, int32> IndexByGuid;
+
+	/** Set when array indices shifted in a way we did not track (replicated removes, direct edits). */
+	mutable bool bIndexDirty = true;
+
+	/** Entries were added, changed or removed this update; the owner broadcasts once the array has settled. */
+	bool bPendingReplicationBroadcast = false;
+	bool bPendingSlotsBroadcast = false;
+
+	/** Running per-definition totals, maintained on every add/change/remove on both server and clients. */
+	TMap<FName, int32> QuantityTotals;
+
+	/** Definitions whose total moved since the owner last broadcast OnItemTotalsChanged. */
+	TSet<FName> ChangedDefinitions;
 };
 
 template<>
@@ -57,6 +145,8 @@ struct TStructOpsTypeTraits<FMOInventoryList> : public TStructOpsTypeTraitsBase2
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMOInventoryChangedSignature);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FMOInventorySlotsChangedSignature);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMOInventorySlotContentsChangedSignature, const TArray<int32>&, SlotIndices);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FMOInventoryItemTotalsChangedSignature, const TArray<FName>&, ItemDefinitionIds);
 
 class UMOInventoryComponent;
 
@@ -84,6 +174,8 @@ class MOFRAMEWORK_API UMOInventoryComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend struct FMOInventoryList;
+
 public:
 	UMOInventoryComponent();
 
@@ -93,12 +185,29 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="MO|Inventory")
 	FMOInventorySlotsChangedSignature OnSlotsChanged;
 
+	/**
+	 * Slots whose displayed contents changed (slotted GUID, or quantity/definition of the slotted entry).
+	 * Fires alongside OnInventoryChanged/OnSlotsChanged, once per mutation or transaction on the server and
+	 * once per replication update on clients (from PostReplicatedReceive, covering every add, change and
+	 * remove in the update). UI should redraw only these indices.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="MO|Inventory")
+	FMOInventorySlotContentsChangedSignature OnSlotContentsChanged;
+
+	/**
+	 * Item definitions whose total quantity changed. Same cadence as OnSlotContentsChanged; moving items
+	 * between slots does not fire it. Listeners that only care about "how many X do I have" (recipe
+	 * availability, quest counters) should use this instead of OnInventoryChanged.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="MO|Inventory")
+	FMOInventoryItemTotalsChangedSignature OnItemTotalsChanged;
+
 	// Inventory entries (replicated via FastArray)
 	UPROPERTY(Replicated)
 	FMOInventoryList Inventory;
 
 	// Desired number of slots (authority sizes SlotItemGuids to match this)
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Inventory|Slots")
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, ReplicatedUsing=OnRep_SlotCount, Category="MO|Inventory|Slots")
 	int32 SlotCount = 16;
 
 	/** Items to add to inventory when the game starts (server only). */
@@ -109,8 +218,17 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Inventory|Slots")
 	bool bAutoAssignNewItemsToSlots = true;
 
-	// Actual slot contents (Guid per slot, invalid = empty)
-	UPROPERTY(ReplicatedUsing=OnRep_SlotItemGuids)
+	/** If true, AddItemByGuid tops up existing stacks of the same definition before creating new entries. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Inventory|Stacking")
+	bool bAutoStackNewItems = true;
+
+	/** Stack limit for item IDs that are not in the item database. 1 leaves them unstacked: one entry per add. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Inventory|Stacking", meta=(ClampMin="1"))
+	int32 FallbackMaxStackSize = 1;
+
+	// Actual slot contents (Guid per slot, invalid = empty). Not replicated itself: each entry carries its
+	// SlotIndex and clients rebuild this array from the entry deltas.
+	UPROPERTY()
 	TArray<FGuid> SlotItemGuids;
 
 	// Basic inventory operations
@@ -126,12 +244,68 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Inventory")
 	int32 GetEntryCount() const;
 
+	/** Total quantity of one item definition across all entries. Constant time. */
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory")
+	int32 GetTotalQuantityByDefinition(FName ItemDefinitionId) const;
+
+	/** ItemDefinitionId -> total quantity for everything held. */
+	const TMap<FName, int32>& GetQuantityTotals() const { return Inventory.GetQuantityTotals(); }
+
 	UFUNCTION(BlueprintCallable, Category="MO|Inventory")
 	void GetInventoryEntries(TArray<FMOInventoryEntry>& OutEntries) const;
 
 	UFUNCTION(BlueprintCallable, Category="MO|Inventory")
 	FString GetInventoryDebugString() const;
 
+	/*
+	 * STACKING (Authority-only)
+	 *
+	 * Entries carry no per-instance state beyond their GUID, so entries of one definition are interchangeable
+	 * and merge into stacks of up to that definition's MaxStackSize.
+	 */
+
+	/** MaxStackSize from the item database, or FallbackMaxStackSize for unlisted IDs. Never below 1; 1 means the item does not stack. */
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Stacking")
+	int32 GetMaxStackSize(FName ItemDefinitionId) const;
+
+	/** Move as much of the source stack into the target as fits; the source is removed if emptied. False if nothing moved. */
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Stacking")
+	bool MergeStacks(const FGuid& SourceGuid, const FGuid& TargetGuid);
+
+	/**
+	 * Split SplitQuantity off a stack into a new entry, placed in TargetSlotIndex if that slot is empty and
+	 * otherwise in the first empty slot (unslotted if the grid is full).
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Stacking")
+	bool SplitStack(const FGuid& ItemGuid, int32 SplitQuantity, int32 TargetSlotIndex, FGuid& OutNewItemGuid);
+
+	/** Merge partial stacks of every definition in one pass, filling the lowest slots first. Returns the number of entries removed. */
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Stacking")
+	int32 CompactStacks();
+
+	/*
+	 * TRANSACTIONS (Authority-only)
+	 *
+	 * Between Begin and Commit, mutations apply immediately (so later calls see earlier ones and can fail),
+	 * but replication dirty marks and OnInventoryChanged/OnSlotsChanged are held back and emitted once at
+	 * Commit. Rollback restores the state captured at Begin. Nested Begin/Commit pairs join the outermost.
+	 */
+
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Transaction")
+	bool BeginTransaction();
+
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Transaction")
+	bool CommitTransaction();
+
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Transaction")
+	void RollbackTransaction();
+
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Transaction")
+	bool IsInTransaction() const { return TransactionDepth > 0; }
+
+	/** Id of the open transaction, or 0 when none is open. Nested Begins share the outermost one's id. */
+	uint32 GetOpenTransactionId() const { return TransactionDepth > 0 ? TransactionId : 0; }
+
 	// Slots API
 	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Slots")
 	int32 GetSlotCount() const;
@@ -151,6 +325,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Slots")
 	bool SwapSlots(int32 SlotIndexA, int32 SlotIndexB);
 
+	/** Slot holding ItemGuid, or -1 if the item is not slotted. */
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Slots")
+	int32 FindSlotIndexByGuid(const FGuid& ItemGuid) const;
+
 	/*
 	 * SAVE / RESTORE HELPERS (Authority-only)
 	 */
@@ -163,7 +341,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Save")
 	bool SetSlotCountAuthority(int32 NewSlotCount);
 
-	// Adds an entry but guarantees no slot auto-assignment happens (useful during restore).
+	// Adds an entry exactly as given: no slot auto-assignment and no stacking (useful during restore).
 	UFUNCTION(BlueprintCallable, Category="MO|Inventory|Save")
 	bool AddItemByGuidWithoutSlotAutoAssign(const FGuid& ItemGuid, const FName ItemDefinitionId, int32 QuantityToAdd);
 
@@ -205,7 +383,29 @@ protected:
 private:
 	int32 FindEntryIndexByGuid(const FGuid& ItemGuid) const;
 
+	/** AddItemByGuid. OutNewStackGuids, if given, receives the GUID of every entry the add created, first stack first. */
+	bool AddItemInternal(const FGuid& ItemGuid, FName ItemDefinitionId, int32 QuantityToAdd, TArray<FGuid>* OutNewStackGuids);
+
 	void BroadcastInventoryChanged();
+	void BroadcastSlotsChanged();
+
+	/** Top up existing stacks of a definition, lowest slot first. Returns the quantity that did not fit. */
+	int32 FillExistingStacks(FName ItemDefinitionId, int32 Quantity);
+
+	// Replication dirty marks for entries; deferred while a transaction is open.
+	void MarkEntryDirty(FMOInventoryEntry& Entry);
+	void MarkEntriesArrayDirty();
+
+	void ResetTransactionState();
+
+	// Changed-slot tracking for OnSlotContentsChanged.
+	void NoteSlotChanged(int32 SlotIndex);
+	void NoteEntrySlotChanged(const FGuid& ItemGuid);
+	void NoteAllSlotsChanged();
+	void FlushSlotContentsChanged();
+
+	// Changed-definition tracking for OnItemTotalsChanged (the list records, the component broadcasts).
+	void FlushItemTotalsChanged();
 
 	void EnsureSlotsInitialized();
 	bool IsSlotIndexValid(int32 SlotIndex) const;
@@ -216,8 +416,70 @@ private:
 	bool TryAutoAssignGuidToEmptySlot(const FGuid& ItemGuid);
 	void RemoveGuidFromSlotsInternal(const FGuid& ItemGuid);
 
-	void MarkSlotItemGuidsDirty();
+	/** Authority slot write: updates the local slot array/index and the SlotIndex of the affected entries. */
+	void WriteSlotGuid(int32 SlotIndex, const FGuid& ItemGuid);
+
+	/** Local slot write: keeps the reverse index and empty-slot hint in step. All slot array writes go through here. */
+	void SetSlotGuidLocal(int32 SlotIndex, const FGuid& ItemGuid);
+
+	/** Authority resize; unslots entries past the new end. */
+	void ResizeSlotsAuthority(int32 NewSlotCount);
+
+	/** Client: place a replicated entry into its SlotIndex (or clear it on remove). Returns true if a slot moved. */
+	bool ApplyReplicatedEntrySlot(FMOInventoryEntry& Entry, bool bRemoved);
+
+	/** Drop the slot reverse index; it rebuilds on next lookup. Call after replacing/resizing SlotItemGuids. */
+	void InvalidateSlotIndex();
+	void RebuildSlotIndex() const;
 
 	UFUNCTION()
-	void OnRep_SlotItemGuids();
+	void OnRep_SlotCount();
+
+	/** ItemGuid -> slot index. Not replicated; rebuilt from SlotItemGuids when stale. */
+	mutable TMap<FGuid, int32> SlotIndexByGuid;
+
+	/** Every slot below this index is known to be occupied. */
+	mutable int32 FirstEmptySlotHint = 0;
+
+	mutable bool bSlotIndexDirty = true;
+
+	// Open transaction state. Snapshots are taken at the outermost BeginTransaction.
+	int32 TransactionDepth = 0;
+	uint32 TransactionId = 0;
+	TArray<FMOInventoryEntry> TransactionEntriesSnapshot;
+	TArray<FGuid> TransactionSlotsSnapshot;
+	int32 TransactionSlotCountSnapshot = 0;
+	TSet<FGuid> PendingDirtyGuids;
+	bool bPendingArrayDirty = false;
+	bool bPendingInventoryBroadcast = false;
+	bool bPendingSlotsBroadcast = false;
+
+	// Slots changed since the last OnSlotContentsChanged.
+	TSet<int32> PendingChangedSlots;
+	bool bPendingAllSlotsChanged = false;
+};
+
+/**
+ * Opens an inventory transaction for the current scope and commits it on exit unless Rollback() was called.
+ * A rollback from any scope ends the whole transaction; the enclosing scopes then do nothing on exit.
+ *
+ *	FMOInventoryTransactionScope Transaction(Inventory);
+ *	if (!Inventory->RemoveItemByGuid(...)) { Transaction.Rollback(); return; }
+ */
+struct MOFRAMEWORK_API FMOInventoryTransactionScope
+{
+	UE_NONCOPYABLE(FMOInventoryTransactionScope);
+
+	explicit FMOInventoryTransactionScope(UMOInventoryComponent* InInventory);
+	~FMOInventoryTransactionScope();
+
+	void Rollback();
+
+	/** False if the transaction could not be opened (no authority, mutations will then fail too) or was rolled back. */
+	bool IsOpen() const { return bOpen && Inventory.IsValid() && Inventory->GetOpenTransactionId() == TransactionId; }
+
+private:
+	TWeakObjectPtr<UMOInventoryComponent> Inventory;
+	uint32 TransactionId = 0;
+	bool bOpen = false;
 };
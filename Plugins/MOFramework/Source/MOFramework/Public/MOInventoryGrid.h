@@ -28,6 +28,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Inventory|UI")
 	void RefreshAllSlots();
 
+	/** Redraw only the given slot widgets (from UMOInventoryComponent::OnSlotContentsChanged). */
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|UI")
+	void RefreshSlots(const TArray<int32>& SlotIndices);
+
+	/** Rebuild the grid only if the inventory's slot count no longer matches the widgets. Returns true if rebuilt. */
+	UFUNCTION(BlueprintCallable, Category="MO|Inventory|UI")
+	bool RebuildGridIfSlotCountChanged();
+
 	/** Get the inventory component this grid is displaying. */
 	UFUNCTION(BlueprintPure, Category="MO|Inventory|UI")
 	UMOInventoryComponent* GetInventoryComponent() const { return InventoryComponent; }
@@ -48,6 +48,9 @@ private:
 	UFUNCTION()
 	void HandleSlotsChanged();
 
+	UFUNCTION()
+	void HandleSlotContentsChanged(const TArray<int32>& SlotIndices);
+
 	UFUNCTION()
 	void HandleGridSlotClicked(int32 SlotIndex, const FGuid& ItemGuid);
 
@@ -0,0 +1,124 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "MOItemAssetStreamingSubsystem.generated.h"
+
+class UStaticMesh;
+class UTexture2D;
+
+/** Running totals for item asset streaming. */
+USTRUCT(BlueprintType)
+struct MOFRAMEWORK_API FMOAssetStreamingStats
+{
+	GENERATED_BODY()
+
+	/** Requests answered straight from memory. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Streaming")
+	int32 ResidentHits = 0;
+
+	/** Distinct assets handed to the async loader. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Streaming")
+	int32 AsyncRequestedAssets = 0;
+
+	/** Async load batches issued (one per frame that had new requests). */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Streaming")
+	int32 BatchesIssued = 0;
+
+	/** Batches that finished loading. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Streaming")
+	int32 BatchesCompleted = 0;
+
+	/**
+	 * Wall time from issuing each completed batch to its completion callback (seconds), summed. This is
+	 * load latency, including frames spent waiting on the loader, not game-thread cost saved.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Streaming")
+	float AsyncBatchLoadSeconds = 0.0f;
+};
+
+/**
+ * Async loading for item and recipe presentation assets (icons, world meshes, materials).
+ *
+ * Callers ask for a soft reference and get the object back if it is already in memory; otherwise the
+ * request joins this frame's batch, the caller shows a placeholder, and the supplied callback runs once
+ * the asset arrives. All requests made in one frame (a UI opening, a wave of drops) go out as a single
+ * FStreamableManager request. A batch's handle is released once its callbacks have run, so loaded assets
+ * stay resident only while something references them (the placeholders are held for the game instance).
+ *
+ * Outside a game instance (editor previews) there is no subsystem; callers fall back to LoadSynchronous.
+ */
+UCLASS()
+class MOFRAMEWORK_API UMOItemAssetStreamingSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Subsystem for WorldContextObject's game instance, or nullptr (editor previews, no game instance). */
+	static UMOItemAssetStreamingSubsystem* Get(const UObject* WorldContextObject);
+
+	// UGameInstanceSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	/**
+	 * The asset if it is in memory. Otherwise queues it for the next batch, returns nullptr, and runs
+	 * OnLoaded when it arrives (not run for resident assets or null paths).
+	 */
+	UObject* RequestAsset(const FSoftObjectPath& AssetPath, FSimpleDelegate OnLoaded = FSimpleDelegate());
+
+	template <typename T>
+	T* RequestAsset(const TSoftObjectPtr<T>& Asset, FSimpleDelegate OnLoaded = FSimpleDelegate())
+	{
+		return Cast<T>(RequestAsset(Asset.ToSoftObjectPath(), MoveTemp(OnLoaded)));
+	}
+
+	/** Icon for an item, as RequestAsset. bLarge falls back to the small icon when no large one is set. */
+	UTexture2D* RequestItemIcon(FName ItemDefinitionId, bool bLarge, FSimpleDelegate OnLoaded = FSimpleDelegate());
+
+	/** Start loading the icons and/or world visuals of these items, e.g. before opening a container. */
+	UFUNCTION(BlueprintCallable, Category="MO|Streaming")
+	void PrefetchItemDefinitions(const TArray<FName>& ItemDefinitionIds, bool bIcons = true, bool bWorldVisuals = false);
+
+	/** Issue the pending batch now instead of at the end of the frame. */
+	UFUNCTION(BlueprintCallable, Category="MO|Streaming")
+	void FlushPendingRequests();
+
+	/** Shown while an icon streams in. From the item database settings; null if unset or still loading itself. */
+	UTexture2D* GetPlaceholderIcon();
+
+	/** Shown while a world mesh streams in. From the item database settings; null if unset or still loading itself. */
+	UStaticMesh* GetPlaceholderWorldMesh();
+
+	UFUNCTION(BlueprintCallable, Category="MO|Streaming")
+	FMOAssetStreamingStats GetStreamingStats() const { return Stats; }
+
+private:
+	void ScheduleFlush();
+	void HandleBatchLoaded(uint32 BatchId, TArray<FSoftObjectPath> BatchPaths, double StartSeconds);
+
+	FStreamableManager StreamableManager;
+
+	/** Paths waiting for the next batch. */
+	TArray<FSoftObjectPath> PendingPaths;
+
+	/** Callbacks per path that is pending or in flight; presence means "already requested". */
+	TMap<FSoftObjectPath, TArray<FSimpleDelegate>> WaitingCallbacks;
+
+	/** Handles of batches still loading, by batch id; each is dropped when its batch completes. */
+	TMap<uint32, TSharedPtr<FStreamableHandle>> InFlightBatches;
+
+	uint32 NextBatchId = 0;
+
+	/** Placeholders, held once loaded so they are never collected while the game instance runs. */
+	UPROPERTY()
+	TObjectPtr<UTexture2D> PlaceholderIcon;
+
+	UPROPERTY()
+	TObjectPtr<UStaticMesh> PlaceholderWorldMesh;
+
+	bool bFlushScheduled = false;
+
+	FMOAssetStreamingStats Stats;
+};
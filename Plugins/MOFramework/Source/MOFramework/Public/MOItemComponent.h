@@ -59,10 +59,16 @@ public:
 	UFUNCTION()
 	void OnRep_ItemDefinitionId();
 
-	
+	/** Re-file this item in the world item index after moving it or setting ItemDefinitionId directly. */
+	void RefreshWorldItemIndex();
+
+	/** Drop this item from the world item index while it stays alive (e.g. parked in the world item pool). */
+	void RemoveFromWorldItemIndex();
+
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 private:
@@ -7,6 +7,8 @@
 #include "MOItemDatabaseSettings.generated.h"
 
 class UDataTable;
+class UStaticMesh;
+class UTexture2D;
 
 /**
  * Project Settings entry to point the plugin at an item definition DataTable.
@@ -29,11 +31,42 @@ public:
 
 	UDataTable* GetItemDefinitionsDataTable() const;
 
+	/** Icon shown while an item icon streams in (UMOItemAssetStreamingSubsystem). Optional. */
+	UPROPERTY(EditAnywhere, Config, Category="Streaming")
+	TSoftObjectPtr<UTexture2D> PlaceholderIcon;
+
+	/** Mesh shown on world items while their own mesh streams in. Optional; without it the item is invisible until loaded. */
+	UPROPERTY(EditAnywhere, Config, Category="Streaming")
+	TSoftObjectPtr<UStaticMesh> PlaceholderWorldMesh;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/** Look up an item definition by ID without copying. Returns pointer or nullptr if not found. */
+	static const FMOItemDefinitionRow* FindItemDefinition(FName ItemDefinitionId);
+
+	/** Interned handle for an item definition ID. Invalid if the ID is not a row of the item DataTable. */
+	static FMOItemDefinitionHandle GetItemDefinitionHandle(FName ItemDefinitionId);
+
+	/** Resolve a handle to its definition row (array index). Returns nullptr for invalid or stale handles. */
+	static const FMOItemDefinitionRow* GetItemDefinitionByHandle(FMOItemDefinitionHandle Handle);
+
+	/** Resolve a handle back to its item definition ID. NAME_None for invalid or stale handles. */
+	static FName GetItemDefinitionIdByHandle(FMOItemDefinitionHandle Handle);
+
+	/**
+	 * Drop the interned definition table; it is rebuilt from the DataTable on the next lookup.
+	 * Called automatically when the DataTable or this setting changes. Game thread only.
+	 */
+	static void ResetItemDefinitionHandles();
+
 	/** Look up an item definition by ID. Returns true if found. */
 	UFUNCTION(BlueprintCallable, Category="MO|Item Database", meta=(DisplayName="Get Item Definition"))
 	static bool GetItemDefinition(FName ItemDefinitionId, FMOItemDefinitionRow& OutDefinition);
 
-	/** Get just the icon for an item (loads synchronously). Returns nullptr if not found. */
+	/** Get just the icon for an item (loads synchronously). Returns nullptr if not found.
+	 *  Widgets should prefer UMOItemAssetStreamingSubsystem::RequestItemIcon, which does not block. */
 	UFUNCTION(BlueprintCallable, Category="MO|Item Database")
 	static UTexture2D* GetItemIconSmall(FName ItemDefinitionId);
 
@@ -239,3 +239,20 @@ struct MOFRAMEWORK_API FMOItemDefinitionRow : public FTableRowBase
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="MO|Item|Inspection")
 	FMOItemInspection Inspection;
 };
+
+/**
+ * Dense runtime handle for an item definition: an index into the interned definition table that
+ * UMOItemDatabaseSettings builds from the item DataTable. 0 is invalid.
+ * Handles follow the local table's row order and are never sent over the network; replicate the definition ID.
+ */
+struct FMOItemDefinitionHandle
+{
+	uint16 Index = 0;
+
+	FMOItemDefinitionHandle() = default;
+	explicit FMOItemDefinitionHandle(uint16 InIndex) : Index(InIndex) {}
+
+	bool IsValid() const { return Index != 0; }
+	bool operator==(const FMOItemDefinitionHandle& Other) const { return Index == Other.Index; }
+	bool operator!=(const FMOItemDefinitionHandle& Other) const { return Index != Other.Index; }
+};
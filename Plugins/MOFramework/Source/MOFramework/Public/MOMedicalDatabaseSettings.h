@@ -45,6 +45,81 @@ public:
 		meta=(RequiredAssetDataTags="RowStructure=/Script/MOFramework.MOMedicalTreatmentRow"))
 	TSoftObjectPtr<UDataTable> MedicalTreatmentsTable;
 
+	// ============================================================================
+	// SIMULATION
+	// ============================================================================
+
+	/**
+	 * Drive medical components from UMOMedicalSchedulerSubsystem in one ordered pass
+	 * instead of one timer per component. Disable to restore per-component timers.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation")
+	bool bUseMedicalScheduler = true;
+
+	/** Interval between scheduler passes in seconds. Should not exceed the smallest component TickInterval. */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation", meta=(ClampMin="0.05", EditCondition="bUseMedicalScheduler"))
+	float SchedulerPassInterval = 0.5f;
+
+	/**
+	 * World seed for the medical simulation's random rolls (infection, stumbling). Each
+	 * pawn's stream is derived from this and its identity GUID, so with the scheduler's
+	 * fixed pass interval the same scenario produces the same results run to run.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation")
+	int32 MedicalRandomSeed = 0;
+
+	/**
+	 * Derive heart rate, blood pressure, respiratory rate and SpO2 for all due pawns
+	 * in one structure-of-arrays batch using SIMD kernels. Results are identical to
+	 * the per-component path; only worth enabling with many authority pawns.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation", meta=(EditCondition="bUseMedicalScheduler"))
+	bool bUseVitalsBatchKernels = false;
+
+	/**
+	 * Simulate pawns far from every player at reduced fidelity. Within FullDetailDistance
+	 * pawns tick normally, within CoarseDetailDistance they tick CoarseStepMultiplier times
+	 * less often with a larger step, and beyond that they go dormant and catch up on wake.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation|LOD", meta=(EditCondition="bUseMedicalScheduler"))
+	bool bEnableSimulationLOD = false;
+
+	/** Distance (cm) to the nearest player within which pawns are fully simulated. */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation|LOD", meta=(ClampMin="0", EditCondition="bEnableSimulationLOD"))
+	float FullDetailDistance = 5000.0f;
+
+	/** Distance (cm) to the nearest player within which pawns are coarsely simulated. Beyond this they go dormant. */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation|LOD", meta=(ClampMin="0", EditCondition="bEnableSimulationLOD"))
+	float CoarseDetailDistance = 20000.0f;
+
+	/** Coarse pawns tick this many times less often, each tick covering that many intervals. */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation|LOD", meta=(ClampMin="1", ClampMax="60", EditCondition="bEnableSimulationLOD"))
+	float CoarseStepMultiplier = 4.0f;
+
+	/** How often LOD tiers are recomputed (seconds). */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation|LOD", meta=(ClampMin="0.1", EditCondition="bEnableSimulationLOD"))
+	float LODUpdateInterval = 1.0f;
+
+	/** Largest single step (seconds) used when catching up a pawn that wakes from dormancy. Metabolism fast-forwards in one call. */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation|LOD", meta=(ClampMin="1", EditCondition="bEnableSimulationLOD"))
+	float DormantCatchUpMaxStep = 10.0f;
+
+	/**
+	 * Advance wounds and conditions by scheduled events instead of every tick. Each wound
+	 * queues its next transition (infection onset, healing/infection stage, sepsis, healed)
+	 * on the scheduler; stable wounds cost nothing between events. Infection onset is
+	 * sampled once from an exponential distribution rather than rolled every tick.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation|Events", meta=(EditCondition="bUseMedicalScheduler"))
+	bool bUseWoundEventScheduling = false;
+
+	/**
+	 * Healing progress, infection severity and condition severity are brought up to date
+	 * (and replicated) each time they cross a multiple of this many points.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category="Simulation|Events", meta=(ClampMin="1", ClampMax="100", EditCondition="bUseWoundEventScheduling"))
+	float WoundEventStageSize = 10.0f;
+
 	// ============================================================================
 	// ACCESSORS
 	// ============================================================================
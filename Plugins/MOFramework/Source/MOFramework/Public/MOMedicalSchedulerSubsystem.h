@@ -0,0 +1,354 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MOVitalsKernels.h"
+#include "MOMedicalTypes.h"
+#include "MOMedicalSchedulerSubsystem.generated.h"
+
+class UMOAnatomyComponent;
+class UMOVitalsComponent;
+class UMOMetabolismComponent;
+class UMOMentalStateComponent;
+class UMOSurvivalStatsComponent;
+
+// ============================================================================
+// DELEGATES
+// ============================================================================
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FMOOnMedicalDelta, AActor*, Pawn, const FMOMedicalDelta&, Delta);
+
+// ============================================================================
+// ENUMS
+// ============================================================================
+
+/**
+ * Stages of a medical scheduler pass, in execution order.
+ * Later stages read state written by earlier ones (e.g. vitals reads anatomy pain/bleed).
+ */
+UENUM(BlueprintType)
+enum class EMOMedicalSimStage : uint8
+{
+	Anatomy			UMETA(DisplayName="Anatomy"),
+	Vitals			UMETA(DisplayName="Vitals"),
+	Metabolism		UMETA(DisplayName="Metabolism"),
+	Mental			UMETA(DisplayName="Mental State"),
+	SurvivalStats	UMETA(DisplayName="Survival Stats"),
+
+	MAX				UMETA(Hidden)
+};
+
+/**
+ * Simulation level of detail for a pawn, driven by distance to the nearest player.
+ */
+UENUM(BlueprintType)
+enum class EMOMedicalSimLOD : uint8
+{
+	/** Every component ticks at its own TickInterval. */
+	Full		UMETA(DisplayName="Full"),
+
+	/** Components tick less often with a proportionally larger step. */
+	Coarse		UMETA(DisplayName="Coarse"),
+
+	/** Nothing ticks; elapsed time is banked and caught up when the pawn becomes relevant again. */
+	Dormant		UMETA(DisplayName="Dormant"),
+
+	MAX			UMETA(Hidden)
+};
+
+// ============================================================================
+// STATS
+// ============================================================================
+
+/**
+ * Timing statistics for one scheduler stage (or the whole pass).
+ */
+USTRUCT(BlueprintType)
+struct MOFRAMEWORK_API FMOMedicalStageStats
+{
+	GENERATED_BODY()
+
+	/** Components currently registered for this stage. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Medical|Scheduler")
+	int32 RegisteredCount = 0;
+
+	/** Components that actually ticked during the last pass. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Medical|Scheduler")
+	int32 LastTickedCount = 0;
+
+	/** Wall time spent in the last pass (milliseconds). */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Medical|Scheduler")
+	float LastDurationMs = 0.0f;
+
+	/** Exponential moving average of pass time (milliseconds). */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Medical|Scheduler")
+	float AverageDurationMs = 0.0f;
+
+	/** Worst pass time since the last reset (milliseconds). */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Medical|Scheduler")
+	float PeakDurationMs = 0.0f;
+
+	/** Number of passes recorded since the last reset. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Medical|Scheduler")
+	int32 PassCount = 0;
+
+	/** Record one pass worth of timing. */
+	void Record(double DurationSeconds, int32 TickedCount);
+};
+
+// ============================================================================
+// SUBSYSTEM
+// ============================================================================
+
+/**
+ * World subsystem that drives every authority medical component from a single timer.
+ *
+ * Instead of each anatomy/vitals/metabolism/mental/survival component owning its own
+ * FTimerHandle, components register here in BeginPlay and are ticked stage by stage
+ * (anatomy -> vitals -> metabolism -> mental -> survival) in one pass per interval.
+ * Each component still honours its own TickInterval via a per-component accumulator.
+ *
+ * Pawns far from every player can be simulated at a coarser rate or put to sleep
+ * entirely (see EMOMedicalSimLOD and bEnableSimulationLOD). Pawns that are bleeding
+ * are never made dormant.
+ *
+ * With bUseWoundEventScheduling, anatomy components stop walking their wounds and
+ * conditions every tick and instead queue each one's next state transition here;
+ * only entries that come due are touched.
+ *
+ * Disable via Project Settings -> Plugins -> MO Medical Database -> bUseMedicalScheduler,
+ * in which case components fall back to their per-component timers.
+ */
+UCLASS()
+class MOFRAMEWORK_API UMOMedicalSchedulerSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// ============================================================================
+	// SUBSYSTEM LIFECYCLE
+	// ============================================================================
+
+	virtual void Deinitialize() override;
+
+	/**
+	 * Get the scheduler for a world, or nullptr if unavailable or disabled in settings.
+	 * Components use a nullptr result to fall back to their own timers.
+	 */
+	static UMOMedicalSchedulerSubsystem* Get(const UObject* WorldContextObject);
+
+	// ============================================================================
+	// REGISTRATION
+	// ============================================================================
+
+	bool RegisterComponent(UMOAnatomyComponent* Component);
+	bool RegisterComponent(UMOVitalsComponent* Component);
+	bool RegisterComponent(UMOMetabolismComponent* Component);
+	bool RegisterComponent(UMOMentalStateComponent* Component);
+	bool RegisterComponent(UMOSurvivalStatsComponent* Component);
+
+	void UnregisterComponent(UMOAnatomyComponent* Component);
+	void UnregisterComponent(UMOVitalsComponent* Component);
+	void UnregisterComponent(UMOMetabolismComponent* Component);
+	void UnregisterComponent(UMOMentalStateComponent* Component);
+	void UnregisterComponent(UMOSurvivalStatsComponent* Component);
+
+	// ============================================================================
+	// STATS
+	// ============================================================================
+
+	/** Get timing statistics for a single stage. */
+	UFUNCTION(BlueprintPure, Category="MO|Medical|Scheduler")
+	FMOMedicalStageStats GetStageStats(EMOMedicalSimStage Stage) const;
+
+	/** Get timing statistics for the whole pass (all stages). */
+	UFUNCTION(BlueprintPure, Category="MO|Medical|Scheduler")
+	FMOMedicalStageStats GetPassStats() const { return PassStats; }
+
+	/** Reset all timing statistics. */
+	UFUNCTION(BlueprintCallable, Category="MO|Medical|Scheduler")
+	void ResetStats();
+
+	/** Get multi-line stats dump for debugging. */
+	UFUNCTION(BlueprintPure, Category="MO|Medical|Scheduler")
+	FString GetStatsDebugString() const;
+
+	// ============================================================================
+	// LEVEL OF DETAIL
+	// ============================================================================
+
+	/** Get the current simulation LOD for an actor (Full if unknown). */
+	UFUNCTION(BlueprintPure, Category="MO|Medical|Scheduler")
+	EMOMedicalSimLOD GetActorLOD(const AActor* Actor) const;
+
+	/** Number of actors currently in a given LOD tier. */
+	UFUNCTION(BlueprintPure, Category="MO|Medical|Scheduler")
+	int32 GetActorCountForLOD(EMOMedicalSimLOD LOD) const;
+
+	/** Recompute LOD tiers now (otherwise done every LODUpdateInterval). Wakes and catches up dormant pawns as needed. */
+	UFUNCTION(BlueprintCallable, Category="MO|Medical|Scheduler")
+	void RefreshLOD();
+
+	// ============================================================================
+	// CHANGE NOTIFICATION
+	// ============================================================================
+
+	/**
+	 * Fired at most once per frame per pawn with every medical field that changed
+	 * noticeably since the last notification, merged across all medical components.
+	 */
+	UPROPERTY(BlueprintAssignable, Category="MO|Medical|Scheduler")
+	FMOOnMedicalDelta OnMedicalDelta;
+
+	/**
+	 * Queue changed fields for a component's owner. Deltas are merged per pawn and
+	 * broadcast at the end of the current pass, or next frame outside a pass.
+	 * Works whether or not the component is driven by the scheduler.
+	 */
+	static void QueueMedicalDelta(const UActorComponent* Source, const FMOMedicalDelta& Delta);
+
+	/** Broadcast and clear all queued deltas. */
+	void FlushMedicalDeltas();
+
+	// ============================================================================
+	// EVENT QUEUE
+	// ============================================================================
+
+	/**
+	 * Queue a wound or condition state transition at world time Time (seconds).
+	 * The anatomy component is called back on the first pass at or after Time and
+	 * ignores the entry if the target is gone or Serial no longer matches.
+	 */
+	void ScheduleMedicalEvent(UMOAnatomyComponent* Component, const FGuid& TargetId, bool bIsCondition, uint32 Serial, double Time);
+
+	/** Number of queued events, including stale entries not yet popped. */
+	UFUNCTION(BlueprintPure, Category="MO|Medical|Scheduler")
+	int32 GetPendingEventCount() const { return EventQueue.Num(); }
+
+	/** Run one scheduler pass immediately (also used by the timer). */
+	void RunPass();
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Registered components of one type plus per-component time accumulators. */
+	template<typename ComponentType>
+	struct TStageList
+	{
+		TArray<TWeakObjectPtr<ComponentType>> Components;
+		TArray<float> Accumulators;
+		TArray<EMOMedicalSimLOD> LODs;
+		int32 LiveCount = 0;
+	};
+
+	/** One pending wound/condition transition in EventQueue. */
+	struct FMedicalEvent
+	{
+		double Time = 0.0;
+		TWeakObjectPtr<UMOAnatomyComponent> Component;
+		FGuid TargetId;
+		uint32 Serial = 0;
+		bool bIsCondition = false;
+
+		bool operator<(const FMedicalEvent& Other) const { return Time < Other.Time; }
+	};
+
+	template<typename ComponentType>
+	bool AddToStage(TStageList<ComponentType>& List, ComponentType* Component);
+
+	template<typename ComponentType>
+	void RemoveFromStage(TStageList<ComponentType>& List, ComponentType* Component);
+
+	template<typename ComponentType>
+	void RunStage(EMOMedicalSimStage Stage, TStageList<ComponentType>& List, float DeltaSeconds,
+		void (ComponentType::*AdvanceFunction)(float), float ComponentType::*IntervalMember);
+
+	/**
+	 * Apply freshly computed ActorLODs to one stage. Components waking from dormancy
+	 * replay their banked time through CatchUpFunction in steps of at most MaxCatchUpStep.
+	 */
+	template<typename ComponentType, typename CatchUpReturnType>
+	void ApplyLODToStage(TStageList<ComponentType>& List, CatchUpReturnType (ComponentType::*CatchUpFunction)(float),
+		float ComponentType::*IntervalMember, float MaxCatchUpStep);
+
+	template<typename ComponentType>
+	void CompactStage(TStageList<ComponentType>& List);
+
+	/** Compact every stage if a removal was deferred. */
+	void CompactStagesIfNeeded();
+
+	/** Pop and dispatch every event due at or before the current world time. */
+	void ProcessDueEvents();
+
+	/** Vitals stage using the SoA batch kernels instead of per-component derivation. */
+	void RunVitalsStageBatched(float DeltaSeconds);
+
+	/** Start the pass timer if needed (first registration). */
+	void EnsureTimerRunning();
+
+	/** Stop the pass timer when nothing is registered. */
+	void StopTimerIfIdle();
+
+	int32 GetTotalLiveCount() const;
+
+	/** Step size for one tick of a component at the given LOD. */
+	float GetStepForLOD(float Interval, EMOMedicalSimLOD LOD) const;
+
+	/** Classify one actor against the current player viewpoints. */
+	EMOMedicalSimLOD ComputeActorLOD(const AActor* Actor, const TArray<FVector>& Viewpoints) const;
+
+private:
+	TStageList<UMOAnatomyComponent> AnatomyStage;
+	TStageList<UMOVitalsComponent> VitalsStage;
+	TStageList<UMOMetabolismComponent> MetabolismStage;
+	TStageList<UMOMentalStateComponent> MentalStage;
+	TStageList<UMOSurvivalStatsComponent> SurvivalStage;
+
+	/** Reusable SoA scratch for the batched vitals stage. */
+	FMOVitalsBatch VitalsBatch;
+
+	/** Components gathered into VitalsBatch this pass (parallel to batch indices). */
+	TArray<TWeakObjectPtr<UMOVitalsComponent>> VitalsBatchComponents;
+
+	/** Step each batched component advances by this pass (parallel to batch indices). */
+	TArray<float> VitalsBatchSteps;
+
+	/** LOD per owning actor, rebuilt by RefreshLOD. */
+	TMap<TObjectKey<AActor>, EMOMedicalSimLOD> ActorLODs;
+
+	/** Actor counts per LOD tier from the last refresh. */
+	int32 LODCounts[static_cast<int32>(EMOMedicalSimLOD::MAX)] = {};
+
+	/** Time since the last LOD refresh (seconds). */
+	float LODRefreshAccumulator = 0.0f;
+
+	/** Coarse step multiplier captured at the last refresh. */
+	float CoarseStepMultiplier = 4.0f;
+
+	FMOMedicalStageStats StageStats[static_cast<int32>(EMOMedicalSimStage::MAX)];
+	FMOMedicalStageStats PassStats;
+
+	FTimerHandle PassTimerHandle;
+
+	/** Min-heap of wound/condition transitions ordered by world time. */
+	TArray<FMedicalEvent> EventQueue;
+
+	/** Scratch for events popped this pass (dispatch may push new ones). */
+	TArray<FMedicalEvent> DueEvents;
+
+	/** Changed fields per pawn waiting for FlushMedicalDeltas. */
+	TMap<TWeakObjectPtr<AActor>, FMOMedicalDelta> PendingDeltas;
+
+	/** True once a next-frame flush has been requested. */
+	bool bDeltaFlushScheduled = false;
+
+	/** Interval the timer was started with (seconds). */
+	float PassInterval = 0.5f;
+
+	/** True while RunPass is iterating; removals are deferred until the pass ends. */
+	bool bIsRunningPass = false;
+
+	/** Set when a removal happened mid-pass and the lists need compacting. */
+	bool bNeedsCompaction = false;
+};
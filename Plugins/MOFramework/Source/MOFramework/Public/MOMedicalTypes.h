@@ -150,7 +150,9 @@ enum class EMOConditionType : uint8
 	Hypothermia,
 	Hyperthermia,
 	Dehydration,
-	Starvation
+	Starvation,
+
+	MAX					UMETA(Hidden)
 };
 
 /**
@@ -178,6 +180,40 @@ enum class EMOBloodLossStage : uint8
 	Class3		// >40% - critical, unconscious, death imminent
 };
 
+/**
+ * Individual fields reported by a medical delta notification.
+ * Values are bit indices into FMOMedicalDelta::ChangedFields.
+ */
+UENUM(BlueprintType)
+enum class EMOMedicalDeltaField : uint8
+{
+	// Vitals
+	HeartRate,
+	BloodPressure,
+	SpO2,
+	RespiratoryRate,
+	BodyTemperature,
+	BloodVolume,
+	BloodGlucose,
+
+	// Metabolism
+	Glycogen,
+	Hydration,
+	ProteinBalance,
+	Micronutrients,		// Vitamins and minerals
+	BodyComposition,	// Weight, fat, muscle
+	Fitness,			// Strength and cardio
+	Digestion,			// Food added to or removed from the digestion queue
+
+	// Mental
+	Consciousness,
+	Shock,
+	Stress,				// Traumatic stress and morale fatigue
+	MentalEffects,		// Aim shake, tunnel vision, blur, stumbling
+
+	MAX					UMETA(Hidden)
+};
+
 
 // ============================================================================
 // WOUND STRUCTURES
@@ -240,6 +276,17 @@ struct MOFRAMEWORK_API FMOWound : public FFastArraySerializerItem
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Medical|Wound")
 	float TimeSinceInflicted = 0.0f;
 
+	// Event scheduling bookkeeping (authority only; not replicated, only EventSerial is saved)
+
+	/** World time the time-dependent fields above were last brought up to date. */
+	double EventSyncTime = 0.0;
+
+	/** Sampled world time of infection onset, or negative if none is pending. */
+	double InfectionOnsetTime = -1.0;
+
+	/** Bumped on every reschedule so superseded queue entries are ignored. */
+	uint32 EventSerial = 0;
+
 	FMOWound()
 	{
 		WoundId = FGuid::NewGuid();
@@ -324,6 +371,14 @@ struct MOFRAMEWORK_API FMOCondition : public FFastArraySerializerItem
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Medical|Condition")
 	bool bIsTreated = false;
 
+	// Event scheduling bookkeeping (authority only; not replicated, only EventSerial is saved)
+
+	/** World time Severity and Duration were last brought up to date. */
+	double EventSyncTime = 0.0;
+
+	/** Bumped on every reschedule so superseded queue entries are ignored. */
+	uint32 EventSerial = 0;
+
 	FMOCondition()
 	{
 		ConditionId = FGuid::NewGuid();
@@ -413,6 +468,18 @@ struct MOFRAMEWORK_API FMOBodyPartState
 
 	/** Check if the body part is functional. */
 	bool IsFunctional() const { return Status == EMOBodyPartStatus::Healthy || Status == EMOBodyPartStatus::Injured; }
+
+	/** Quantized replication (HP as 10-bit fraction of MaxHP). Clients see values at reduced precision. */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMOBodyPartState> : public TStructOpsTypeTraitsBase2<FMOBodyPartState>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
 };
 
 
@@ -513,6 +580,18 @@ struct MOFRAMEWORK_API FMOVitalSigns
 
 	/** Check for hyperthermia/fever. */
 	bool IsHyperthermic() const { return BodyTemperature > 38.0f; }
+
+	/** Quantized replication (~100 bits instead of ten full floats). Clients see values at reduced precision. */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FMOVitalSigns> : public TStructOpsTypeTraitsBase2<FMOVitalSigns>
+{
+	enum
+	{
+		WithNetSerializer = true,
+	};
 };
 
 /**
@@ -897,3 +976,68 @@ struct MOFRAMEWORK_API FMOMentalState
 		return Consciousness == EMOConsciousnessLevel::Alert;
 	}
 };
+
+// ============================================================================
+// CHANGE NOTIFICATION
+// ============================================================================
+
+/**
+ * Set of medical fields that changed for one pawn since the last notification.
+ * Components compare against the last notified value with a per-field epsilon,
+ * so slow drift is reported once it adds up rather than every tick.
+ */
+USTRUCT(BlueprintType)
+struct MOFRAMEWORK_API FMOMedicalDelta
+{
+	GENERATED_BODY()
+
+	/** Bitmask of EMOMedicalDeltaField indices. */
+	UPROPERTY(BlueprintReadOnly, Category="MO|Medical", meta=(Bitmask, BitmaskEnum="/Script/MOFramework.EMOMedicalDeltaField"))
+	int32 ChangedFields = 0;
+
+	static constexpr int32 FieldBit(EMOMedicalDeltaField Field) { return 1 << static_cast<int32>(Field); }
+
+	static constexpr int32 VitalsFields = (1 << static_cast<int32>(EMOMedicalDeltaField::Glycogen)) - 1;
+	static constexpr int32 MetabolismFields = ((1 << static_cast<int32>(EMOMedicalDeltaField::Consciousness)) - 1) & ~VitalsFields;
+	static constexpr int32 MentalFields = ((1 << static_cast<int32>(EMOMedicalDeltaField::MAX)) - 1) & ~(VitalsFields | MetabolismFields);
+
+	bool IsEmpty() const { return ChangedFields == 0; }
+	bool HasField(EMOMedicalDeltaField Field) const { return (ChangedFields & FieldBit(Field)) != 0; }
+	bool HasAnyField(int32 Mask) const { return (ChangedFields & Mask) != 0; }
+	void MarkField(EMOMedicalDeltaField Field) { ChangedFields |= FieldBit(Field); }
+
+	/**
+	 * Mark Field if NewValue is at least Epsilon away from LastValue.
+	 * LastValue is only updated when the field is marked.
+	 */
+	void CheckField(EMOMedicalDeltaField Field, float& LastValue, float NewValue, float Epsilon)
+	{
+		if (FMath::Abs(NewValue - LastValue) >= Epsilon)
+		{
+			LastValue = NewValue;
+			MarkField(Field);
+		}
+	}
+};
+
+
+// ============================================================================
+// DETERMINISTIC RANDOMNESS
+// ============================================================================
+
+/**
+ * Seeding for the per-pawn random streams used by the medical simulation.
+ * A pawn's stream depends only on its identity GUID, the configured world seed
+ * and the component type, so the same scenario replays the same rolls.
+ */
+struct MOFRAMEWORK_API FMOMedicalRandom
+{
+	/** Combine an identity GUID, world seed and per-component salt into a stream seed. */
+	static int32 MakeSeed(const FGuid& IdentityGuid, int32 WorldSeed, uint32 Salt);
+
+	/**
+	 * Seed Stream for a medical component. Uses the owner's UMOIdentityComponent GUID
+	 * (created on authority if missing), or the owner's name when there is none.
+	 */
+	static void InitStream(FRandomStream& Stream, const UActorComponent* Component);
+};
@@ -45,6 +45,8 @@ class MOFRAMEWORK_API UMOMentalStateComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend class UMOMedicalSchedulerSubsystem;
+
 public:
 	UMOMentalStateComponent();
 
@@ -245,6 +247,13 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Mental|Query")
 	bool RollForStumble();
 
+	/**
+	 * Reseed this pawn's random stream from its identity GUID and MedicalRandomSeed.
+	 * Done at BeginPlay and whenever the owner's identity GUID is assigned afterwards.
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Mental")
+	void ReseedRandomStream();
+
 	// ============================================================================
 	// PERSISTENCE
 	// ============================================================================
@@ -277,6 +286,13 @@ private:
 	/** Tick interval in seconds. */
 	float TickInterval = 0.5f;
 
+	/** Per-pawn stream for stumble rolls (see FMOMedicalRandom). */
+	FRandomStream RandomStream;
+
+	/** Reseed when the owner's identity GUID is set after BeginPlay (e.g. loading). */
+	UFUNCTION()
+	void HandleIdentityGuidAvailable(const FGuid& StableGuid);
+
 	/** Cached reference to vitals component. */
 	UPROPERTY(Transient)
 	TObjectPtr<UMOVitalsComponent> CachedVitalsComp;
@@ -292,6 +308,9 @@ private:
 	/** Previous consciousness level for change detection. */
 	EMOConsciousnessLevel PreviousConsciousness = EMOConsciousnessLevel::Alert;
 
+	/** Mental state as of the last change notification. */
+	FMOMentalState LastNotifiedMentalState;
+
 	/** Forced consciousness (if set, overrides calculated). */
 	bool bConsciousnessForced = false;
 
@@ -302,6 +321,12 @@ private:
 	/** Periodic tick to process mental state. */
 	void TickMentalState();
 
+	/** Advance mental state by DeltaSeconds of unscaled time (used by the scheduler for LOD steps). */
+	void AdvanceSimulation(float DeltaSeconds);
+
+	/** Compare against LastNotifiedMentalState and latch the fields that changed. */
+	FMOMedicalDelta ConsumeMentalDelta();
+
 	/** Calculate consciousness level based on all factors. */
 	void CalculateConsciousnessLevel();
 
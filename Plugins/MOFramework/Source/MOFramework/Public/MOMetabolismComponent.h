@@ -95,6 +95,8 @@ class MOFRAMEWORK_API UMOMetabolismComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend class UMOMedicalSchedulerSubsystem;
+
 public:
 	UMOMetabolismComponent();
 
@@ -134,6 +136,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Metabolism|Config", meta=(ClampMin="0", ClampMax="1"))
 	float FitnessDecayRate = 0.01f;
 
+	/** Longest integration segment used by FastForward (game seconds). Shorter is more accurate. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="MO|Metabolism|Config", meta=(ClampMin="1"))
+	float FastForwardMaxSegment = 600.0f;
+
 	// ============================================================================
 	// TRACKING
 	// ============================================================================
@@ -174,7 +180,7 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="MO|Metabolism|Events")
 	FMOOnDeficiencyDetected OnDeficiencyDetected;
 
-	/** Fired when any metabolism value changes (for UI updates). */
+	/** Fired after a tick in which a metabolism value moved noticeably (for UI updates). */
 	UPROPERTY(BlueprintAssignable, Category="MO|Metabolism|Events")
 	FMOOnMetabolismChanged OnMetabolismChanged;
 
@@ -253,6 +259,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Metabolism|Training")
 	void ApplyCardioTraining(float Intensity, float Duration);
 
+	// ============================================================================
+	// TIME API
+	// ============================================================================
+
+	/**
+	 * Advance metabolism by a long span of time in a handful of segments instead of
+	 * one tick per TickInterval (sleep, dormant pawns, offline catch-up).
+	 * Digestion is integrated in closed form between absorption-phase boundaries;
+	 * everything else is piecewise-linear over segments of at most FastForwardMaxSegment.
+	 * Results match per-tick stepping within a small tolerance.
+	 * @param Seconds Real seconds to advance (TimeScaleMultiplier is applied).
+	 * @return True if time was advanced (authority only).
+	 */
+	UFUNCTION(BlueprintCallable, Category="MO|Metabolism|Time")
+	bool FastForward(float Seconds);
+
 	// ============================================================================
 	// QUERY API
 	// ============================================================================
@@ -337,6 +359,7 @@ protected:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void GetResourceSizeEx(FResourceSizeEx& CumulativeResourceSize) override;
 
 private:
 	// ============================================================================
@@ -363,6 +386,11 @@ private:
 	/** Track previous starvation for event detection. */
 	bool bWasStarving = false;
 
+	/** Values as of the last change notification. */
+	FMONutrientLevels LastNotifiedNutrients;
+	FMOBodyComposition LastNotifiedBody;
+	int32 LastNotifiedDigestCount = 0;
+
 	// ============================================================================
 	// INTERNAL METHODS
 	// ============================================================================
@@ -370,12 +398,30 @@ private:
 	/** Periodic tick to process metabolism. */
 	void TickMetabolism();
 
+	/** Advance metabolism by DeltaSeconds of unscaled time (used by the scheduler for LOD steps). */
+	void AdvanceSimulation(float DeltaSeconds);
+
 	/** Process digestion for all food items. */
 	void ProcessDigestion(float DeltaTime);
 
 	/** Process a single digesting food item. */
 	void ProcessDigestingFood(FMODigestingFood& Food, float DeltaTime);
 
+	/** Closed-form digestion of all food items over DeltaTime (no phase boundary may lie inside it). */
+	void FastForwardDigestion(float DeltaTime);
+
+	/** Time until the next digestion phase boundary of any food item, capped at MaxSegment. */
+	float GetNextDigestionBoundary(float MaxSegment) const;
+
+	/** Broadcast and remove fully digested food items. */
+	void RemoveCompletedFood();
+
+	/** Fire starvation/dehydration/deficiency events and the UI change event after time advanced. */
+	void UpdateMetabolismState();
+
+	/** Compare against the last notified values and latch the fields that changed. */
+	FMOMedicalDelta ConsumeMetabolismDelta();
+
 	/** Apply basal calorie consumption. */
 	void ProcessBasalMetabolism(float DeltaTime);
 
@@ -8,6 +8,49 @@
 
 class UDataTable;
 
+/**
+ * Precompiled view of the recipe DataTable for menu and availability queries.
+ *
+ * Every bucket is a dense, DataTable-ordered array of positions into Rows/Ids, so a station's recipe list or
+ * the recipes a knowledge ID unlocks are read without touching the rest of the table. Row pointers point into
+ * the DataTable's own storage; the index is rebuilt whenever the table changes, so do not hold positions or
+ * row pointers across frames.
+ */
+struct MOFRAMEWORK_API FMORecipeIndex
+{
+	/** Every recipe, in DataTable order. Ids[i] is the row name of Rows[i]. */
+	TArray<const FMORecipeDefinitionRow*> Rows;
+	TArray<FName> Ids;
+
+	/** Recipe positions by RequiredStation, indexed by the enum value. */
+	TArray<TArray<int32>> ByStation;
+
+	/** Recipe positions by RequiredSkillId (recipes without a skill are under NAME_None). */
+	TMap<FName, TArray<int32>> BySkill;
+
+	/** Recipe positions by each knowledge ID they require, i.e. the recipes that knowledge unlocks. */
+	TMap<FName, TArray<int32>> ByKnowledge;
+
+	/** Recipe positions by each ingredient ItemDefinitionId they consume, i.e. the recipes an inventory change can affect. */
+	TMap<FName, TArray<int32>> ByIngredient;
+
+	/** Recipe positions by each ItemDefinitionId they output, i.e. the ways to make an item. */
+	TMap<FName, TArray<int32>> ByOutput;
+
+	TMap<FName, int32> PositionById;
+
+	/** Rebuild from a recipe DataTable. Leaves the index empty if the table does not use FMORecipeDefinitionRow. */
+	void Build(const UDataTable& DataTable);
+	void Reset();
+
+	/** Positions of recipes craftable at Station: hand recipes (None) plus the station's own, merged in DataTable order. */
+	void GetStationPositions(EMOCraftingStation Station, TArray<int32>& OutPositions) const;
+
+	const TArray<int32>& GetStationBucket(EMOCraftingStation Station) const;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FMORecipeIndexResetSignature, const FMORecipeIndex& /*OldIndex*/);
+
 /**
  * Project Settings entry to point the plugin at a recipe definition DataTable.
  */
@@ -28,6 +71,22 @@ public:
 
 	UDataTable* GetRecipeDefinitionsDataTable() const;
 
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+	/** The recipe index for the configured DataTable, built on first use. Game thread only. */
+	static const FMORecipeIndex& GetRecipeIndex();
+
+	/** Drop the recipe index; it is rebuilt on the next lookup. Called automatically when the DataTable or this setting changes. */
+	static void ResetRecipeIndex();
+
+	/**
+	 * Fires just before a built recipe index is dropped, passing it while its Ids are still readable (Rows may
+	 * not be). Holders of positions must discard them and re-read the index later, not from inside the callback.
+	 */
+	static FMORecipeIndexResetSignature& OnRecipeIndexReset();
+
 	/** Look up a recipe definition by ID. Returns pointer or nullptr if not found. */
 	static const FMORecipeDefinitionRow* GetRecipeDefinition(FName RecipeId);
 
@@ -35,7 +94,8 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Recipe Database", meta=(DisplayName="Get Recipe Definition"))
 	static bool GetRecipeDefinitionBP(FName RecipeId, FMORecipeDefinitionRow& OutDefinition);
 
-	/** Get the icon for a recipe (loads synchronously). Returns nullptr if not found. */
+	/** Get the icon for a recipe (loads synchronously). Returns nullptr if not found.
+	 *  Widgets should prefer UMOItemAssetStreamingSubsystem::RequestAsset, which does not block. */
 	UFUNCTION(BlueprintCallable, Category="MO|Recipe Database")
 	static UTexture2D* GetRecipeIcon(FName RecipeId);
 
@@ -51,6 +111,14 @@ public:
 	UFUNCTION(BlueprintCallable, Category="MO|Recipe Database")
 	static void GetRecipesForStation(EMOCraftingStation Station, TArray<FName>& OutRecipeIds);
 
+	/** Get all recipes governed by a skill. */
+	UFUNCTION(BlueprintCallable, Category="MO|Recipe Database")
+	static void GetRecipesForSkill(FName SkillId, TArray<FName>& OutRecipeIds);
+
+	/** Get all recipes that require a knowledge ID (the recipes learning it can unlock). */
+	UFUNCTION(BlueprintCallable, Category="MO|Recipe Database")
+	static void GetRecipesRequiringKnowledge(FName KnowledgeId, TArray<FName>& OutRecipeIds);
+
 	/** Check if the Recipe Database is properly configured. */
 	UFUNCTION(BlueprintCallable, Category="MO|Recipe Database")
 	static bool IsConfigured();
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MOSimulationClockSubsystem.generated.h"
+
+/** The mapping from world time to simulation time changed (time scale set, or time skipped). */
+DECLARE_MULTICAST_DELEGATE(FMOSimulationClockChangedSignature);
+
+/**
+ * Shared monotonic game-time source for simulation systems.
+ *
+ * Simulation time follows world time, so it stops while the game is paused and honours global time
+ * dilation. On top of that it runs at TimeScale and can be skipped forward (sleeping, waiting), which
+ * moves every system on the clock forward by the same amount. It never runs backwards.
+ *
+ * Systems that arm world-time timers against simulation deadlines re-arm on OnClockChanged.
+ * Outside Game/PIE worlds there is no clock and GetSimTime returns world time.
+ */
+UCLASS()
+class MOFRAMEWORK_API UMOSimulationClockSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Clock for WorldContextObject's world, or nullptr (editor and preview worlds). */
+	static UMOSimulationClockSubsystem* Get(const UObject* WorldContextObject);
+
+	/** Simulation time of WorldContextObject's world, or its world time when there is no clock. */
+	static double GetSimTime(const UObject* WorldContextObject);
+
+	/** Current simulation time (seconds). */
+	UFUNCTION(BlueprintPure, Category="MO|Simulation|Clock")
+	double GetTime() const;
+
+	/** Simulation seconds per world second. */
+	UFUNCTION(BlueprintPure, Category="MO|Simulation|Clock")
+	float GetTimeScale() const { return TimeScale; }
+
+	/** Change how fast simulation time runs from now on (0 freezes it). */
+	UFUNCTION(BlueprintCallable, Category="MO|Simulation|Clock")
+	void SetTimeScale(float NewTimeScale);
+
+	/** Skip simulation time forward, e.g. while the player sleeps. Anything due in the skipped span runs now. */
+	UFUNCTION(BlueprintCallable, Category="MO|Simulation|Clock")
+	void FastForward(float SimSeconds);
+
+	/** World seconds until simulation time reaches SimTime at the current scale (0 if already there, max if frozen). */
+	double GetWorldDelayUntil(double SimTime) const;
+
+	/** Broadcast after SetTimeScale or FastForward. */
+	FMOSimulationClockChangedSignature OnClockChanged;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	/** Fold elapsed time into the anchor so the scale can change without moving the current time. */
+	void Rebase();
+
+	double GetWorldTime() const;
+
+	/** Simulation time at AnchorWorldTime. */
+	double AnchorSimTime = 0.0;
+
+	double AnchorWorldTime = 0.0;
+
+	float TimeScale = 1.0f;
+};
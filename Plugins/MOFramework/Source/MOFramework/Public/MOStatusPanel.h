@@ -2,6 +2,7 @@
 
 #include "CoreMinimal.h"
 #include "CommonActivatableWidget.h"
+#include "MOMedicalTypes.h"
 #include "MOStatusPanel.generated.h"
 
 class UMOStatusField;
@@ -12,6 +13,7 @@ class UVerticalBox;
 class UMOVitalsComponent;
 class UMOMetabolismComponent;
 class UMOMentalStateComponent;
+class UMOMedicalSchedulerSubsystem;
 
 /**
  * Status category for organizing fields into tabs
@@ -200,9 +202,13 @@ protected:
 	UFUNCTION()
 	void HandleMentalStateChanged();
 
-	/** Update fields from bound components */
-	void UpdateVitalsFields();
-	void UpdateMetabolismFields();
+	/** Coalesced per-frame change handler (preferred over the per-component events when available) */
+	UFUNCTION()
+	void HandleMedicalDelta(AActor* Pawn, const FMOMedicalDelta& Delta);
+
+	/** Update fields from bound components, limited to the given EMOMedicalDeltaField bits */
+	void UpdateVitalsFields(int32 ChangedFields = -1);
+	void UpdateMetabolismFields(int32 ChangedFields = -1);
 	void UpdateMentalStateFields();
 
 protected:
@@ -323,4 +329,11 @@ protected:
 
 	UPROPERTY()
 	TWeakObjectPtr<UMOMentalStateComponent> BoundMentalState;
+
+	/** Scheduler providing coalesced medical deltas, and the pawn they are filtered to */
+	UPROPERTY()
+	TWeakObjectPtr<UMOMedicalSchedulerSubsystem> BoundScheduler;
+
+	UPROPERTY()
+	TWeakObjectPtr<AActor> BoundPawn;
 };
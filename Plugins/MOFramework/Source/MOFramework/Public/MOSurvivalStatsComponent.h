@@ -98,6 +98,8 @@ class MOFRAMEWORK_API UMOSurvivalStatsComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend class UMOMedicalSchedulerSubsystem;
+
 public:
 	UMOSurvivalStatsComponent();
 
@@ -175,10 +177,12 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 private:
 	void TickStats();
+	void AdvanceSimulation(float DeltaSeconds);
 	void ProcessStatTick(FMOSurvivalStat& Stat, FName StatName, float DeltaTime);
 	void DecayNutrition(float DeltaTime);
 	FMOSurvivalStat* GetStatByName(FName StatName);
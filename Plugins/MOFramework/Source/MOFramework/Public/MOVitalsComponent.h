@@ -3,6 +3,7 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "MOMedicalTypes.h"
+#include "MOVitalsKernels.h"
 #include "MOVitalsComponent.generated.h"
 
 class UMOAnatomyComponent;
@@ -48,6 +49,8 @@ class MOFRAMEWORK_API UMOVitalsComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
+	friend class UMOMedicalSchedulerSubsystem;
+
 public:
 	UMOVitalsComponent();
 
@@ -95,7 +98,7 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="MO|Vitals|Events")
 	FMOOnRespiratoryFailure OnRespiratoryFailure;
 
-	/** Fired when any vital sign changes (for UI updates). */
+	/** Fired after a tick in which at least one vital sign moved noticeably (for UI updates). */
 	UPROPERTY(BlueprintAssignable, Category="MO|Vitals|Events")
 	FMOOnVitalsChanged OnVitalsChanged;
 
@@ -247,6 +250,9 @@ private:
 	/** Tick interval in seconds. */
 	float TickInterval = 0.5f;
 
+	/** Vital signs as of the last change notification. */
+	FMOVitalSigns LastNotifiedVitals;
+
 	/** Previous blood loss stage for change detection. */
 	EMOBloodLossStage PreviousBloodLossStage = EMOBloodLossStage::None;
 
@@ -269,17 +275,23 @@ private:
 	/** Periodic tick to update vitals. */
 	void TickVitals();
 
-	/** Calculate heart rate based on all factors. */
-	void CalculateHeartRate();
+	/** Advance vitals by DeltaSeconds of unscaled time (used by the scheduler for LOD steps). */
+	void AdvanceSimulation(float DeltaSeconds);
+
+	/** First half of a tick: authority check and pain sync. Returns false if the tick should not run. */
+	bool BeginVitalsTick();
+
+	/** Second half of a tick: blood regen, recovery, critical checks, glucose, broadcast. */
+	void FinishVitalsTick(float DeltaSeconds);
 
-	/** Calculate blood pressure based on all factors. */
-	void CalculateBloodPressure();
+	/** Compare against LastNotifiedVitals and latch the fields that changed. */
+	FMOMedicalDelta ConsumeVitalsDelta();
 
-	/** Calculate respiratory rate. */
-	void CalculateRespiratoryRate();
+	/** Gather inputs for heart rate / blood pressure / respiratory rate / SpO2 derivation. */
+	FMOVitalsDerivationInput BuildDerivationInput() const;
 
-	/** Calculate oxygen saturation. */
-	void CalculateOxygenSaturation();
+	/** Write derived vitals back and broadcast significant changes. */
+	void ApplyDerivedVitals(const FMOVitalsDerivationOutput& Derived);
 
 	/** Regenerate blood over time. */
 	void RegenerateBlood(float DeltaTime);
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// ============================================================================
+// DERIVATION INPUT / OUTPUT
+// ============================================================================
+
+/**
+ * Snapshot of everything needed to derive heart rate, blood pressure,
+ * respiratory rate and SpO2 for one pawn. Gathered from the vitals component
+ * and its siblings before the derivation runs.
+ */
+struct MOFRAMEWORK_API FMOVitalsDerivationInput
+{
+	float BloodVolume = 5000.0f;
+	float MaxBloodVolume = 5000.0f;
+	float BaseHeartRate = 72.0f;
+	float BodyTemperature = 37.0f;
+	float BloodGlucose = 90.0f;
+	float SpO2 = 98.0f;
+
+	float CurrentExertion = 0.0f;
+	float StressLevel = 0.0f;
+	float PainLevel = 0.0f;
+
+	/** Cardiovascular fitness (0-100), only used when bHasFitness is set. */
+	float Fitness = 50.0f;
+	bool bHasFitness = false;
+
+	/** SpO2 penalty from lung damage (0, -15 or -50). */
+	float LungMod = 0.0f;
+};
+
+/**
+ * Derived vital signs for one pawn.
+ */
+struct MOFRAMEWORK_API FMOVitalsDerivationOutput
+{
+	float HeartRate = 0.0f;
+	float SystolicBP = 0.0f;
+	float DiastolicBP = 0.0f;
+	float RespiratoryRate = 0.0f;
+	float SpO2 = 0.0f;
+};
+
+// ============================================================================
+// SCALAR KERNELS
+// ============================================================================
+
+/**
+ * Pure derivation formulas for the vitals component.
+ * UMOVitalsComponent uses these directly; FMOVitalsBatch runs the same math
+ * four pawns at a time and must produce bit-identical results.
+ */
+struct MOFRAMEWORK_API FMOVitalsKernels
+{
+	/** Blood loss as percentage of max (0-100), same as FMOVitalSigns::GetBloodLossPercent() * 100. */
+	static float GetBloodLossPercent(float BloodVolume, float MaxBloodVolume);
+
+	static float DeriveHeartRate(const FMOVitalsDerivationInput& In);
+	static void DeriveBloodPressure(const FMOVitalsDerivationInput& In, float& OutSystolic, float& OutDiastolic);
+	static float DeriveRespiratoryRate(const FMOVitalsDerivationInput& In);
+	static float DeriveOxygenSaturation(const FMOVitalsDerivationInput& In);
+
+	/** Run all four derivations. */
+	static FMOVitalsDerivationOutput Derive(const FMOVitalsDerivationInput& In);
+};
+
+// ============================================================================
+// STRUCTURE-OF-ARRAYS BATCH
+// ============================================================================
+
+/**
+ * Structure-of-arrays batch of vitals derivation inputs/outputs.
+ *
+ * The medical scheduler gathers all due vitals components into one batch per
+ * pass, runs DeriveAll() (SIMD, 4 lanes) and scatters the outputs back.
+ * Arrays are padded to a multiple of the lane width; padding lanes are ignored.
+ */
+struct MOFRAMEWORK_API FMOVitalsBatch
+{
+	static constexpr int32 LaneWidth = 4;
+
+	/** Clear the batch, keeping allocations for reuse. */
+	void Reset();
+
+	/** Append one pawn. Returns its index in the batch. */
+	int32 Add(const FMOVitalsDerivationInput& In);
+
+	/** Number of pawns in the batch (excluding padding). */
+	int32 Num() const { return Count; }
+
+	/** Read back derived values for one pawn. Valid after DeriveAll/DeriveAllScalar. */
+	FMOVitalsDerivationOutput GetOutput(int32 Index) const;
+
+	/** Vectorized derivation over all pawns. */
+	void DeriveAll();
+
+	/** Scalar reference derivation over all pawns (same results as DeriveAll). */
+	void DeriveAllScalar();
+
+private:
+	/** Pad all arrays up to a multiple of LaneWidth with benign values. */
+	void PadToLaneWidth();
+
+	int32 Count = 0;
+
+	// Inputs
+	TArray<float> BloodVolume;
+	TArray<float> MaxBloodVolume;
+	TArray<float> BaseHeartRate;
+	TArray<float> BodyTemperature;
+	TArray<float> BloodGlucose;
+	TArray<float> InSpO2;
+	TArray<float> CurrentExertion;
+	TArray<float> StressLevel;
+	TArray<float> PainLevel;
+	TArray<float> Fitness;
+	TArray<float> HasFitness;
+	TArray<float> LungMod;
+
+	// Outputs
+	TArray<float> HeartRate;
+	TArray<float> SystolicBP;
+	TArray<float> DiastolicBP;
+	TArray<float> RespiratoryRate;
+	TArray<float> OutSpO2;
+};
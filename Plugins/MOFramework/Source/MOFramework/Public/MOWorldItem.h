@@ -64,11 +64,20 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadWrite, Category="MO|Item|Drop")
 	float RestVelocityThreshold = 5.0f;
 
+	/** Re-evaluate instanced rendering: resting items draw through UMOWorldItemPoolSubsystem, moving or inactive ones
+	 *  draw their own mesh. Called on every state change; call it yourself after changing ItemMesh directly. */
+	void RefreshRenderInstance();
+
+	/** True if this actor came from UMOWorldItemPoolSubsystem and goes back there instead of being destroyed on pickup. */
+	bool IsPooled() const { return bPooled; }
+
 protected:
 	// Override interaction handling
 	UFUNCTION()
 	bool OnHandleInteract(AController* InteractorController);
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PostNetReceiveLocationAndRotation() override;
 	virtual void OnConstruction(const FTransform& Transform) override;
 
 	/** Called when drop physics completes - settles item on ground and disables physics. */
@@ -87,6 +96,9 @@ protected:
 	UFUNCTION()
 	void HandleItemDefinitionIdChanged(FName NewItemDefinitionId);
 
+	UFUNCTION()
+	void HandleWorldItemActiveChanged(bool bIsActive);
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category="MO")
 	TObjectPtr<USceneComponent> SceneRoot;
 
@@ -111,9 +123,27 @@ protected:
 	TObjectPtr<UMOInteractableComponent> InteractableComponent;
 
 private:
+	friend class UMOWorldItemPoolSubsystem;
+
+	/** Pool hooks: park hides the item and gives up its index entry and GUID; activate brings it back at a new transform. */
+	void ParkInPool();
+	void ActivateFromPool(const FTransform& SpawnTransform);
+
+	/** Spawned by the world item pool; returned there on pickup. */
+	bool bPooled = false;
+
+	/** Currently parked in the pool. */
+	bool bParkedInPool = false;
+
 	/** Track if we're currently in drop physics mode. */
 	bool bDropPhysicsActive = false;
 
 	/** Time when drop physics was enabled. */
 	float DropPhysicsStartTime = 0.0f;
+
+	/** EnableDropPhysics ran before the definition mesh was set; it runs again once the mesh is applied. */
+	bool bDropPhysicsPending = false;
+
+	/** True if ItemMesh holds a real definition mesh (not empty, not the streaming placeholder). */
+	bool HasDropPhysicsBody() const;
 };
@@ -0,0 +1,103 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MOWorldItemIndexSubsystem.generated.h"
+
+class UMOItemComponent;
+
+/**
+ * Spatial index over every world item (any actor with a UMOItemComponent) in the world.
+ *
+ * Items live in a uniform XY grid, once in the "any definition" layer and once in the layer for their
+ * ItemDefinitionId, so radius and nearest-of-type queries only visit the cells around the query point.
+ * Item components register on BeginPlay and unregister on EndPlay; movers (drop physics settle, definition
+ * changes) call UMOItemComponent::RefreshWorldItemIndex. Persistence capture walks the index instead of
+ * every actor in the world.
+ */
+UCLASS()
+class MOFRAMEWORK_API UMOWorldItemIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Edge length of one grid cell (cm). Roughly the radius of a typical gather/haul query. */
+	static constexpr float CellSize = 1000.0f;
+
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	// Registration (driven by UMOItemComponent)
+	void RegisterItem(UMOItemComponent* ItemComponent);
+	void UnregisterItem(UMOItemComponent* ItemComponent);
+
+	/** Re-file an item after it moved or its ItemDefinitionId changed. Registers it if it was not indexed. */
+	void UpdateItem(UMOItemComponent* ItemComponent);
+
+	// Queries. ItemDefinitionId None matches any item; picked-up (inactive) items are never returned.
+
+	/** All world items within Radius of Center, unordered. */
+	UFUNCTION(BlueprintCallable, Category="MO|World Items")
+	void FindItemsInRadius(const FVector& Center, float Radius, FName ItemDefinitionId, TArray<AActor*>& OutItemActors) const;
+
+	/** Closest world item to Origin, or nullptr. MaxRadius <= 0 searches the whole index. */
+	UFUNCTION(BlueprintCallable, Category="MO|World Items")
+	AActor* FindNearestItem(const FVector& Origin, FName ItemDefinitionId, float MaxRadius = 0.0f) const;
+
+	/** Every indexed item component, including inactive ones (save capture wants those too). */
+	void GetAllItems(TArray<UMOItemComponent*>& OutItemComponents) const;
+
+	UFUNCTION(BlueprintCallable, Category="MO|World Items")
+	int32 GetIndexedItemCount() const { return ItemsByComponent.Num(); }
+
+private:
+	struct FCellKey
+	{
+		FName ItemDefinitionId;
+		FIntPoint Cell;
+
+		bool operator==(const FCellKey& Other) const { return Cell == Other.Cell && ItemDefinitionId == Other.ItemDefinitionId; }
+		friend uint32 GetTypeHash(const FCellKey& Key) { return HashCombine(GetTypeHash(Key.ItemDefinitionId), GetTypeHash(Key.Cell)); }
+	};
+
+	struct FCellItem
+	{
+		TWeakObjectPtr<UMOItemComponent> ItemComponent;
+		FVector Location = FVector::ZeroVector;
+	};
+
+	struct FIndexedItem
+	{
+		TWeakObjectPtr<UMOItemComponent> ItemComponent;
+		FName ItemDefinitionId;
+		FVector Location = FVector::ZeroVector;
+		FIntPoint Cell = FIntPoint::ZeroValue;
+	};
+
+	static FIntPoint GetCellForLocation(const FVector& Location);
+
+	void AddToCells(const FIndexedItem& Item);
+	void RemoveFromCells(const FIndexedItem& Item);
+
+	/** Owning actor if the component is still alive and its item is active in the world, else nullptr. */
+	static AActor* ResolveActiveItem(const FCellItem& CellItem);
+
+	/** Indexed items by component. */
+	TMap<TObjectKey<UMOItemComponent>, FIndexedItem> ItemsByComponent;
+
+	/** (definition or None, cell) -> items in that cell. */
+	TMap<FCellKey, TArray<FCellItem>> Cells;
+
+	struct FLayerStats
+	{
+		int32 ItemCount = 0;
+
+		/** Cells occupied since the layer was last empty; bounds an unlimited nearest search. Only grows. */
+		FIntPoint MinCell = FIntPoint(MAX_int32, MAX_int32);
+		FIntPoint MaxCell = FIntPoint(MIN_int32, MIN_int32);
+	};
+
+	/** Per layer (definition or None). A layer is removed when its last item leaves, so misses return at once. */
+	TMap<FName, FLayerStats> Layers;
+};
@@ -0,0 +1,105 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "MOWorldItemPoolSubsystem.generated.h"
+
+class AMOWorldItem;
+struct FActorSpawnParameters;
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+
+/**
+ * Keeps dropped world items cheap.
+ *
+ * Actor pool (authority): DropItemByGuid acquires AMOWorldItems from here and pickups hand them back, so a
+ * busy drop/pickup loop reuses parked actors instead of spawning and destroying one per drop. Parked actors
+ * are inactive, hidden, net-dormant, out of the world item index and have no GUID.
+ *
+ * Instanced rendering (every net mode, purely local): an item resting on the ground hides its own mesh and
+ * draws through one instanced static mesh per mesh/material pair. The actor itself stays alive for identity,
+ * persistence and interaction traces; it gets its mesh back as soon as physics, pickup or a definition change
+ * needs it.
+ *
+ * Console variables: mo.WorldItems.PoolSize (parked actors kept per class, 0 disables pooling) and
+ * mo.WorldItems.Instancing (0 disables instanced rendering).
+ */
+UCLASS()
+class MOFRAMEWORK_API UMOWorldItemPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UWorldSubsystem
+	virtual void Deinitialize() override;
+
+	// Actor pool (authority)
+
+	/** Reuse a parked item of exactly ItemClass, or spawn a new one. The item is active at SpawnTransform and returns to the pool on pickup. */
+	AMOWorldItem* AcquireWorldItem(TSubclassOf<AMOWorldItem> ItemClass, const FTransform& SpawnTransform, const FActorSpawnParameters& SpawnParams);
+
+	/** Park an item for reuse. Returns false if it cannot be pooled (pool full or disabled); the caller should destroy it then. */
+	bool ReleaseWorldItem(AMOWorldItem* Item);
+
+	/** Parked actors across all classes. */
+	UFUNCTION(BlueprintCallable, Category="MO|World Items")
+	int32 GetPooledItemCount() const;
+
+	// Instanced rendering
+
+	/** Draw a resting item through the shared instanced mesh, or move its instance if it is already instanced. */
+	void AddRenderInstance(AMOWorldItem* Item);
+
+	/** Stop instancing an item; it draws its own mesh again. */
+	void RemoveRenderInstance(AMOWorldItem* Item);
+
+	bool IsRenderInstanced(const AMOWorldItem* Item) const { return Item && InstanceByItem.Contains(Item); }
+
+	/** Items currently drawn through instanced meshes. */
+	UFUNCTION(BlueprintCallable, Category="MO|World Items")
+	int32 GetRenderInstanceCount() const { return InstanceByItem.Num(); }
+
+	/** Whether resting items should be instanced at all (mo.WorldItems.Instancing). */
+	static bool IsInstancingEnabled();
+
+private:
+	struct FInstanceBatchKey
+	{
+		TObjectKey<UStaticMesh> Mesh;
+		TObjectKey<UMaterialInterface> Material;
+
+		bool operator==(const FInstanceBatchKey& Other) const { return Mesh == Other.Mesh && Material == Other.Material; }
+		friend uint32 GetTypeHash(const FInstanceBatchKey& Key) { return HashCombine(GetTypeHash(Key.Mesh), GetTypeHash(Key.Material)); }
+	};
+
+	struct FInstanceBatch
+	{
+		TWeakObjectPtr<UInstancedStaticMeshComponent> Component;
+
+		/** Instance slots not currently showing an item (scaled to zero). Reused before adding instances. */
+		TArray<int32> FreeInstances;
+	};
+
+	struct FItemInstance
+	{
+		FInstanceBatchKey Key;
+		int32 InstanceIndex = INDEX_NONE;
+	};
+
+	FInstanceBatch* FindOrCreateBatch(const FInstanceBatchKey& Key, UStaticMesh* Mesh, UMaterialInterface* Material);
+
+	/** Hide an instance slot and hand it back to its batch. */
+	void FreeInstance(const FItemInstance& Instance);
+
+	/** Parked actors by exact class. The actors stay in the level, so weak references suffice. */
+	TMap<TObjectKey<UClass>, TArray<TWeakObjectPtr<AMOWorldItem>>> PooledByClass;
+
+	TMap<FInstanceBatchKey, FInstanceBatch> InstanceBatches;
+	TMap<TObjectKey<AMOWorldItem>, FItemInstance> InstanceByItem;
+
+	/** Local, non-replicated actor that owns the instanced mesh components. */
+	UPROPERTY(Transient)
+	TObjectPtr<AActor> InstanceHost;
+};